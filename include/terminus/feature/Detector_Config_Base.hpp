@@ -51,6 +51,13 @@ class Detector_Config_Base
          */
         virtual math::Size2i tile_size_pixels() const = 0;
 
+        /**
+         * Get the overlap, in pixels, added around each tile.  Detectors which ignore
+         * points near the image border need this so points along tile seams are
+         * still found.  Points are only kept from the tile proper.
+         */
+        virtual int tile_halo_pixels() const;
+
         /**
          * Get the number of max features
         */
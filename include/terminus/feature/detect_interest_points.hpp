@@ -44,7 +44,8 @@ Result<std::vector<Interest_Point>> detect_interest_points( const image::Image_B
                                                             write_pool,
                                                             ip_list,
                                                             detector->config()->tile_size_pixels(),
-                                                            detector->config()->max_features() );
+                                                            detector->config()->max_features(),
+                                                            detector->config()->tile_halo_pixels() );
   
     tmns::log::debug( "Waiting for threads to complete." );
     
@@ -58,6 +58,14 @@ class Detector_Config_OCV_ORB : public Detector_Config_OCV_Base
          */
         math::Size2i tile_size_pixels() const override;
 
+        /**
+         * @brief Get the tile overlap in pixels.
+         * 
+         * ORB skips points within the edge threshold of the image border, so tiles
+         * overlap by that much.
+         */
+        int tile_halo_pixels() const override;
+
         /**
          * @brief Get the max number of features.
          */
@@ -38,19 +38,22 @@ class Interest_Detection_Queue : public core::work::Thread_Pool
          * 
          * @param image
          * @param detector
+         * @param tile_halo Pixels each tile overlaps its neighbors by
         */
         Interest_Detection_Queue( const image::Image_Base<ImageT>&       image,
                                   Detector_Base::ptr_t                   detector,
                                   core::work::Work_Queue_Ordered::ptr_t  write_queue,
                                   Interest_Point_List&                   ip_list,
                                   const math::Size2i&                    tile_size,
-                                  int                                    desired_num_ip = 0 )
+                                  int                                    desired_num_ip = 0,
+                                  int                                    tile_halo = 0 )
              : m_image( image.impl() ),
                m_detector( detector ),
                m_write_queue( std::move( write_queue ) ),
                m_ip_list( ip_list ),
                m_tile_size( tile_size ),
-               m_desired_num_ip( desired_num_ip )
+               m_desired_num_ip( desired_num_ip ),
+               m_tile_halo( tile_halo )
         {
             m_bboxes = m_image.full_bbox().subdivide( tile_size, true );
             this->notify();
@@ -102,6 +105,7 @@ class Interest_Detection_Queue : public core::work::Thread_Pool
             return std::make_shared<task_type>( m_image,
                                                 m_detector,
                                                 m_bboxes[m_index-1],
+                                                m_tile_halo,
                                                 num_ip,
                                                 m_index-1,
                                                 m_bboxes.size(),
@@ -132,6 +136,9 @@ class Interest_Detection_Queue : public core::work::Thread_Pool
         /// @brief Desired number of interest points
         int m_desired_num_ip;
 
+        /// @brief Tile overlap in pixels
+        int m_tile_halo;
+
         /// @brief Internal mutex lock
         core::conc::Mutex m_mutex;
     
@@ -18,7 +18,14 @@
 #include "Interest_Point_Write_Task.hpp"
 
 // Terminus Libraries
+#include <terminus/image/operations/block/Block_Halo.hpp>
 #include <terminus/image/operations/crop_image.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 namespace tmns::feature::utility {
 
@@ -26,6 +33,12 @@ namespace tmns::feature::utility {
  * IP task wrapper for use with the Interest_Detection_Queue
  * thread pool class.
  *  - After IPs are found, they are passed to an Interest_Point_Write_Task object.
+ *  - Tiles are read with a halo around them, so detectors which skip the border see
+ *    past the tile seams.  Only points inside the tile itself are kept, so the
+ *    overlap never produces duplicates.
+ *  - The detector is asked for proportionally more points over the larger read area,
+ *    then the strongest points inside the tile are kept, so the halo does not eat
+ *    into the tile's share.
  */
 template <typename ImageT>
 class Interest_Point_Detection_Task : public core::work::Task,
@@ -39,6 +52,7 @@ class Interest_Point_Detection_Task : public core::work::Task,
         Interest_Point_Detection_Task( const image::Image_Base<ImageT>&  image,
                                        Detector_Base::ptr_t              detector,
                                        const math::Rect2i&               bbox, 
+                                       int                               tile_halo,
                                        int                               desired_num_ip,
                                        int                               id,
                                        int                               max_id,
@@ -47,6 +61,7 @@ class Interest_Point_Detection_Task : public core::work::Task,
             : m_image( image.impl() ),
               m_detector( detector ),
               m_bbox( bbox ),
+              m_tile_halo( tile_halo ),
               m_desired_num_ip( desired_num_ip ),
               m_id( id ),
               m_max_id( max_id ),
@@ -75,25 +90,54 @@ class Interest_Point_Detection_Task : public core::work::Task,
                 tmns::log::debug( sout.str() );
             }
 
+            // Read the tile plus halo, clipped to the image
+            auto read_bbox = math::Rect2i::intersection( image::ops::block::Halo( m_tile_halo ).expand( m_bbox ),
+                                                         m_image.full_bbox() );
+
+            // Rasterize the tile into a pooled buffer, since every task allocates one
+            image::Image_Memory<typename ImageT::pixel_type> tile( image::crop_image( m_image.impl(),
+                                                                                      read_bbox ),
+                                                                   image::tile_memory_policy() );
+
             // Use the m_detector object to find a set of image points in the cropped section of the image.
-            auto detection_results = m_detector->operator()( image::crop_image( m_image.impl(),
-                                                                                m_bbox ),
+            auto detection_results = m_detector->operator()( tile,
                                                               true,
-                                                              m_desired_num_ip );
+                                                              read_num_ip( read_bbox ) );
 
             auto& new_ip_list = detection_results.value();
 
+            Interest_Point_List tile_ip_list;
+            tile_ip_list.reserve( new_ip_list.size() );
             for( auto pt = new_ip_list.begin(); 
                  pt != new_ip_list.end(); 
                  ++pt )
             {
-                pt->pixel_loc()  += m_bbox.min();
-                pt->raster_loc() += m_bbox.min();
+                pt->pixel_loc()  += read_bbox.min();
+                pt->raster_loc() += read_bbox.min();
+
+                // Points in the halo belong to the neighboring tile
+                const auto& loc = pt->raster_loc();
+                if( loc.x() <  m_bbox.min().x() || loc.y() <  m_bbox.min().y() ||
+                    loc.x() >= m_bbox.max().x() || loc.y() >= m_bbox.max().y() )
+                {
+                    continue;
+                }
+                tile_ip_list.push_back( *pt );
+            }
+
+            // Keep the strongest points if the halo request overshot
+            if( m_desired_num_ip > 0 && tile_ip_list.size() > (size_t)m_desired_num_ip )
+            {
+                std::stable_sort( tile_ip_list.begin(),
+                                  tile_ip_list.end(),
+                                  []( const Interest_Point& a, const Interest_Point& b ){
+                                      return a.response() > b.response(); } );
+                tile_ip_list.resize( m_desired_num_ip );
             }
 
             // Append these interest points to the master list
             // owned by the detect_interest_points() function.
-            auto write_task = std::make_shared<Interest_Point_Write_Task>( new_ip_list, m_global_points );
+            auto write_task = std::make_shared<Interest_Point_Write_Task>( tile_ip_list, m_global_points );
             m_write_queue.add_task( write_task, m_id );
 
             {
@@ -105,6 +149,21 @@ class Interest_Point_Detection_Task : public core::work::Task,
 
     private:
 
+        /**
+         * Number of points to ask the detector for over the read region.  The desired
+         * count is for the tile alone, so scale it by the extra area the halo adds.
+        */
+        int read_num_ip( const math::Rect2i& read_bbox ) const
+        {
+            if( m_desired_num_ip <= 0 || m_bbox.area() <= 0 )
+            {
+                return m_desired_num_ip;
+            }
+            double ratio = double( read_bbox.area() ) / double( m_bbox.area() );
+            return std::max( m_desired_num_ip,
+                             (int)std::ceil( ratio * m_desired_num_ip ) );
+        }
+
         /// @brief  Source Image
         ImageT m_image;
     
@@ -113,6 +172,9 @@ class Interest_Point_Detection_Task : public core::work::Task,
     
         /// @brief Region of image to render
         math::Rect2i  m_bbox;
+
+        /// @brief Pixels read around the region
+        int m_tile_halo;
     
         /// @brief Desired number of interest points
         int m_desired_num_ip; 
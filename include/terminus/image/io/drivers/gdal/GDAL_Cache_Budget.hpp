@@ -0,0 +1,166 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    GDAL_Cache_Budget.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// External Terminus Libraries
+#include <terminus/core/cache/Cache_Local.hpp>
+#include <terminus/outcome/Result.hpp>
+
+// C++ Libraries
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace tmns::image::io::gdal {
+
+/**
+ * @class GDAL_Cache_Budget
+ *
+ * Single memory budget shared between GDAL's internal raster block cache (GDAL_CACHEMAX)
+ * and the Terminus tile cache (core::cache::Cache_Local).  Without this, both caches hold
+ * copies of the same pixels and neither knows about the other.
+ *
+ * - While no tile cache is active, GDAL is given the entire budget.
+ * - Once a tile cache is requested via `tile_cache()`, GDAL is shrunk down to its reserve
+ *   and the tile cache is sized with whatever remains.
+ * - When the last reference to the tile cache is released, GDAL gets the entire budget
+ *   back.
+ * - In streaming mode, GDAL's block cache is flushed after every read so decoded blocks
+ *   are not held twice.
+*/
+class GDAL_Cache_Budget
+{
+    public:
+
+        /// Default total budget [bytes]
+        static constexpr size_t DEFAULT_TOTAL_BYTES = 1000000000;
+
+        /// Default fraction of the budget GDAL keeps while a tile cache is active
+        static constexpr double DEFAULT_GDAL_RESERVE_FRACTION = 0.1;
+
+        /**
+         * Get the global budget instance
+        */
+        static GDAL_Cache_Budget& instance();
+
+        /**
+         * Set the total memory budget shared by GDAL and the tile cache
+         *
+         * @note If a tile cache was already created, it keeps its original size.  New
+         *       caches, as well as the GDAL cache, pick up the new budget immediately.
+        */
+        Result<void> set_total_bytes( size_t total_bytes );
+
+        /**
+         * Get the total memory budget
+        */
+        size_t total_bytes() const;
+
+        /**
+         * Set the fraction of the budget which GDAL retains while a tile cache is active.
+         * @param fraction Value in the range [0,1]
+        */
+        Result<void> set_gdal_reserve_fraction( double fraction );
+
+        /**
+         * Get the fraction of the budget which GDAL retains while a tile cache is active.
+        */
+        double gdal_reserve_fraction() const;
+
+        /**
+         * Number of bytes currently allotted to GDAL's block cache
+        */
+        size_t gdal_cache_bytes() const;
+
+        /**
+         * Number of bytes allotted to the tile cache
+        */
+        size_t tile_cache_bytes() const;
+
+        /**
+         * Get the shared tile cache, creating it if it does not exist.  Creating the
+         * cache shrinks GDAL's block cache to its reserve, and releasing it grows GDAL's
+         * cache back to the full budget.
+        */
+        core::cache::Cache_Local::ptr_t tile_cache();
+
+        /**
+         * Check if a tile cache is currently alive
+        */
+        bool tile_cache_active() const;
+
+        /**
+         * Enable/Disable streaming reads.  When enabled, GDAL's block cache for a dataset
+         * is dropped after each read.
+        */
+        void set_streaming_reads( bool value );
+
+        /**
+         * Check if streaming reads are enabled
+        */
+        bool streaming_reads() const;
+
+        /**
+         * Push the current budget into GDAL.  Skipped while GDAL_CACHEMAX is set in the
+         * GDAL config or environment, unless `set_total_bytes()` was called.
+         *
+         * @note Caller must not hold the budget mutex.  GDAL does not require the master
+         *       GDAL mutex for this call.
+        */
+        void apply() const;
+
+        /**
+         * Print to log-friendly string
+        */
+        std::string to_log_string( size_t offset = 0 ) const;
+
+    private:
+
+        /**
+         * Constructor
+        */
+        GDAL_Cache_Budget() = default;
+
+        /**
+         * Destructor.  Tile caches released after this no longer update GDAL.
+        */
+        ~GDAL_Cache_Budget();
+
+        /**
+         * Compute the GDAL allotment.  Caller must hold the budget mutex.
+        */
+        size_t gdal_cache_bytes_locked() const;
+
+        /// Total Budget
+        size_t m_total_bytes { DEFAULT_TOTAL_BYTES };
+
+        /// Set once the total is chosen explicitly, overriding GDAL_CACHEMAX
+        bool m_total_bytes_set { false };
+
+        /// GDAL Reserve while tile cache active
+        double m_gdal_reserve_fraction { DEFAULT_GDAL_RESERVE_FRACTION };
+
+        /// Streaming read flag
+        bool m_streaming_reads { false };
+
+        /// Shared tile cache (weak so the budget does not keep it alive)
+        std::weak_ptr<core::cache::Cache_Local> m_tile_cache;
+
+        /// Mutex protecting the budget
+        mutable std::mutex m_mtx;
+
+}; // End of GDAL_Cache_Budget class
+
+} // End of tmns::image::io::gdal namespace
@@ -0,0 +1,127 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    GDAL_Dataset_Registry.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// External Terminus Libraries
+#include <terminus/outcome/Result.hpp>
+
+// C++ Libraries
+#include <atomic>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+// GDAL is hidden behind the PIMPL, so only forward-declare it here.
+class GDALDataset;
+
+namespace tmns::image::io::gdal {
+
+/**
+ * @class GDAL_Dataset_Registry
+ *
+ * Caps the number of simultaneously open read datasets.  Each `GDAL_Disk_Image_Impl` registers
+ * under a unique key and asks the registry for its dataset on every access.  When the cap is
+ * reached, the least-recently-used dataset is closed and transparently reopened the next time
+ * its owner reads.  Format and block-size probes live on the owner, so reopening is a plain
+ * `GDALOpen()`.
+ *
+ * @note All `_locked` methods require the caller to hold `get_master_gdal_mutex()`.
+*/
+class GDAL_Dataset_Registry
+{
+    public:
+
+        /// Dataset Pointer Type
+        typedef std::shared_ptr<GDALDataset> DatasetPtrT;
+
+        /// Default number of open datasets
+        static constexpr size_t DEFAULT_MAX_OPEN_DATASETS = 256;
+
+        /**
+         * Get the global registry instance
+        */
+        static GDAL_Dataset_Registry& instance();
+
+        /**
+         * Create a new, unique key for a dataset owner
+        */
+        uint64_t next_key();
+
+        /**
+         * Set the maximum number of open datasets.  Excess datasets are closed immediately.
+        */
+        Result<void> set_max_open_datasets( size_t max_open );
+
+        /**
+         * Get the maximum number of open datasets
+        */
+        size_t max_open_datasets() const;
+
+        /**
+         * Get the number of datasets currently open
+        */
+        size_t num_open_datasets() const;
+
+        /**
+         * Get the dataset for the key, opening (or reopening) it if needed.
+        */
+        Result<DatasetPtrT> acquire_locked( uint64_t                     key,
+                                            const std::filesystem::path& pathname );
+
+        /**
+         * Check if the dataset for this key is currently open
+        */
+        bool is_open_locked( uint64_t key ) const;
+
+        /**
+         * Close and forget the dataset for this key.
+        */
+        void release_locked( uint64_t key );
+
+    private:
+
+        /**
+         * Constructor
+        */
+        GDAL_Dataset_Registry() = default;
+
+        /**
+         * Close least-recently-used datasets until we're under the max count.
+        */
+        void evict_locked( size_t max_open );
+
+        /// Entry in the table
+        struct Entry
+        {
+            DatasetPtrT                  dataset;
+            std::list<uint64_t>::iterator lru_pos;
+        };
+
+        /// Max datasets allowed open
+        size_t m_max_open_datasets { DEFAULT_MAX_OPEN_DATASETS };
+
+        /// Key Counter
+        std::atomic<uint64_t> m_key_counter { 0 };
+
+        /// Most-recently used at the front
+        std::list<uint64_t> m_lru;
+
+        /// Open datasets
+        std::unordered_map<uint64_t,Entry> m_datasets;
+
+}; // End of GDAL_Dataset_Registry class
+
+} // End of tmns::image::io::gdal namespace
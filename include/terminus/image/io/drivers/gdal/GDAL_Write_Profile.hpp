@@ -0,0 +1,60 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    GDAL_Write_Profile.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/core/error/ErrorCategory.hpp>
+
+// C++ Libraries
+#include <string>
+
+namespace tmns::image::io::gdal {
+
+/**
+ * Write-tuning profiles for the GDAL writer.  Select one by adding
+ * `WRITE_PROFILE_OPTION` to the `write_options` passed to `write_image()`.
+ *
+ * Profiles only fill in options you did not set yourself, and only apply to
+ * GeoTIFF outputs.
+ *
+ * - FAST:     Fast compression, no predictor, large tiles
+ * - BALANCED: DEFLATE with a predictor matched to the channel type
+ * - ARCHIVE:  Strongest compression with a predictor matched to the channel type
+ *
+ * All profiles enable GDAL's multi-threaded compression once the image spans
+ * more than one tile.
+*/
+enum class GDAL_Write_Profile
+{
+    NONE     = 0,
+    FAST     = 1,
+    BALANCED = 2,
+    ARCHIVE  = 3,
+}; // End of GDAL_Write_Profile enum
+
+/// Write-option key used to select a profile.  Removed before options reach GDAL.
+inline const std::string WRITE_PROFILE_OPTION { "TERMINUS_WRITE_PROFILE" };
+
+/**
+ * Convert the profile to a string
+*/
+std::string enum_to_string( GDAL_Write_Profile profile );
+
+/**
+ * Parse a profile name ("fast", "balanced", "archive").  Case-insensitive.
+*/
+Result<GDAL_Write_Profile> parse_write_profile( const std::string& name );
+
+} // End of tmns::image::io::gdal namespace
@@ -21,6 +21,7 @@
 
 // Terminus Libraries
 #include "../types/Image_Disk.hpp"
+#include "drivers/gdal/GDAL_Cache_Budget.hpp"
 #include "read_image.hpp"
 
 // C++ Libraries
@@ -35,6 +36,8 @@ namespace tmns::image::io {
  * @param pathname Path of image to load from disk.
  * @param driver_manager Factory for creating resources.  Allows you to inject your own drivers without touching
  *                       too deep into the guts of Terminus.
+ * @param cache Tile cache.  Defaults to the shared cache sized by `gdal::GDAL_Cache_Budget`, so GDAL's
+ *              block cache is shrunk while tiles are cached here.
  *
  * @return Instance of image.  Note that a Disk-Image is lazy and doesn't actually pull it into ram.  Calls to `rasterize()`
  *          will be painful.
@@ -42,7 +45,7 @@ namespace tmns::image::io {
 template <typename PixelT>
 Result<Image_Disk<PixelT>> read_image_disk( const std::filesystem::path&      pathname,
                                             const Disk_Driver_Manager::ptr_t  driver_manager = Disk_Driver_Manager::create_read_defaults(),
-                                            core::cache::Cache_Local::ptr_t   cache = std::make_shared<core::cache::Cache_Local>( 1000000000 ) )
+                                            core::cache::Cache_Local::ptr_t   cache = gdal::GDAL_Cache_Budget::instance().tile_cache() )
 {
     // Create an image resource for the data
     auto driver_res = driver_manager->pick_read_driver( pathname );
@@ -185,7 +185,8 @@ Result<void> write_image( Image_Resource_Base::ptr_t         resource,
 
             // Rasterize this image block
             Image_Memory<typename ImageT::pixel_type> image_block( crop_image( image.impl(),
-                                                                               current_bbox ) );
+                                                                               current_bbox ),
+                                                                   tile_memory_policy() );
 
             Image_Buffer buf = image_block.buffer();
             resource->write( buf, current_bbox );
@@ -269,7 +270,8 @@ Result<void> write_image_block( Image_Resource_Base::ptr_t         resource,
             progress_callback.report_progress( ( processed_row_blocks + processed_col_blocks ) / static_cast<float>(total_num_blocks));
 
             // Rasterize this image block
-            Image_Memory<typename ImageT::pixel_type> image_block( crop(image.impl(), current_bbox) );
+            Image_Memory<typename ImageT::pixel_type> image_block( crop(image.impl(), current_bbox),
+                                                                   tile_memory_policy() );
             Image_Buffer buf = image_block.buffer();
             resource->write( buf, current_bbox );
 
@@ -15,7 +15,12 @@
 #pragma once
 
 /// C++ Libraries
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
 
 /// Boost Libraries
 #include <boost/property_tree/ptree.hpp>
@@ -28,6 +33,11 @@ namespace tmns::image::meta {
 /**
  * Storage container for image metadata.  This is a wrapper around boost::property_tree that allows for 
  * more imagery-specific calls.  
+ *
+ * Expensive metadata (e.g. large label domains) can be registered as deferred domains.  A deferred
+ * domain is only extracted the first time the container is queried, or when explicitly requested
+ * via `load_domain()`.  Merging containers carries deferred domains along without loading them, and
+ * each domain is only ever extracted once no matter how many containers share it.
 */
 class Metadata_Container_Base
 {
@@ -39,6 +49,9 @@ class Metadata_Container_Base
         /// Property Tree Type
         using tree_type = boost::property_tree::ptree;
 
+        /// Callback which fills a container with the contents of a deferred domain
+        using loader_type = std::function<Result<void>( Metadata_Container_Base& )>;
+
         Metadata_Container_Base() = default;
 
         /**
@@ -58,6 +71,7 @@ class Metadata_Container_Base
                              const ValueT&      value,
                              bool               overwrite_match = true )
         {
+            std::unique_lock<std::mutex> lck( m_mtx );
             if( overwrite_match && m_tree.count( key ) > 0 )
             {
                 return outcome::ok();
@@ -78,6 +92,8 @@ class Metadata_Container_Base
         template <typename ValueT>
         Result<ValueT> get( const std::string& key_name ) const
         {
+            load_all();
+            std::unique_lock<std::mutex> lck( m_mtx );
             if( m_tree.count( key_name ) <= 0 )
             {
                 return outcome::fail( core::error::ErrorCode::NOT_FOUND,
@@ -86,6 +102,37 @@ class Metadata_Container_Base
             return outcome::ok<ValueT>( m_tree.get<ValueT>( key_name ) );
         }
 
+        /**
+         * Register a domain whose extraction is deferred until the container is first queried.
+         *
+         * @param domain Name of the domain, used for `load_domain()`
+         * @param loader Callback which fills the provided container
+         * @param overwrite_matches Same meaning as for the container merge
+         */
+        void insert_deferred( const std::string& domain,
+                              loader_type        loader,
+                              bool               overwrite_matches = true );
+
+        /**
+         * Load a single deferred domain.  Does nothing if the domain is unknown or already loaded.
+         */
+        Result<void> load_domain( const std::string& domain ) const;
+
+        /**
+         * Load all deferred domains
+         */
+        Result<void> load_all() const;
+
+        /**
+         * Get the names of the domains which have not been loaded yet
+         */
+        std::vector<std::string> deferred_domains() const;
+
+        /**
+         * Drop the domains which have not been loaded yet, e.g. when the source is reopened
+         */
+        void clear_deferred();
+
         /**
          * Print contents to pretty string
          */
@@ -93,8 +140,39 @@ class Metadata_Container_Base
 
     private:
 
+        /// Deferred domain, shared by every container it was merged into
+        struct Deferred_Domain
+        {
+            std::string                 domain;
+            loader_type                 loader;
+            std::once_flag              flag;
+            ptr_t                       contents;
+            std::optional<Result<void>> status;
+        };
+
+        /// Reference to a deferred domain which has not been merged into this container
+        struct Pending_Domain
+        {
+            std::shared_ptr<Deferred_Domain> entry;
+            bool                             overwrite_matches;
+        };
+
+        /**
+         * Load the pending domains matching the name (or all if empty)
+         */
+        Result<void> load_pending( const std::optional<std::string>& domain ) const;
+
         /// Underlying Container
-        tree_type m_tree;
+        mutable tree_type m_tree;
+
+        /// Domains not yet merged into the tree
+        mutable std::vector<Pending_Domain> m_pending;
+
+        /// Domains already merged into the tree
+        mutable std::vector<std::shared_ptr<Deferred_Domain>> m_loaded;
+
+        /// Protects the tree and the deferred domain lists
+        mutable std::mutex m_mtx;
 
 }; // End of Metadata_Container_Base class
 
@@ -15,11 +15,15 @@
 #pragma once
 
 // Terminus Image Libraries
-#include "../../types/Image_Memory.hpp"
+#include "../../types/Packed_Image_Memory.hpp"
 
 // Terminus Libraries
 #include <terminus/core/error/ErrorCategory.hpp>
 
+// C++ Libraries
+#include <atomic>
+#include <memory>
+
 
 namespace tmns::image::ops::block {
 
@@ -29,15 +33,20 @@ class Block_Generator
 {
     public:
 
-        typedef Image_Memory<typename ImageT::pixel_type> value_type;
+        typedef Packed_Image_Memory<typename ImageT::pixel_type> value_type;
 
         /**
          * Constructor
+         * @param storage_type Channel type of the source data.  UINT12/UINT14 tiles are
+         *                     kept bit-packed in the cache.
         */
         Block_Generator( const std::shared_ptr<ImageT>& child,
-                         const math::Rect2i&            bbox )
+                         const math::Rect2i&            bbox,
+                         Channel_Type_Enum              storage_type = Channel_Type_Enum::UNKNOWN )
           : m_child( child ),
-            m_bbox( bbox )
+            m_bbox( bbox ),
+            m_storage_type( storage_type ),
+            m_held_bytes( std::make_shared<std::atomic<size_t>>( 0 ) )
         {}
 
         static std::string class_name()
@@ -47,20 +56,35 @@ class Block_Generator
 
         /**
          * Return the size of the image in bytes that the image
-         * occupies.
+         * occupies.  Once generated this is what the block actually holds, which is
+         * the unpacked size if any value didn't fit the packed storage type.  Before
+         * that it's the unpacked size, since packing isn't known to succeed.
          */
         size_t size_bytes() const
         {
+            size_t held_bytes = m_held_bytes->load();
+            if( held_bytes > 0 )
+            {
+                return held_bytes;
+            }
             return m_bbox.width() * m_bbox.height() * m_child->planes() * sizeof( typename ImageT::pixel_type );
         }
 
         /**
-         * Rasterize the image chunk into memory from wherever it is derived from
+         * Rasterize the image chunk into memory from wherever it is derived from.
+         * Tile buffers come from the shared pool, so regenerating evicted blocks
+         * reuses their memory.
          */
         std::shared_ptr<value_type> generate() const
         {
-            auto ptr = std::shared_ptr<value_type>( new value_type(  m_bbox.width(), m_bbox.height(), m_child->planes() ) );
-            m_child->rasterize( *ptr, m_bbox );
+            auto ptr = std::shared_ptr<value_type>( new value_type( m_bbox.width(),
+                                                                    m_bbox.height(),
+                                                                    m_child->planes(),
+                                                                    m_storage_type,
+                                                                    tile_memory_policy() ) );
+            m_child->rasterize( ptr->image(), m_bbox );
+            ptr->pack();
+            m_held_bytes->store( ptr->size_bytes() );
             return ptr;
         }
 
@@ -72,6 +96,12 @@ class Block_Generator
         /// ROI of input image
         math::Rect2i m_bbox;
 
+        /// Channel type to store the block as
+        Channel_Type_Enum m_storage_type { Channel_Type_Enum::UNKNOWN };
+
+        /// Bytes held by the last generated block, shared by copies of this generator
+        std::shared_ptr<std::atomic<size_t>> m_held_bytes;
+
 }; // End of Block_Generator Class
 
 } // End of tmns::image::ops::block namespace
\ No newline at end of file
@@ -42,10 +42,12 @@ class Block_Generator_Manager
 
         /**
          * Create blocks for each region of the imagery
+         * @param storage_type Channel type of the source data, used to bit-pack 12/14-bit blocks
          */
         Result<void> initialize( core::cache::Cache_Local::ptr_t  cache,
                                  const math::Size2i&              block_size,
-                                 std::shared_ptr<ImageT>          image )
+                                 std::shared_ptr<ImageT>          image,
+                                 Channel_Type_Enum                storage_type = Channel_Type_Enum::UNKNOWN )
         {
             // Assign the base structures
             m_cache_ptr  = cache;
@@ -80,7 +82,7 @@ class Block_Generator_Manager
                                    m_block_size.height() );
 
                 bbox = math::Rect2i::intersection( bbox, view_bbox );
-                block(ix,iy) = m_cache_ptr->insert( Block_Generator<ImageT>( image, bbox ) );
+                block(ix,iy) = m_cache_ptr->insert( Block_Generator<ImageT>( image, bbox, storage_type ) );
             }} // End loop through the blocks
 
             return outcome::ok();
@@ -0,0 +1,136 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Block_Guarded_Functor.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "../rasterize.hpp"
+
+// Terminus Libraries
+#include <terminus/math/Rectangle.hpp>
+
+// C++ Libraries
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+
+namespace tmns::image::ops::block {
+
+/**
+ * Wraps a block functor for the `Block_Processor`.  Nested rasterize calls made while
+ * a block runs stay on that worker's thread, and an exception thrown by any block is
+ * caught on the worker and kept, so the caller can rethrow it once the processor is
+ * done.  Only the first error is kept.
+ *
+ * The processor copies the functor into each thread, so the error slot is shared.
+*/
+template <typename FuncT>
+class Block_Guarded_Functor
+{
+    public:
+
+        /**
+         * Constructor
+         * @param func Called as `func( bbox )`, or `func( bbox, halo_bbox )` for halo processors
+        */
+        explicit Block_Guarded_Functor( const FuncT& func )
+          : m_func( func ),
+            m_error( std::make_shared<Error_State>() )
+        {}
+
+        /**
+         * Process one block
+        */
+        void operator()( const math::Rect2i& bbox ) const
+            requires std::is_invocable_v<const FuncT&,const math::Rect2i&>
+        {
+            guard( [&](){ m_func( bbox ); } );
+        }
+
+        /**
+         * Process one block, given its input region from the processor's halo
+        */
+        void operator()( const math::Rect2i& bbox,
+                         const math::Rect2i& halo_bbox ) const
+            requires std::is_invocable_v<const FuncT&,const math::Rect2i&,const math::Rect2i&>
+        {
+            guard( [&](){ m_func( bbox, halo_bbox ); } );
+        }
+
+        /**
+         * Throw the first error hit by any block
+        */
+        void rethrow() const
+        {
+            if( m_error->error )
+            {
+                std::rethrow_exception( m_error->error );
+            }
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Block_Guarded_Functor";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + FuncT::full_name() + ">";
+        }
+
+    private:
+
+        /**
+         * Run the block with nested rasterizes kept on this thread, recording any error
+        */
+        template <typename BodyT>
+        void guard( const BodyT& body ) const
+        {
+            bool in_band = ops::detail::g_rasterize_in_band;
+            ops::detail::g_rasterize_in_band = true;
+            try
+            {
+                body();
+            }
+            catch( ... )
+            {
+                std::lock_guard<std::mutex> lock( m_error->mtx );
+                if( !m_error->error )
+                {
+                    m_error->error = std::current_exception();
+                }
+            }
+            ops::detail::g_rasterize_in_band = in_band;
+        }
+
+        struct Error_State
+        {
+            std::mutex         mtx;
+            std::exception_ptr error;
+        };
+
+        /// Block computation
+        FuncT m_func;
+
+        /// First error from any thread
+        std::shared_ptr<Error_State> m_error;
+
+}; // End of Block_Guarded_Functor Class
+
+} // End of tmns::image::ops::block namespace
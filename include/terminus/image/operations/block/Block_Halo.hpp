@@ -0,0 +1,144 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Block_Halo.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/Rectangle.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <concepts>
+#include <sstream>
+#include <string>
+
+namespace tmns::image::ops::block {
+
+/**
+ * Extra input pixels, on each side, that a view needs around an output region.
+ * Neighborhood operations (convolution, morphology, feature detection) declare one
+ * through a `halo()` method, and views built on top of them report their children's,
+ * so block workers can fetch the whole input for a tile at once.
+*/
+struct Halo
+{
+    /// Columns needed before the region
+    int left { 0 };
+
+    /// Rows needed before the region
+    int top { 0 };
+
+    /// Columns needed after the region
+    int right { 0 };
+
+    /// Rows needed after the region
+    int bottom { 0 };
+
+    /**
+     * Default Constructor.  No extra pixels.
+    */
+    Halo() = default;
+
+    /**
+     * Constructor for the same radius on every side
+    */
+    explicit Halo( int radius )
+      : left( radius ), top( radius ), right( radius ), bottom( radius )
+    {}
+
+    /**
+     * Constructor
+    */
+    Halo( int left_,
+          int top_,
+          int right_,
+          int bottom_ )
+      : left( left_ ), top( top_ ), right( right_ ), bottom( bottom_ )
+    {}
+
+    /**
+     * Check if no extra pixels are needed
+    */
+    bool empty() const
+    {
+        return left == 0 && top == 0 && right == 0 && bottom == 0;
+    }
+
+    /**
+     * Grow a region by the halo
+    */
+    math::Rect2i expand( const math::Rect2i& bbox ) const
+    {
+        return math::Rect2i( bbox.min().x() - left,
+                             bbox.min().y() - top,
+                             bbox.width()  + left + right,
+                             bbox.height() + top  + bottom );
+    }
+
+    /**
+     * Halo of one neighborhood operation applied on top of another
+    */
+    Halo operator+( const Halo& other ) const
+    {
+        return Halo( left   + other.left,
+                     top    + other.top,
+                     right  + other.right,
+                     bottom + other.bottom );
+    }
+
+    bool operator==( const Halo& other ) const = default;
+
+    /**
+     * Halo covering both inputs, for views reading several images over the same region
+    */
+    static Halo merge( const Halo& a,
+                       const Halo& b )
+    {
+        return Halo( std::max( a.left,   b.left ),
+                     std::max( a.top,    b.top ),
+                     std::max( a.right,  b.right ),
+                     std::max( a.bottom, b.bottom ) );
+    }
+
+    /**
+     * Print log-friendly string
+    */
+    std::string to_string() const
+    {
+        std::stringstream sout;
+        sout << "Halo( left: " << left << ", top: " << top
+             << ", right: " << right << ", bottom: " << bottom << " )";
+        return sout.str();
+    }
+
+}; // End of Halo struct
+
+/**
+ * Get the halo of a view.  Views without a `halo()` method only read the pixels
+ * they output.
+*/
+template <typename ImageT>
+Halo image_halo( const ImageT& image )
+{
+    if constexpr( requires { { image.halo() } -> std::convertible_to<Halo>; } )
+    {
+        return image.halo();
+    }
+    else
+    {
+        return Halo();
+    }
+}
+
+} // End of tmns::image::ops::block namespace
@@ -19,6 +19,11 @@
 
 // Terminus Image Libraries
 #include <terminus/image/utility/Log_Utilities.hpp>
+#include "Block_Halo.hpp"
+
+// C++ Libraries
+#include <optional>
+#include <type_traits>
 
 namespace tmns::image::ops::block {
 
@@ -43,6 +48,25 @@ class Block_Processor
             m_block_size(block_size),
             m_num_threads( threads ) {}
 
+        /**
+         * Create a Block_Processor for a neighborhood operation.
+         * - If the func object has an operator(BBox2i block, BBox2i halo_bbox), it is
+         *   also given the block grown by the halo, so it can fetch its whole input
+         *   in one read.  Functors taking only the block ignore the halo.
+         * @param bounds Region the halo bbox is clipped to, usually the input image.
+         *               Leave empty to let the functor handle pixels off the image.
+        */
+        Block_Processor( const FuncT&                       func,
+                         const math::Size2i&                block_size,
+                         const Halo&                        halo,
+                         const std::optional<math::Rect2i>& bounds  = std::nullopt,
+                         size_t                             threads = std::max( (int)std::thread::hardware_concurrency() / 4, 2 ) )
+          : m_func(func),
+            m_block_size(block_size),
+            m_num_threads( threads ),
+            m_halo( halo ),
+            m_bounds( bounds ) {}
+
         /// We will construct and call one BlockThread per thread.
         class Block_Thread
         {
@@ -54,9 +78,11 @@ class Block_Processor
                 {
                     public:
 
-                        Info( const FuncT&         func,
-                              const math::Rect2i&  total_bbox,
-                              const math::Size2i&  block_size )
+                        Info( const FuncT&                       func,
+                              const math::Rect2i&                total_bbox,
+                              const math::Size2i&                block_size,
+                              const Halo&                        halo,
+                              const std::optional<math::Rect2i>& bounds )
                             : m_func(func),
                               m_total_bbox(total_bbox),
                               m_block_bbox( round_down( total_bbox.min().x(),
@@ -65,7 +91,9 @@ class Block_Processor
                                                         block_size.height() ),
                                             block_size.width(),
                                             block_size.height() ),
-                              m_block_size(block_size) {}
+                              m_block_size(block_size),
+                              m_halo( halo ),
+                              m_bounds( bounds ) {}
 
 
                         // Return the next block bbox to process.
@@ -82,6 +110,24 @@ class Block_Processor
                             return m_func;
                         }
 
+                        // Process one block, along with its halo if the functor wants it
+                        void process( const math::Rect2i& bbox ) const
+                        {
+                            if constexpr( std::is_invocable_v<const FuncT&,const math::Rect2i&,const math::Rect2i&> )
+                            {
+                                auto halo_bbox = m_halo.expand( bbox );
+                                if( m_bounds )
+                                {
+                                    halo_bbox = math::Rect2i::intersection( halo_bbox, *m_bounds );
+                                }
+                                m_func( bbox, halo_bbox );
+                            }
+                            else
+                            {
+                                m_func( bbox );
+                            }
+                        }
+
                         // Are we finished?
                         bool complete() const
                         {
@@ -125,6 +171,8 @@ class Block_Processor
                         math::Rect2i       m_total_bbox;
                         math::Rect2i       m_block_bbox;
                         math::Size2i       m_block_size;
+                        Halo               m_halo;
+                        std::optional<math::Rect2i> m_bounds;
                         core::conc::Mutex  m_mutex;
                 }; // End class Info
 
@@ -146,7 +194,7 @@ class Block_Processor
                             bbox = info.bbox();
                             info.advance();
                         }
-                        info.func()( bbox );
+                        info.process( bbox );
                     }
                 }
 
@@ -160,7 +208,7 @@ class Block_Processor
         */
         void operator()( math::Rect2i bbox ) const
         {
-            typename Block_Thread::Info info( m_func, bbox, m_block_size );
+            typename Block_Thread::Info info( m_func, bbox, m_block_size, m_halo, m_bounds );
 
             // Avoid threads altogether in the single-threaded case.
             // Annoyingly, this still creates an unnecessary Mutex.
@@ -211,6 +259,12 @@ class Block_Processor
         /// @brief Number of threads to generate
         int   m_num_threads;
 
+        /// @brief Extra input each block needs around it
+        Halo m_halo;
+
+        /// @brief Region the halo bbox is clipped to
+        std::optional<math::Rect2i> m_bounds;
+
 }; // End class Block_Processor
 
 } // End of tmns::image::ops::block namespace
\ No newline at end of file
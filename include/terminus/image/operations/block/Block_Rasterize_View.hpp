@@ -19,6 +19,7 @@
 #include "../../types/Image_Base.hpp"
 #include "../crop_image.hpp"
 #include "Block_Generator_Manager.hpp"
+#include "Block_Halo.hpp"
 #include "Block_Processor.hpp"
 #include "Block_Utilities.hpp"
 
@@ -26,11 +27,19 @@
 #include <terminus/core/cache/Cache_Base.hpp>
 #include <terminus/math/Size.hpp>
 
+// C++ Libraries
+#include <algorithm>
+#include <thread>
+
 namespace tmns::image::ops {
 
 /**
  * Image type that overloads the rasterize method to allow processing
  * in blocks.  Creates a wrapper around the parent type.
+ *
+ * When the child reads a halo around its output (convolution, morphology, ...),
+ * each worker prerasterizes the child once per block, which pulls the block plus
+ * halo from the inputs in a single read rather than pixel by pixel at block edges.
 */
 template <typename ImageT>
 class Block_Rasterize_View : public Image_Base<Block_Rasterize_View<ImageT>>
@@ -72,7 +81,32 @@ class Block_Rasterize_View : public Image_Base<Block_Rasterize_View<ImageT>>
             {
                 m_block_manager.initialize( m_cache_ptr,
                                             m_block_size,
-                                            m_child );
+                                            m_child,
+                                            resource->channel_type() );
+            }
+            m_halo = block::image_halo( *m_child );
+        }
+
+        /**
+         * Constructor given any view.  Blocks are computed without a cache.
+         * @param image       View to rasterize in blocks
+         * @param block_size  Block size.  Non-positive sizes pick a default.
+         * @param num_threads Threads for rasterizing.  0 uses the global `rasterize_parallel_settings()`.
+         */
+        Block_Rasterize_View( const ImageT&        image,
+                              const math::Size2i&  block_size,
+                              int                  num_threads = 0 )
+          : m_child( std::make_shared<ImageT>( image ) ),
+            m_block_size( block_size ),
+            m_num_threads( num_threads ),
+            m_halo( block::image_halo( image ) )
+        {
+            if( m_block_size.width()  <= 0 ||
+                m_block_size.height() <= 0 )
+            {
+                m_block_size = block::get_default_block_size<pixel_type>( image.rows(),
+                                                                          image.cols(),
+                                                                          image.planes() );
             }
         }
 
@@ -154,6 +188,14 @@ class Block_Rasterize_View : public Image_Base<Block_Rasterize_View<ImageT>>
         ImageT*       child()       { return *m_child; }
         const ImageT& child() const { return *m_child; }
 
+        /**
+         * Input pixels the child needs around an output region
+        */
+        block::Halo halo() const
+        {
+            return m_halo;
+        }
+
         typedef Crop_View<Image_Memory<pixel_type> > prerasterize_type;
         prerasterize_type prerasterize( const math::Rect2i& bbox ) const
         {
@@ -181,9 +223,10 @@ class Block_Rasterize_View : public Image_Base<Block_Rasterize_View<ImageT>>
             Rasterize_Functor<DestT> rasterizer( *this, dest, bbox.min() );
 
             // Set up block processor to call the functor in parallel blocks.
+            size_t threads = rasterize_thread_count( std::max( m_num_threads, 0 ) );
             block::Block_Processor<Rasterize_Functor<DestT> > process( rasterizer,
                                                                        m_block_size,
-                                                                       m_num_threads );
+                                                                       threads );
 
             // Tell the block processor to do all the work.
             process( bbox );
@@ -232,6 +275,41 @@ class Block_Rasterize_View : public Image_Base<Block_Rasterize_View<ImageT>>
                  * Rasterize part of m_view into m_dest.
                  */
                 void operator()( const math::Rect2i& bbox ) const
+                {
+                    // Nested rasterize calls stay on this worker
+                    bool in_band = ops::detail::g_rasterize_in_band;
+                    ops::detail::g_rasterize_in_band = true;
+                    try
+                    {
+                        process( bbox );
+                    }
+                    catch( ... )
+                    {
+                        ops::detail::g_rasterize_in_band = in_band;
+                        throw;
+                    }
+                    ops::detail::g_rasterize_in_band = in_band;
+                }
+
+                /**
+                 * Get this class name
+                 */
+                static std::string class_name()
+                {
+                    return "Rasterize_Functor";
+                }
+
+                static std::string full_name()
+                {
+                    return class_name() + "<" + DestT::full_name() + ">";
+                }
+
+            private:
+
+                /**
+                 * Fill one block of the destination
+                */
+                void process( const math::Rect2i& bbox ) const
                 {
                     if( m_image.m_cache_ptr )
                     {
@@ -247,6 +325,14 @@ class Block_Rasterize_View : public Image_Base<Block_Rasterize_View<ImageT>>
                                            bbox - m_image.m_block_manager.get_block_start_pixel(block_index) );
                         handle.release();
                     }
+                    // Neighborhood child, pull the block plus halo once and evaluate from it
+                    else if( !m_image.m_halo.empty() )
+                    {
+                        auto offset_bbox = bbox-m_offset;
+                        ops::rasterize( m_image.child().prerasterize( bbox ),
+                                        crop_image( m_dest, offset_bbox ),
+                                        bbox );
+                    }
                     // No cache, generate the image tile from scratch.
                     else
                     {
@@ -255,21 +341,6 @@ class Block_Rasterize_View : public Image_Base<Block_Rasterize_View<ImageT>>
                     }
                 }
 
-                /**
-                 * Get this class name
-                 */
-                static std::string class_name()
-                {
-                    return "Rasterize_Functor";
-                }
-
-                static std::string full_name()
-                {
-                    return class_name() + "<" + DestT::full_name() + ">";
-                }
-
-            private:
-
                 /// Internal Block View
                 const Block_Rasterize_View& m_image;
 
@@ -299,6 +370,9 @@ class Block_Rasterize_View : public Image_Base<Block_Rasterize_View<ImageT>>
         /// Block-Management API
         block::Block_Generator_Manager<ImageT> m_block_manager;
 
+        /// Input pixels the child needs around each block
+        block::Halo m_halo;
+
 }; // End of Block_Rasterize_View class
 
 } // End of tmns::image::ops namespace
\ No newline at end of file
@@ -0,0 +1,182 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Block_Tile_Rasterizer.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "../../types/Image_Memory.hpp"
+#include "../../types/Image_Memory_Policy.hpp"
+#include "../crop_image.hpp"
+#include "../rasterize.hpp"
+#include "Block_Guarded_Functor.hpp"
+#include "Block_Processor.hpp"
+
+// Terminus Libraries
+#include <terminus/math/Size.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+namespace tmns::image::ops::block {
+
+/**
+ * Fills one tile at a time for views which compute whole tiles at once, then copies
+ * each tile into the destination.  Used through `rasterize_tiles()`, which wraps it
+ * in a `Block_Guarded_Functor`.
+*/
+template <typename PixelT,
+          typename DestT,
+          typename FillT>
+class Block_Tile_Rasterizer
+{
+    public:
+
+        /**
+         * Constructor
+         * @param fill   Called as `fill( bbox, tile )` to compute the pixels of `bbox`
+         *               into a tile of the same size.  Neighborhood operations may
+         *               instead take `fill( bbox, halo_bbox, tile )`.
+         * @param dest   Destination image
+         * @param offset Position of the destination within the view
+        */
+        Block_Tile_Rasterizer( const FillT&          fill,
+                               const DestT&          dest,
+                               const math::Vector2i& offset,
+                               size_t                planes )
+          : m_fill( fill ),
+            m_dest( dest ),
+            m_offset( offset ),
+            m_planes( planes )
+        {}
+
+        /**
+         * Compute and copy one tile
+        */
+        void operator()( const math::Rect2i& bbox ) const
+            requires std::is_invocable_v<const FillT&,const math::Rect2i&,const Image_Memory<PixelT>&>
+        {
+            process( bbox, [&]( const Image_Memory<PixelT>& tile ){ m_fill( bbox, tile ); } );
+        }
+
+        /**
+         * Compute and copy one tile, given its input region from the processor's halo
+        */
+        void operator()( const math::Rect2i& bbox,
+                         const math::Rect2i& halo_bbox ) const
+            requires std::is_invocable_v<const FillT&,const math::Rect2i&,const math::Rect2i&,const Image_Memory<PixelT>&>
+        {
+            process( bbox, [&]( const Image_Memory<PixelT>& tile ){ m_fill( bbox, halo_bbox, tile ); } );
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Block_Tile_Rasterizer";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + DestT::full_name() + ">";
+        }
+
+    private:
+
+        /**
+         * Allocate a tile, fill it, and copy it to the destination
+        */
+        template <typename TileFillT>
+        void process( const math::Rect2i& bbox,
+                      const TileFillT&    tile_fill ) const
+        {
+            Image_Memory<PixelT> tile( bbox.width(),
+                                       bbox.height(),
+                                       m_planes,
+                                       tile_memory_policy() );
+            tile_fill( tile );
+            tile.rasterize( crop_image( m_dest, bbox - m_offset ),
+                            math::Rect2i( 0, 0, bbox.width(), bbox.height() ) );
+        }
+
+        /// Tile computation
+        const FillT& m_fill;
+
+        /// Destination Image
+        const DestT& m_dest;
+
+        /// Offset of the destination within the view
+        math::Vector2i m_offset;
+
+        /// Planes per tile
+        size_t m_planes;
+
+}; // End of Block_Tile_Rasterizer Class
+
+/**
+ * Rasterize a region of a view in tiles, spread over threads.  Each tile is a pooled
+ * `Image_Memory` filled by `fill( tile_bbox, tile )`.  Runs on the calling thread
+ * when already inside a parallel rasterize.
+ * @param num_threads 0 uses the global `rasterize_parallel_settings()`
+*/
+template <typename PixelT,
+          typename DestT,
+          typename FillT>
+void rasterize_tiles( const DestT&        dest,
+                      const math::Rect2i& bbox,
+                      size_t              planes,
+                      const math::Size2i& tile_size,
+                      size_t              num_threads,
+                      const FillT&        fill )
+{
+    size_t threads = ops::rasterize_thread_count( num_threads );
+
+    typedef Block_Guarded_Functor<Block_Tile_Rasterizer<PixelT,DestT,FillT>> Tile_Func;
+    Tile_Func rasterizer( Block_Tile_Rasterizer<PixelT,DestT,FillT>( fill, dest, bbox.min(), planes ) );
+    Block_Processor<Tile_Func> process( rasterizer, tile_size, threads );
+    process( bbox );
+    rasterizer.rethrow();
+}
+
+/**
+ * Rasterize a neighborhood operation in tiles.  Each tile is filled by
+ * `fill( tile_bbox, halo_bbox, tile )`, where `halo_bbox` is the tile grown by the
+ * halo, so the fill can read its whole input at once.  The halo bbox is not clipped
+ * to the image, which leaves edge handling to the fill.
+ * @param num_threads 0 uses the global `rasterize_parallel_settings()`
+*/
+template <typename PixelT,
+          typename DestT,
+          typename FillT>
+void rasterize_tiles( const DestT&        dest,
+                      const math::Rect2i& bbox,
+                      size_t              planes,
+                      const math::Size2i& tile_size,
+                      size_t              num_threads,
+                      const Halo&         halo,
+                      const FillT&        fill )
+{
+    size_t threads = ops::rasterize_thread_count( num_threads );
+
+    typedef Block_Guarded_Functor<Block_Tile_Rasterizer<PixelT,DestT,FillT>> Tile_Func;
+    Tile_Func rasterizer( Block_Tile_Rasterizer<PixelT,DestT,FillT>( fill, dest, bbox.min(), planes ) );
+    Block_Processor<Tile_Func> process( rasterizer, tile_size, halo, std::nullopt, threads );
+    process( bbox );
+    rasterizer.rethrow();
+}
+
+} // End of tmns::image::ops::block namespace
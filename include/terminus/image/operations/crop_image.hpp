@@ -19,6 +19,7 @@
 
 // Terminus Libraries
 #include "../types/Image_Traits.hpp"
+#include "block/Block_Halo.hpp"
 #include "rasterize.hpp"
 
 namespace tmns::image {
@@ -160,6 +161,14 @@ class Crop_View : public Image_Base<Crop_View<ImageT>>
             return m_child;
         }
 
+        /**
+         * Input pixels needed around an output region
+         */
+        block::Halo halo() const
+        {
+            return block::image_halo( m_child );
+        }
+
         // Pre-Rasterize
         typedef Crop_View<typename ImageT::prerasterize_type> prerasterize_type;
         prerasterize_type prerasterize( const math::Rect2i& bbox ) const
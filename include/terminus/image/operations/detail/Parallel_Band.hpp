@@ -0,0 +1,22 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Parallel_Band.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+namespace tmns::image::ops::detail {
+
+/// Set while a thread evaluates a band, so nested rasterize and convert calls stay serial
+inline thread_local bool g_rasterize_in_band { false };
+
+} // End of tmns::image::ops::detail namespace
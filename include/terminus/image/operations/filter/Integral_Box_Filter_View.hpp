@@ -0,0 +1,284 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Integral_Box_Filter_View.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "../../pixel/Pixel_Accessor_Loose.hpp"
+#include "../../types/Compound_Utilities.hpp"
+#include "../../types/Image_Base.hpp"
+#include "../rasterize.hpp"
+#include "../transform/Interpolation.hpp"
+#include "Integral_Image.hpp"
+
+// Terminus Libraries
+#include <terminus/math/Size.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace tmns::image {
+namespace ops {
+
+/**
+ * Statistic computed over each window
+*/
+enum class Box_Statistic
+{
+    SUM      = 0 /**< Sum of the window */,
+    MEAN     = 1 /**< Mean of the window */,
+    VARIANCE = 2 /**< Population variance of the window.  Needs the sum-of-squares table. */,
+}; // End of Box_Statistic enum
+
+/**
+ * Window statistics from a summed-area table, in constant time per pixel regardless
+ * of the window size.  Windows are placed like `Kernel_1D::box()`, with even sizes
+ * reaching one further before the pixel than after it.
+ *
+ * Windows are clipped to the image, so statistics near the edges cover only the
+ * pixels inside it, unlike `box_blur()` which repeats the edge pixels.
+ *
+ * The table is shared and read-only, so any number of views over it can be
+ * rasterized in parallel.
+*/
+template <typename IntegralT,
+          typename ResultT = typename IntegralT::pixel_type>
+class Integral_Box_Filter_View : public Image_Base<Integral_Box_Filter_View<IntegralT,ResultT>>
+{
+    public:
+
+        /// Pixel Type
+        typedef ResultT pixel_type;
+
+        /// Type returned from pixel operators
+        typedef pixel_type result_type;
+
+        /// Pixel Access Type
+        typedef Pixel_Accessor_Loose<Integral_Box_Filter_View> pixel_accessor;
+
+        /// Output Channel Type
+        typedef typename math::Compound_Channel_Type<pixel_type>::type channel_type;
+
+        /// Channels per pixel
+        static constexpr size_t CHANNELS = math::Compound_Channel_Count<pixel_type>::value;
+
+        static_assert( CHANNELS == IntegralT::CHANNELS,
+                       "Integral_Box_Filter_View result must have the source's channels" );
+
+        /**
+         * Constructor
+         * @param integral  Summed-area table of the source
+         * @param window    Window size
+         * @param statistic Statistic to compute
+         * @throws std::runtime_error if the window is empty, or a variance is asked of a
+         *         table without squares
+        */
+        Integral_Box_Filter_View( std::shared_ptr<const IntegralT> integral,
+                                  const math::Size2i&              window,
+                                  Box_Statistic                    statistic = Box_Statistic::MEAN )
+          : m_integral( std::move( integral ) ),
+            m_window( window ),
+            m_statistic( statistic )
+        {
+            if( !m_integral )
+            {
+                throw std::runtime_error( "Integral_Box_Filter_View: No integral image." );
+            }
+            if( m_window.width() <= 0 || m_window.height() <= 0 )
+            {
+                std::stringstream sout;
+                sout << "Integral_Box_Filter_View: Window must be positive. Given: "
+                     << m_window.width() << " x " << m_window.height();
+                throw std::runtime_error( sout.str() );
+            }
+            if( m_statistic == Box_Statistic::VARIANCE && !m_integral->has_squares() )
+            {
+                throw std::runtime_error( "Integral_Box_Filter_View: Variance needs an integral image built with squares." );
+            }
+        }
+
+        /**
+         * Number of image columns
+         */
+        size_t cols() const { return m_integral->cols(); }
+
+        /**
+         * Number of image rows
+         */
+        size_t rows() const { return m_integral->rows(); }
+
+        /**
+         * Number of image planes
+         */
+        size_t planes() const { return m_integral->planes(); }
+
+        /**
+         * Get the origin
+        */
+        pixel_accessor origin() const
+        {
+            return pixel_accessor( *this, 0, 0, 0 );
+        }
+
+        /**
+         * Compute the statistic over the window around a pixel
+         */
+        result_type operator()( size_t c,
+                                size_t r,
+                                size_t p = 0 ) const
+        {
+            math::Rect2i window( int( c ) - m_window.width()  / 2,
+                                 int( r ) - m_window.height() / 2,
+                                 m_window.width(),
+                                 m_window.height() );
+
+            result_type result = result_type();
+            for( size_t ch = 0; ch < CHANNELS; ++ch )
+            {
+                double value = 0;
+                switch( m_statistic )
+                {
+                    case Box_Statistic::SUM:
+                        value = double( m_integral->sum( window, p, ch ) );
+                        break;
+                    case Box_Statistic::MEAN:
+                        value = m_integral->mean( window, p, ch );
+                        break;
+                    case Box_Statistic::VARIANCE:
+                        value = m_integral->variance( window, p, ch );
+                        break;
+                }
+                compound_select_channel<channel_type&>( result, ch ) = detail::saturate_channel<channel_type>( value );
+            }
+            return result;
+        }
+
+        /**
+         * Get the summed-area table
+        */
+        const std::shared_ptr<const IntegralT>& integral() const { return m_integral; }
+
+        /**
+         * Get the window size
+        */
+        const math::Size2i& window() const { return m_window; }
+
+        /**
+         * Get the statistic
+        */
+        Box_Statistic statistic() const { return m_statistic; }
+
+        /// Every pixel is a lookup into the table, so nothing needs computing up front
+        typedef Integral_Box_Filter_View prerasterize_type;
+        prerasterize_type prerasterize( const math::Rect2i& bbox ) const
+        {
+            return *this;
+        }
+
+        template <class DestT>
+        void rasterize( const DestT&        dest,
+                        const math::Rect2i& bbox ) const
+        {
+            ops::rasterize( prerasterize( bbox ), dest, bbox );
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Integral_Box_Filter_View";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + IntegralT::full_name() + ">";
+        }
+
+    private:
+
+        /// Summed-area table
+        std::shared_ptr<const IntegralT> m_integral;
+
+        /// Window size
+        math::Size2i m_window;
+
+        /// Statistic to compute
+        Box_Statistic m_statistic;
+
+}; // End of Integral_Box_Filter_View Class
+
+} // End of ops namespace
+
+/**
+ * Box filter (window mean) over an existing summed-area table
+*/
+template <typename IntegralT>
+ops::Integral_Box_Filter_View<std::remove_const_t<IntegralT>>
+    integral_box_filter( const std::shared_ptr<IntegralT>& integral,
+                         const math::Size2i&               window )
+{
+    return ops::Integral_Box_Filter_View<std::remove_const_t<IntegralT>>( integral,
+                                                                          window,
+                                                                          ops::Box_Statistic::MEAN );
+}
+
+/**
+ * Box filter (window mean) in constant time per pixel.  Builds the summed-area table
+ * up front; reuse one table through the other overload for several window sizes.
+ * @param size Window width and height
+*/
+template <typename ImageT>
+ops::Integral_Box_Filter_View<ops::Integral_Image<typename ImageT::pixel_type>>
+    integral_box_filter( const Image_Base<ImageT>& image,
+                         int                       size )
+{
+    return integral_box_filter( integral_image( image ),
+                                math::Size2i( { size, size } ) );
+}
+
+/**
+ * Window variance over an existing summed-area table built with squares.  Channels
+ * are returned as double.
+*/
+template <typename IntegralT>
+ops::Integral_Box_Filter_View<std::remove_const_t<IntegralT>,
+                              typename math::Compound_Channel_Cast<typename IntegralT::pixel_type,double>::type>
+    integral_variance_filter( const std::shared_ptr<IntegralT>& integral,
+                              const math::Size2i&               window )
+{
+    typedef typename math::Compound_Channel_Cast<typename IntegralT::pixel_type,double>::type Result_T;
+    return ops::Integral_Box_Filter_View<std::remove_const_t<IntegralT>,Result_T>( integral,
+                                                                                  window,
+                                                                                  ops::Box_Statistic::VARIANCE );
+}
+
+/**
+ * Window variance in constant time per pixel.  Channels are returned as double.
+ * @param size Window width and height
+*/
+template <typename ImageT>
+auto integral_variance_filter( const Image_Base<ImageT>& image,
+                               int                       size )
+{
+    return integral_variance_filter( integral_image( image, true ),
+                                     math::Size2i( { size, size } ) );
+}
+
+} // End of tmns::image namespace
@@ -0,0 +1,544 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Integral_Image.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "../../types/Compound_Utilities.hpp"
+#include "../../types/Image_Base.hpp"
+#include "../../types/Image_Memory.hpp"
+#include "../../types/Image_Memory_Policy.hpp"
+#include "../block/Block_Guarded_Functor.hpp"
+#include "../block/Block_Processor.hpp"
+#include "../rasterize.hpp"
+
+// Terminus Libraries
+#include <terminus/math/Rectangle.hpp>
+#include <terminus/math/Size.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace tmns::image {
+namespace ops {
+namespace detail {
+
+/**
+ * Default accumulator for a pixel type.  Integer channels of 16 bits or fewer sum
+ * exactly in 64 bits, squares included.  Wider integers and floating-point channels
+ * use double, since squares of 32-bit values would overflow a 64-bit sum.
+*/
+template <typename PixelT>
+using Integral_Accum_Type = std::conditional_t<std::is_integral_v<typename math::Compound_Channel_Type<PixelT>::type> &&
+                                               sizeof( typename math::Compound_Channel_Type<PixelT>::type ) <= 2,
+                                               int64_t,
+                                               double>;
+
+} // End of detail namespace
+
+/**
+ * Summed-area table of an image.  Entry (c, r) holds the sum of every pixel above
+ * and to the left of (c, r), exclusive, per plane and channel, so the sum over any
+ * rectangle takes four lookups no matter its size.  An optional second table holds
+ * the sums of squares, for window variances.
+ *
+ * The table is built once, with a two-pass parallel scan: each thread rasterizes a
+ * band of rows and sums it on its own, then the band totals are carried down and
+ * added to every band below in a second parallel pass.  After that the image is
+ * read-only and safe to query from any number of threads.
+ *
+ * Tables hold (cols + 1) x (rows + 1) accumulators per plane and channel, 8 bytes
+ * each, so build them over the region of interest rather than a whole scene.  Channels
+ * wider than 16 bits accumulate in double by default, since their squares overflow
+ * 64-bit integers.
+*/
+template <typename PixelT,
+          typename AccumT = detail::Integral_Accum_Type<PixelT>>
+class Integral_Image
+{
+    public:
+
+        /// Pointer Type
+        typedef std::shared_ptr<Integral_Image> ptr_t;
+
+        /// Source Pixel Type
+        typedef PixelT pixel_type;
+
+        /// Source Channel Type
+        typedef typename math::Compound_Channel_Type<PixelT>::type channel_type;
+
+        /// Accumulator Type
+        typedef AccumT accum_type;
+
+        /// Channels per pixel
+        static constexpr size_t CHANNELS = math::Compound_Channel_Count<PixelT>::value;
+
+        /**
+         * Build the table from any view
+         * @param image        Source image
+         * @param with_squares Also build the sum-of-squares table
+         * @param num_threads  Threads for the scan.  0 uses the global `rasterize_parallel_settings()`.
+        */
+        template <typename ImageT>
+        Integral_Image( const Image_Base<ImageT>& image,
+                        bool                      with_squares = false,
+                        size_t                    num_threads  = 0 )
+          : m_cols( image.impl().cols() ),
+            m_rows( image.impl().rows() ),
+            m_planes( image.impl().planes() ),
+            m_with_squares( with_squares )
+        {
+            build( image.impl(), num_threads );
+        }
+
+        /**
+         * Number of source columns
+        */
+        size_t cols() const { return m_cols; }
+
+        /**
+         * Number of source rows
+        */
+        size_t rows() const { return m_rows; }
+
+        /**
+         * Number of source planes
+        */
+        size_t planes() const { return m_planes; }
+
+        /**
+         * Check if the sum-of-squares table was built
+        */
+        bool has_squares() const { return m_with_squares; }
+
+        /**
+         * Get a raw table entry: the sum of the pixels before column c and row r
+         * @param c Column, 0 through cols()
+         * @param r Row, 0 through rows()
+        */
+        accum_type table( size_t c,
+                          size_t r,
+                          size_t p  = 0,
+                          size_t ch = 0 ) const
+        {
+            return m_sums[index( c, r, p ) + ch];
+        }
+
+        /**
+         * Number of image pixels in a region.  Regions are clipped to the image.
+        */
+        size_t count( const math::Rect2i& bbox ) const
+        {
+            auto clipped = clip( bbox );
+            return size_t( clipped.width() ) * size_t( clipped.height() );
+        }
+
+        /**
+         * Sum of a channel over a region, clipped to the image
+        */
+        accum_type sum( const math::Rect2i& bbox,
+                        size_t              p  = 0,
+                        size_t              ch = 0 ) const
+        {
+            return box_sum( m_sums, clip( bbox ), p, ch );
+        }
+
+        /**
+         * Sum of the squares of a channel over a region, clipped to the image
+         * @throws std::runtime_error if the table was built without squares
+        */
+        accum_type sum_squares( const math::Rect2i& bbox,
+                                size_t              p  = 0,
+                                size_t              ch = 0 ) const
+        {
+            check_squares();
+            return box_sum( m_squares, clip( bbox ), p, ch );
+        }
+
+        /**
+         * Mean of a channel over the image pixels in a region.  0 for empty regions.
+        */
+        double mean( const math::Rect2i& bbox,
+                     size_t              p  = 0,
+                     size_t              ch = 0 ) const
+        {
+            auto clipped = clip( bbox );
+            double n = double( clipped.width() ) * double( clipped.height() );
+            return ( n > 0 ) ? double( box_sum( m_sums, clipped, p, ch ) ) / n : 0;
+        }
+
+        /**
+         * Population variance of a channel over the image pixels in a region.  0 for
+         * empty regions.
+         * @throws std::runtime_error if the table was built without squares
+        */
+        double variance( const math::Rect2i& bbox,
+                         size_t              p  = 0,
+                         size_t              ch = 0 ) const
+        {
+            check_squares();
+            auto clipped = clip( bbox );
+            double n = double( clipped.width() ) * double( clipped.height() );
+            if( n <= 0 )
+            {
+                return 0;
+            }
+            double mu = double( box_sum( m_sums, clipped, p, ch ) ) / n;
+            double sq = double( box_sum( m_squares, clipped, p, ch ) ) / n;
+            return std::max( sq - mu * mu, 0.0 );
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Integral_Image";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + math::Compound_Name<pixel_type>::name() + ">";
+        }
+
+    private:
+
+        /**
+         * Sums one band of rows on its own, with the rows above the band taken as zero
+        */
+        template <typename ImageT>
+        class Scan_Functor
+        {
+            public:
+
+                Scan_Functor( Integral_Image& integral,
+                              const ImageT&   image )
+                  : m_integral( integral ),
+                    m_image( image )
+                {}
+
+                void operator()( const math::Rect2i& bbox ) const
+                {
+                    m_integral.scan_band( m_image, bbox );
+                }
+
+                static std::string class_name()
+                {
+                    return "Scan_Functor";
+                }
+
+                static std::string full_name()
+                {
+                    return class_name() + "<" + ImageT::full_name() + ">";
+                }
+
+            private:
+
+                /// Table being built
+                Integral_Image& m_integral;
+
+                /// Source image
+                const ImageT& m_image;
+
+        }; // End of Scan_Functor Class
+
+        /**
+         * Adds the carried totals of the bands above to one band
+        */
+        class Carry_Functor
+        {
+            public:
+
+                Carry_Functor( Integral_Image&                      integral,
+                               const std::vector<accum_type>&       carries,
+                               int                                  band_rows )
+                  : m_integral( integral ),
+                    m_carries( carries ),
+                    m_band_rows( band_rows )
+                {}
+
+                void operator()( const math::Rect2i& bbox ) const
+                {
+                    m_integral.carry_band( m_carries, m_band_rows, bbox );
+                }
+
+                static std::string class_name()
+                {
+                    return "Carry_Functor";
+                }
+
+                static std::string full_name()
+                {
+                    return class_name();
+                }
+
+            private:
+
+                /// Table being built
+                Integral_Image& m_integral;
+
+                /// Totals above each band, both tables, per band
+                const std::vector<accum_type>& m_carries;
+
+                /// Rows per band
+                int m_band_rows;
+
+        }; // End of Carry_Functor Class
+
+        /**
+         * Run both passes of the scan
+        */
+        template <typename ImageT>
+        void build( const ImageT& image,
+                    size_t        num_threads )
+        {
+            const size_t table_size = m_planes * ( m_rows + 1 ) * row_stride();
+            m_sums.assign( table_size, accum_type( 0 ) );
+            if( m_with_squares )
+            {
+                m_squares.assign( table_size, accum_type( 0 ) );
+            }
+            if( m_rows == 0 || m_cols == 0 )
+            {
+                return;
+            }
+
+            size_t threads = std::min( ops::rasterize_thread_count( num_threads ), m_rows );
+
+            // One band per thread, so each carry covers as many rows as possible
+            const int band_rows = int( ( m_rows + threads - 1 ) / threads );
+            const math::Size2i band_size( { int( m_cols ), band_rows } );
+            const math::Rect2i full_bbox( 0, 0, m_cols, m_rows );
+
+            // Pass 1: sum each band on its own
+            typedef block::Block_Guarded_Functor<Scan_Functor<ImageT>> Scan_Func;
+            Scan_Func scan( Scan_Functor<ImageT>( *this, image ) );
+            block::Block_Processor<Scan_Func> scan_process( scan, band_size, threads );
+            scan_process( full_bbox );
+            scan.rethrow();
+
+            // Totals above each band, from the last row of every band before it
+            const size_t num_bands = ( m_rows + band_rows - 1 ) / band_rows;
+            const size_t band_width = m_planes * row_stride();
+            const size_t carry_width = band_width * ( m_with_squares ? 2 : 1 );
+            std::vector<accum_type> carries( num_bands * carry_width, accum_type( 0 ) );
+            for( size_t band = 1; band < num_bands; ++band )
+            {
+                const size_t last_row = band * band_rows;
+                accum_type*       carry = &carries[band * carry_width];
+                const accum_type* above = &carries[( band - 1 ) * carry_width];
+                for( size_t p = 0; p < m_planes; ++p )
+                {
+                    const accum_type* sums = &m_sums[index( 0, last_row, p )];
+                    for( size_t i = 0; i < row_stride(); ++i )
+                    {
+                        carry[p * row_stride() + i] = above[p * row_stride() + i] + sums[i];
+                    }
+                    if( m_with_squares )
+                    {
+                        const accum_type* squares = &m_squares[index( 0, last_row, p )];
+                        for( size_t i = 0; i < row_stride(); ++i )
+                        {
+                            carry[band_width + p * row_stride() + i] = above[band_width + p * row_stride() + i] + squares[i];
+                        }
+                    }
+                }
+            }
+
+            // Pass 2: add the totals to every band below the first
+            if( num_bands > 1 )
+            {
+                Carry_Functor add_carry( *this, carries, band_rows );
+                block::Block_Processor<Carry_Functor> carry_process( add_carry, band_size, threads );
+                carry_process( math::Rect2i( 0, band_rows, m_cols, m_rows - band_rows ) );
+            }
+        }
+
+        /**
+         * Rasterize one band of rows and sum it, treating the row above it as zero
+        */
+        template <typename ImageT>
+        void scan_band( const ImageT&       image,
+                        const math::Rect2i& bbox )
+        {
+            Image_Memory<pixel_type> band( bbox.width(),
+                                           bbox.height(),
+                                           m_planes,
+                                           tile_memory_policy() );
+            image.rasterize( band, bbox );
+
+            const size_t stride = row_stride();
+            accum_type running[CHANNELS];
+            accum_type running_sq[CHANNELS];
+            for( size_t p = 0; p < m_planes; ++p )
+            for( int j = 0; j < bbox.height(); ++j )
+            {
+                const size_t r   = bbox.min().y() + j + 1;
+                accum_type*  row = &m_sums[index( 0, r, p )];
+                accum_type*  sq  = m_with_squares ? &m_squares[index( 0, r, p )] : nullptr;
+                std::fill( running,    running    + CHANNELS, accum_type( 0 ) );
+                std::fill( running_sq, running_sq + CHANNELS, accum_type( 0 ) );
+
+                for( size_t c = 0; c < m_cols; ++c )
+                {
+                    const pixel_type& pixel = band( c, j, p );
+                    const size_t      out   = ( c + 1 ) * CHANNELS;
+                    for( size_t ch = 0; ch < CHANNELS; ++ch )
+                    {
+                        accum_type value = accum_type( compound_select_channel<const channel_type&>( pixel, ch ) );
+                        running[ch] += value;
+                        row[out + ch] = running[ch] + ( j > 0 ? row[out + ch - stride] : accum_type( 0 ) );
+                        if( sq )
+                        {
+                            running_sq[ch] += value * value;
+                            sq[out + ch] = running_sq[ch] + ( j > 0 ? sq[out + ch - stride] : accum_type( 0 ) );
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * Add the totals above a band to each of its rows
+        */
+        void carry_band( const std::vector<accum_type>& carries,
+                         int                            band_rows,
+                         const math::Rect2i&            bbox )
+        {
+            const size_t band        = bbox.min().y() / band_rows;
+            const size_t band_width  = m_planes * row_stride();
+            const size_t carry_width = band_width * ( m_with_squares ? 2 : 1 );
+            const accum_type* carry  = &carries[band * carry_width];
+
+            for( size_t p = 0; p < m_planes; ++p )
+            for( int j = 0; j < bbox.height(); ++j )
+            {
+                const size_t r   = bbox.min().y() + j + 1;
+                accum_type*  row = &m_sums[index( 0, r, p )];
+                for( size_t i = 0; i < row_stride(); ++i )
+                {
+                    row[i] += carry[p * row_stride() + i];
+                }
+                if( m_with_squares )
+                {
+                    accum_type* sq = &m_squares[index( 0, r, p )];
+                    for( size_t i = 0; i < row_stride(); ++i )
+                    {
+                        sq[i] += carry[band_width + p * row_stride() + i];
+                    }
+                }
+            }
+        }
+
+        /**
+         * Accumulators per table row
+        */
+        size_t row_stride() const
+        {
+            return ( m_cols + 1 ) * CHANNELS;
+        }
+
+        /**
+         * Offset of the first channel of a table entry
+        */
+        size_t index( size_t c,
+                      size_t r,
+                      size_t p ) const
+        {
+            return ( p * ( m_rows + 1 ) + r ) * row_stride() + c * CHANNELS;
+        }
+
+        /**
+         * Clip a region to the image
+        */
+        math::Rect2i clip( const math::Rect2i& bbox ) const
+        {
+            int x0 = std::clamp( bbox.min().x(), 0, int( m_cols ) );
+            int y0 = std::clamp( bbox.min().y(), 0, int( m_rows ) );
+            int x1 = std::clamp( bbox.min().x() + bbox.width(),  0, int( m_cols ) );
+            int y1 = std::clamp( bbox.min().y() + bbox.height(), 0, int( m_rows ) );
+            return math::Rect2i( x0, y0, std::max( x1 - x0, 0 ), std::max( y1 - y0, 0 ) );
+        }
+
+        /**
+         * Four-corner lookup over a clipped region
+        */
+        accum_type box_sum( const std::vector<accum_type>& table,
+                            const math::Rect2i&            bbox,
+                            size_t                         p,
+                            size_t                         ch ) const
+        {
+            const size_t x0 = bbox.min().x(), y0 = bbox.min().y();
+            const size_t x1 = x0 + bbox.width(), y1 = y0 + bbox.height();
+            return table[index( x1, y1, p ) + ch] - table[index( x0, y1, p ) + ch]
+                 - table[index( x1, y0, p ) + ch] + table[index( x0, y0, p ) + ch];
+        }
+
+        /**
+         * Make sure the sum-of-squares table exists
+        */
+        void check_squares() const
+        {
+            if( !m_with_squares )
+            {
+                throw std::runtime_error( "Integral_Image: Built without the sum-of-squares table." );
+            }
+        }
+
+        /// Source columns
+        size_t m_cols;
+
+        /// Source rows
+        size_t m_rows;
+
+        /// Source planes
+        size_t m_planes;
+
+        /// Whether the sum-of-squares table is built
+        bool m_with_squares;
+
+        /// Sums, (cols + 1) x (rows + 1) per plane, channels interleaved
+        std::vector<accum_type> m_sums;
+
+        /// Sums of squares, same layout.  Empty unless requested.
+        std::vector<accum_type> m_squares;
+
+}; // End of Integral_Image Class
+
+} // End of ops namespace
+
+/**
+ * Build the summed-area table of an image
+ * @param with_squares Also build the sum-of-squares table, for variances
+ * @param num_threads  Threads for the scan.  0 uses the global `rasterize_parallel_settings()`.
+*/
+template <typename ImageT>
+typename ops::Integral_Image<typename ImageT::pixel_type>::ptr_t
+    integral_image( const Image_Base<ImageT>& image,
+                    bool                      with_squares = false,
+                    size_t                    num_threads  = 0 )
+{
+    return std::make_shared<ops::Integral_Image<typename ImageT::pixel_type>>( image,
+                                                                              with_squares,
+                                                                              num_threads );
+}
+
+} // End of tmns::image namespace
@@ -0,0 +1,172 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Kernel_1D.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace tmns::image::ops {
+
+/**
+ * One axis of a separable filter.  Kernels are applied as a correlation, without
+ * flipping, so the output at x is
+ *
+ *   sum_i  weights[i] * input( x + i - origin )
+*/
+class Kernel_1D
+{
+    public:
+
+        /**
+         * Constructor
+         * @param weights Filter taps
+         * @param origin  Tap lined up with the output pixel
+         * @throws std::runtime_error if there are no taps or the origin is not one of them
+        */
+        Kernel_1D( std::vector<double> weights,
+                   int                 origin )
+          : m_weights( std::move( weights ) ),
+            m_origin( origin )
+        {
+            if( m_weights.empty() || m_origin < 0 || m_origin >= int( m_weights.size() ) )
+            {
+                std::stringstream sout;
+                sout << "Kernel_1D: Origin " << m_origin << " is outside the "
+                     << m_weights.size() << " kernel taps.";
+                throw std::runtime_error( sout.str() );
+            }
+        }
+
+        /**
+         * Constructor, centered on the middle tap
+        */
+        explicit Kernel_1D( std::vector<double> weights )
+          : Kernel_1D( weights, int( weights.size() ) / 2 )
+        {}
+
+        /**
+         * Number of taps
+        */
+        size_t size() const { return m_weights.size(); }
+
+        /**
+         * Tap lined up with the output pixel
+        */
+        int origin() const { return m_origin; }
+
+        /**
+         * Input pixels needed before each output pixel
+        */
+        int before() const { return m_origin; }
+
+        /**
+         * Input pixels needed after each output pixel
+        */
+        int after() const { return int( m_weights.size() ) - 1 - m_origin; }
+
+        /**
+         * Get the taps
+        */
+        const std::vector<double>& weights() const { return m_weights; }
+
+        /**
+         * Get a tap
+        */
+        double operator[]( size_t idx ) const { return m_weights[idx]; }
+
+        /**
+         * Pass-through kernel
+        */
+        static Kernel_1D identity()
+        {
+            return Kernel_1D( { 1 } );
+        }
+
+        /**
+         * Normalized Gaussian
+         * @param sigma  Standard deviation, in pixels
+         * @param radius Taps on each side of the center.  0 uses ceil(3 sigma).
+        */
+        static Kernel_1D gaussian( double sigma,
+                                   int    radius = 0 )
+        {
+            if( !( sigma > 0 ) )
+            {
+                throw std::runtime_error( "Kernel_1D: Gaussian sigma must be positive." );
+            }
+            if( radius <= 0 )
+            {
+                radius = std::max( int( std::ceil( 3 * sigma ) ), 1 );
+            }
+
+            std::vector<double> weights( 2 * radius + 1 );
+            double sum = 0;
+            for( int i = -radius; i <= radius; ++i )
+            {
+                weights[i + radius] = std::exp( -0.5 * i * i / ( sigma * sigma ) );
+                sum += weights[i + radius];
+            }
+            for( auto& w : weights )
+            {
+                w /= sum;
+            }
+            return Kernel_1D( std::move( weights ), radius );
+        }
+
+        /**
+         * Normalized box (moving average).  Even sizes extend one further before the
+         * center than after it.
+        */
+        static Kernel_1D box( int size )
+        {
+            if( size <= 0 )
+            {
+                throw std::runtime_error( "Kernel_1D: Box size must be positive." );
+            }
+            return Kernel_1D( std::vector<double>( size, 1.0 / size ), size / 2 );
+        }
+
+        /**
+         * Central difference (-1 0 1), the derivative half of a Sobel operator
+        */
+        static Kernel_1D sobel_derivative()
+        {
+            return Kernel_1D( { -1, 0, 1 } );
+        }
+
+        /**
+         * Binomial smoothing (1 2 1), the smoothing half of a Sobel operator
+        */
+        static Kernel_1D sobel_smoothing()
+        {
+            return Kernel_1D( { 1, 2, 1 } );
+        }
+
+    private:
+
+        /// Filter taps
+        std::vector<double> m_weights;
+
+        /// Tap lined up with the output pixel
+        int m_origin;
+
+}; // End of Kernel_1D Class
+
+} // End of tmns::image::ops namespace
@@ -0,0 +1,1133 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Morphology_View.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "../../pixel/Pixel_Accessor_Loose.hpp"
+#include "../../pixel/Pixel_Mask.hpp"
+#include "../../types/Compound_Utilities.hpp"
+#include "../../types/Image_Base.hpp"
+#include "../../types/Image_Memory.hpp"
+#include "../../types/Image_Memory_Policy.hpp"
+#include "../block/Block_Halo.hpp"
+#include "../block/Block_Tile_Rasterizer.hpp"
+#include "../crop_image.hpp"
+#include "../transform/Edge_Extension.hpp"
+
+// Terminus Libraries
+#include <terminus/math/Size.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tmns::image {
+namespace ops {
+
+/**
+ * Morphological operation
+*/
+enum class Morphology_Op
+{
+    ERODE   = 0 /**< Minimum over the structuring element */,
+    DILATE  = 1 /**< Maximum over the structuring element */,
+    OPENING = 2 /**< Erosion, then dilation.  Removes bright (foreground) specks. */,
+    CLOSING = 3 /**< Dilation, then erosion.  Fills dark (background) holes. */,
+}; // End of Morphology_Op enum
+
+namespace detail {
+
+/**
+ * Minimum, and the value which never wins it
+*/
+template <typename T>
+struct Morph_Min
+{
+    static T apply( const T& a, const T& b ) { return std::min( a, b ); }
+    static T identity() { return std::numeric_limits<T>::max(); }
+};
+
+/**
+ * Maximum, and the value which never wins it
+*/
+template <typename T>
+struct Morph_Max
+{
+    static T apply( const T& a, const T& b ) { return std::max( a, b ); }
+    static T identity() { return std::numeric_limits<T>::lowest(); }
+};
+
+/**
+ * Erosion of 64 binary pixels at once
+*/
+struct Morph_And
+{
+    static uint64_t apply( uint64_t a, uint64_t b ) { return a & b; }
+    static uint64_t identity() { return ~uint64_t( 0 ); }
+};
+
+/**
+ * Dilation of 64 binary pixels at once
+*/
+struct Morph_Or
+{
+    static uint64_t apply( uint64_t a, uint64_t b ) { return a | b; }
+    static uint64_t identity() { return 0; }
+};
+
+/**
+ * One erosion or dilation with a rectangular structuring element.  The window for
+ * output pixel x covers x - before through x + after on each axis.
+*/
+struct Morphology_Stage
+{
+    /// Erosion if true, dilation otherwise
+    bool erode;
+
+    /// Window extents
+    int before_x, after_x, before_y, after_y;
+
+    /**
+     * Input pixels needed around the output
+    */
+    block::Halo halo() const
+    {
+        return block::Halo( before_x, before_y, after_x, after_y );
+    }
+
+    /**
+     * Region computed from an input region
+    */
+    math::Rect2i shrink( const math::Rect2i& area ) const
+    {
+        return math::Rect2i( area.min().x() + before_x,
+                             area.min().y() + before_y,
+                             area.width()  - before_x - after_x,
+                             area.height() - before_y - after_y );
+    }
+};
+
+/**
+ * Split an operation into its erosions and dilations.  Windows are placed like
+ * `Kernel_1D::box()`; dilations use the reflected window, so openings and closings
+ * are idempotent for even sizes as well.
+*/
+inline std::vector<Morphology_Stage> morphology_stages( Morphology_Op       op,
+                                                        const math::Size2i& size )
+{
+    if( size.width() <= 0 || size.height() <= 0 )
+    {
+        std::stringstream sout;
+        sout << "Morphology: Structuring element must be positive. Given: "
+             << size.width() << " x " << size.height();
+        throw std::runtime_error( sout.str() );
+    }
+
+    const int bx = size.width()  / 2, ax = size.width()  - 1 - bx;
+    const int by = size.height() / 2, ay = size.height() - 1 - by;
+    const Morphology_Stage erosion  { true,  bx, ax, by, ay };
+    const Morphology_Stage dilation { false, ax, bx, ay, by };
+    switch( op )
+    {
+        case Morphology_Op::ERODE:   return { erosion };
+        case Morphology_Op::DILATE:  return { dilation };
+        case Morphology_Op::OPENING: return { erosion, dilation };
+        case Morphology_Op::CLOSING: return { dilation, erosion };
+    }
+    return {};
+}
+
+/**
+ * Total halo of a list of stages
+*/
+inline block::Halo stages_halo( const std::vector<Morphology_Stage>& stages )
+{
+    block::Halo halo;
+    for( const auto& stage : stages )
+    {
+        halo = halo + stage.halo();
+    }
+    return halo;
+}
+
+/**
+ * van Herk / Gil-Werman running min or max over rows of `width` values.  Output row
+ * i combines input rows i through i + k - 1, in three operations per value no
+ * matter how large k is: the input is cut into blocks of k rows, each window spans
+ * the tail of one block and the head of the next, and running values from both
+ * ends of every block give the answer for each part.
+ *
+ * Horizontal passes call this with a width of 1.
+ * @param in  n_out + k - 1 rows
+ * @param out n_out rows
+*/
+template <typename OpT, typename T>
+void van_herk_rows( const T*        in,
+                    size_t          width,
+                    size_t          n_out,
+                    size_t          k,
+                    T*              out,
+                    std::vector<T>& prefix,
+                    std::vector<T>& suffix )
+{
+    if( k == 1 )
+    {
+        std::copy( in, in + n_out * width, out );
+        return;
+    }
+
+    const size_t n_in = n_out + k - 1;
+    prefix.resize( n_in * width );
+    suffix.resize( n_in * width );
+
+    // Running values from the start of each block
+    for( size_t j = 0; j < n_in; ++j )
+    {
+        T*       pre = &prefix[j * width];
+        const T* src = &in[j * width];
+        if( j % k == 0 )
+        {
+            std::copy( src, src + width, pre );
+            continue;
+        }
+        const T* last = pre - width;
+        for( size_t i = 0; i < width; ++i )
+        {
+            pre[i] = OpT::apply( last[i], src[i] );
+        }
+    }
+
+    // Running values from the end of each block
+    for( size_t j = n_in; j-- > 0; )
+    {
+        T*       suf = &suffix[j * width];
+        const T* src = &in[j * width];
+        if( j == n_in - 1 || ( j + 1 ) % k == 0 )
+        {
+            std::copy( src, src + width, suf );
+            continue;
+        }
+        const T* next = suf + width;
+        for( size_t i = 0; i < width; ++i )
+        {
+            suf[i] = OpT::apply( next[i], src[i] );
+        }
+    }
+
+    for( size_t j = 0; j < n_out; ++j )
+    {
+        const T* suf = &suffix[j * width];
+        const T* pre = &prefix[( j + k - 1 ) * width];
+        T*       dst = &out[j * width];
+        for( size_t i = 0; i < width; ++i )
+        {
+            dst[i] = OpT::apply( suf[i], pre[i] );
+        }
+    }
+}
+
+/**
+ * Combine each bit of a packed row with the bit `shift` places after it
+*/
+template <typename OpT>
+void combine_shifted_bits( uint64_t*              row,
+                           size_t                 words,
+                           size_t                 shift,
+                           std::vector<uint64_t>& scratch )
+{
+    scratch.assign( row, row + words );
+    const size_t q = shift / 64, b = shift % 64;
+    for( size_t w = 0; w < words; ++w )
+    {
+        uint64_t src = ( w + q < words ) ? ( scratch[w + q] >> b ) : 0;
+        if( b != 0 && w + q + 1 < words )
+        {
+            src |= scratch[w + q + 1] << ( 64 - b );
+        }
+        row[w] = OpT::apply( row[w], src );
+    }
+}
+
+/**
+ * Running AND or OR along a packed row, so bit i covers bits i through i + k - 1.
+ * Windows double in size each step, so a row takes log2(k) passes of 64 pixels
+ * per operation.
+*/
+template <typename OpT>
+void bit_row_window( uint64_t*              row,
+                     size_t                 words,
+                     size_t                 k,
+                     std::vector<uint64_t>& scratch )
+{
+    size_t span = 1;
+    while( span * 2 <= k )
+    {
+        combine_shifted_bits<OpT>( row, words, span, scratch );
+        span *= 2;
+    }
+    if( span < k )
+    {
+        combine_shifted_bits<OpT>( row, words, k - span, scratch );
+    }
+}
+
+/**
+ * Set bits [begin, end) of a packed row
+*/
+inline void fill_bits( uint64_t* row,
+                       size_t    begin,
+                       size_t    end,
+                       bool      value )
+{
+    for( size_t i = begin; i < end; ++i )
+    {
+        if( value )
+        {
+            row[i / 64] |= uint64_t( 1 ) << ( i % 64 );
+        }
+        else
+        {
+            row[i / 64] &= ~( uint64_t( 1 ) << ( i % 64 ) );
+        }
+    }
+}
+
+/**
+ * Columns of `area` which are inside the image, relative to the area
+*/
+inline std::pair<int,int> inside_columns( const math::Rect2i& area,
+                                          int                 cols )
+{
+    int begin = std::clamp( -area.min().x(), 0, area.width() );
+    int end   = std::clamp( cols - area.min().x(), begin, area.width() );
+    return { begin, end };
+}
+
+template <typename PixelT>
+struct Is_Pixel_Mask : std::false_type {};
+
+template <typename PixelT>
+struct Is_Pixel_Mask<Pixel_Mask<PixelT>> : std::true_type {};
+
+/**
+ * Pixels of binary morphology.  Masked pixels keep their values and only change
+ * validity; anything else becomes a 0 / 1 byte.
+*/
+template <typename PixelT>
+using Binary_Morphology_Pixel = std::conditional_t<Is_Pixel_Mask<PixelT>::value,PixelT,uint8_t>;
+
+/**
+ * Check if a pixel is foreground for binary morphology: valid for masked pixels,
+ * non-zero otherwise
+*/
+template <typename PixelT>
+bool is_foreground( const PixelT& pixel )
+{
+    if constexpr( Is_Pixel_Mask<PixelT>::value )
+    {
+        return is_valid( pixel );
+    }
+    else
+    {
+        return pixel != PixelT();
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * Grayscale erosion, dilation, opening and closing with a rectangular structuring
+ * element.  Each channel is filtered on its own.  Pixels outside the image are
+ * ignored, so erosion does not eat in from the borders.
+ *
+ * The element is separable, so each axis is a 1D running min or max computed with
+ * the van Herk / Gil-Werman algorithm: three comparisons per pixel no matter the
+ * element size.  Work is done in tiles, each reading the child over the tile plus
+ * the halo once, and `prerasterize()` fetches the child over the whole region plus
+ * halo once, like `Separable_Convolution_View`.
+*/
+template <typename ImageT>
+class Morphology_View : public Image_Base<Morphology_View<ImageT>>
+{
+    public:
+
+        /// Pixel Type
+        typedef typename ImageT::pixel_type pixel_type;
+
+        /// Type returned from pixel operators
+        typedef pixel_type result_type;
+
+        /// Pixel Access Type
+        typedef Pixel_Accessor_Loose<Morphology_View> pixel_accessor;
+
+        /// Channel Type
+        typedef typename math::Compound_Channel_Type<pixel_type>::type channel_type;
+
+        /// Channels per pixel
+        static constexpr size_t CHANNELS = math::Compound_Channel_Count<pixel_type>::value;
+
+        /**
+         * Constructor
+         * @param image       Source image
+         * @param op          Operation
+         * @param size        Structuring element size
+         * @param tile_size   Size of the tiles computed at once
+         * @param num_threads Threads for rasterizing.  0 uses the global `rasterize_parallel_settings()`.
+         * @throws std::runtime_error if the structuring element is empty
+        */
+        Morphology_View( const ImageT&       image,
+                         Morphology_Op       op,
+                         const math::Size2i& size,
+                         const math::Size2i& tile_size   = math::Size2i( { 256, 256 } ),
+                         size_t              num_threads = 0 )
+          : m_image( image ),
+            m_op( op ),
+            m_size( size ),
+            m_stages( detail::morphology_stages( op, size ) ),
+            m_tile_size( tile_size ),
+            m_num_threads( num_threads )
+        {}
+
+        /**
+         * Number of image columns
+         */
+        size_t cols() const { return m_image.cols(); }
+
+        /**
+         * Number of image rows
+         */
+        size_t rows() const { return m_image.rows(); }
+
+        /**
+         * Number of image planes
+         */
+        size_t planes() const { return m_image.planes(); }
+
+        /**
+         * Get the origin
+        */
+        pixel_accessor origin() const
+        {
+            return pixel_accessor( *this, 0, 0, 0 );
+        }
+
+        /**
+         * Filter a single pixel.  Reads the whole element footprint; use rasterize()
+         * for anything bigger.
+         */
+        result_type operator()( size_t c,
+                                size_t r,
+                                size_t p = 0 ) const
+        {
+            math::Rect2i bbox( c, r, 1, 1 );
+            Image_Memory<pixel_type> tile( 1, 1, planes() );
+            filter_tile( bbox, morph_halo().expand( bbox ), tile );
+            return tile( 0, 0, p );
+        }
+
+        /**
+         * Get the child image
+        */
+        const ImageT& child() const { return m_image; }
+
+        /**
+         * Get the operation
+        */
+        Morphology_Op op() const { return m_op; }
+
+        /**
+         * Get the structuring element size
+        */
+        const math::Size2i& size() const { return m_size; }
+
+        /**
+         * Input pixels needed around an output region, including the child's
+        */
+        block::Halo halo() const
+        {
+            return morph_halo() + block::image_halo( m_image );
+        }
+
+        typedef Crop_View<Image_Memory<pixel_type>> prerasterize_type;
+        prerasterize_type prerasterize( const math::Rect2i& bbox ) const
+        {
+            // Init output data
+            Image_Memory<pixel_type> buffer( bbox.width(),
+                                             bbox.height(),
+                                             planes() );
+
+            // Fetch the child over the halo once, then filter the tiles from that copy
+            auto region = clip( morph_halo().expand( bbox ) );
+            typedef typename ImageT::prerasterize_type Source_T;
+            Morphology_View<Source_T> local( m_image.prerasterize( region ),
+                                             m_op,
+                                             m_size,
+                                             m_tile_size,
+                                             m_num_threads );
+            local.rasterize( buffer, bbox );
+
+            // "Fake" the bbox image so it looks like a full size image.
+            return Crop_View<Image_Memory<pixel_type>>( buffer,
+                                                        math::Rect2i( -bbox.min().x(),
+                                                                      -bbox.min().y(),
+                                                                      cols(),
+                                                                      rows() ) );
+        }
+
+        template <class DestT>
+        void rasterize( const DestT&        dest,
+                        const math::Rect2i& bbox ) const
+        {
+            auto fill = [this]( const math::Rect2i&             tile_bbox,
+                                const math::Rect2i&             needed,
+                                const Image_Memory<pixel_type>& tile )
+            {
+                filter_tile( tile_bbox, needed, tile );
+            };
+            block::rasterize_tiles<pixel_type>( dest,
+                                                bbox,
+                                                planes(),
+                                                m_tile_size,
+                                                m_num_threads,
+                                                morph_halo(),
+                                                fill );
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Morphology_View";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + ImageT::full_name() + ">";
+        }
+
+    private:
+
+        /**
+         * Pixels the structuring elements reach around each output pixel
+        */
+        block::Halo morph_halo() const
+        {
+            return detail::stages_halo( m_stages );
+        }
+
+        /**
+         * Clip a region to the image
+        */
+        math::Rect2i clip( const math::Rect2i& bbox ) const
+        {
+            return detail::clip_region( bbox, cols(), rows() );
+        }
+
+        /**
+         * Set the values of `area` outside the image to a stage's identity, so they
+         * never win its min or max
+        */
+        void mask_outside( std::vector<channel_type>& buffer,
+                           const math::Rect2i&        area,
+                           channel_type               identity ) const
+        {
+            auto [begin, end] = detail::inside_columns( area, cols() );
+            for( int j = 0; j < area.height(); ++j )
+            {
+                channel_type* row = &buffer[j * area.width()];
+                int y = area.min().y() + j;
+                if( y < 0 || y >= int( rows() ) )
+                {
+                    std::fill( row, row + area.width(), identity );
+                    continue;
+                }
+                std::fill( row, row + begin, identity );
+                std::fill( row + end, row + area.width(), identity );
+            }
+        }
+
+        /**
+         * Run one erosion or dilation over `buffer`, which covers `area`
+        */
+        template <typename OpT>
+        void run_stage( const detail::Morphology_Stage& stage,
+                        std::vector<channel_type>&      buffer,
+                        math::Rect2i&                   area ) const
+        {
+            const auto   out_area = stage.shrink( area );
+            const size_t kx = stage.before_x + stage.after_x + 1;
+            const size_t ky = stage.before_y + stage.after_y + 1;
+
+            // Horizontal pass, row by row
+            std::vector<channel_type> horizontal( size_t( area.height() ) * out_area.width() );
+            for( int j = 0; j < area.height(); ++j )
+            {
+                detail::van_herk_rows<OpT>( &buffer[j * area.width()],
+                                            1,
+                                            out_area.width(),
+                                            kx,
+                                            &horizontal[j * out_area.width()],
+                                            m_prefix,
+                                            m_suffix );
+            }
+
+            // Vertical pass over whole rows
+            buffer.resize( size_t( out_area.height() ) * out_area.width() );
+            detail::van_herk_rows<OpT>( horizontal.data(),
+                                        out_area.width(),
+                                        out_area.height(),
+                                        ky,
+                                        buffer.data(),
+                                        m_prefix,
+                                        m_suffix );
+            area = out_area;
+        }
+
+        /**
+         * Compute the pixels of bbox into the tile
+         * @param needed Tile plus the halo
+        */
+        void filter_tile( const math::Rect2i&             bbox,
+                          const math::Rect2i&             needed,
+                          const Image_Memory<pixel_type>& tile ) const
+        {
+            auto region = clip( needed );
+            Image_Memory<pixel_type> source( std::max( region.width(),  1 ),
+                                             std::max( region.height(), 1 ),
+                                             planes(),
+                                             tile_memory_policy() );
+            if( region.width() > 0 && region.height() > 0 )
+            {
+                m_image.rasterize( source, region );
+            }
+
+            std::vector<channel_type> buffer;
+            for( size_t p = 0; p < planes(); ++p )
+            for( size_t ch = 0; ch < CHANNELS; ++ch )
+            {
+                // Unpack one channel of the halo region
+                math::Rect2i area = needed;
+                buffer.assign( size_t( area.width() ) * area.height(), channel_type() );
+                for( int j = 0; j < region.height(); ++j )
+                for( int i = 0; i < region.width(); ++i )
+                {
+                    int x = region.min().x() + i - area.min().x();
+                    int y = region.min().y() + j - area.min().y();
+                    buffer[y * area.width() + x] = compound_select_channel<const channel_type&>( source( i, j, p ), ch );
+                }
+
+                for( const auto& stage : m_stages )
+                {
+                    if( stage.erode )
+                    {
+                        mask_outside( buffer, area, detail::Morph_Min<channel_type>::identity() );
+                        run_stage<detail::Morph_Min<channel_type>>( stage, buffer, area );
+                    }
+                    else
+                    {
+                        mask_outside( buffer, area, detail::Morph_Max<channel_type>::identity() );
+                        run_stage<detail::Morph_Max<channel_type>>( stage, buffer, area );
+                    }
+                }
+
+                for( int r = 0; r < bbox.height(); ++r )
+                for( int c = 0; c < bbox.width(); ++c )
+                {
+                    compound_select_channel<channel_type&>( tile( c, r, p ), ch ) = buffer[r * bbox.width() + c];
+                }
+            }
+        }
+
+        /// Source image
+        ImageT m_image;
+
+        /// Operation
+        Morphology_Op m_op;
+
+        /// Structuring element size
+        math::Size2i m_size;
+
+        /// Erosions and dilations to run
+        std::vector<detail::Morphology_Stage> m_stages;
+
+        /// Tile size
+        math::Size2i m_tile_size;
+
+        /// Threads for rasterizing
+        size_t m_num_threads;
+
+        /// Scratch for the running values.  Per thread, since tiles run in parallel.
+        static thread_local inline std::vector<channel_type> m_prefix;
+        static thread_local inline std::vector<channel_type> m_suffix;
+
+}; // End of Morphology_View Class
+
+/**
+ * Binary erosion, dilation, opening and closing with a rectangular structuring
+ * element, 64 pixels per operation.  Foreground is every valid pixel of a
+ * `Pixel_Mask` image, and every non-zero pixel of anything else (cloud and
+ * classification masks).  Masked images keep their values and only have their
+ * validity changed; other images become 0 / 1 bytes.
+ *
+ * Rows are packed into 64-bit words.  The vertical pass is the van Herk / Gil-Werman
+ * running AND / OR over whole words, and the horizontal pass combines shifted copies
+ * of each row with windows doubling in size.  Pixels outside the image are ignored,
+ * so erosion does not eat in from the borders.
+*/
+template <typename ImageT>
+class Binary_Morphology_View : public Image_Base<Binary_Morphology_View<ImageT>>
+{
+    public:
+
+        /// Source Pixel Type
+        typedef typename ImageT::pixel_type source_type;
+
+        /// Pixel Type
+        typedef detail::Binary_Morphology_Pixel<source_type> pixel_type;
+
+        /// Type returned from pixel operators
+        typedef pixel_type result_type;
+
+        /// Pixel Access Type
+        typedef Pixel_Accessor_Loose<Binary_Morphology_View> pixel_accessor;
+
+        /**
+         * Constructor
+         * @param image       Source image
+         * @param op          Operation
+         * @param size        Structuring element size
+         * @param tile_size   Size of the tiles computed at once
+         * @param num_threads Threads for rasterizing.  0 uses the global `rasterize_parallel_settings()`.
+         * @throws std::runtime_error if the structuring element is empty
+        */
+        Binary_Morphology_View( const ImageT&       image,
+                                Morphology_Op       op,
+                                const math::Size2i& size,
+                                const math::Size2i& tile_size   = math::Size2i( { 256, 256 } ),
+                                size_t              num_threads = 0 )
+          : m_image( image ),
+            m_op( op ),
+            m_size( size ),
+            m_stages( detail::morphology_stages( op, size ) ),
+            m_tile_size( tile_size ),
+            m_num_threads( num_threads )
+        {}
+
+        /**
+         * Number of image columns
+         */
+        size_t cols() const { return m_image.cols(); }
+
+        /**
+         * Number of image rows
+         */
+        size_t rows() const { return m_image.rows(); }
+
+        /**
+         * Number of image planes
+         */
+        size_t planes() const { return m_image.planes(); }
+
+        /**
+         * Get the origin
+        */
+        pixel_accessor origin() const
+        {
+            return pixel_accessor( *this, 0, 0, 0 );
+        }
+
+        /**
+         * Filter a single pixel.  Reads the whole element footprint; use rasterize()
+         * for anything bigger.
+         */
+        result_type operator()( size_t c,
+                                size_t r,
+                                size_t p = 0 ) const
+        {
+            math::Rect2i bbox( c, r, 1, 1 );
+            Image_Memory<pixel_type> tile( 1, 1, planes() );
+            filter_tile( bbox, morph_halo().expand( bbox ), tile );
+            return tile( 0, 0, p );
+        }
+
+        /**
+         * Get the child image
+        */
+        const ImageT& child() const { return m_image; }
+
+        /**
+         * Get the operation
+        */
+        Morphology_Op op() const { return m_op; }
+
+        /**
+         * Get the structuring element size
+        */
+        const math::Size2i& size() const { return m_size; }
+
+        /**
+         * Input pixels needed around an output region, including the child's
+        */
+        block::Halo halo() const
+        {
+            return morph_halo() + block::image_halo( m_image );
+        }
+
+        typedef Crop_View<Image_Memory<pixel_type>> prerasterize_type;
+        prerasterize_type prerasterize( const math::Rect2i& bbox ) const
+        {
+            // Init output data
+            Image_Memory<pixel_type> buffer( bbox.width(),
+                                             bbox.height(),
+                                             planes() );
+
+            // Fetch the child over the halo once, then filter the tiles from that copy
+            auto region = detail::clip_region( morph_halo().expand( bbox ), cols(), rows() );
+            typedef typename ImageT::prerasterize_type Source_T;
+            Binary_Morphology_View<Source_T> local( m_image.prerasterize( region ),
+                                                   m_op,
+                                                   m_size,
+                                                   m_tile_size,
+                                                   m_num_threads );
+            local.rasterize( buffer, bbox );
+
+            // "Fake" the bbox image so it looks like a full size image.
+            return Crop_View<Image_Memory<pixel_type>>( buffer,
+                                                        math::Rect2i( -bbox.min().x(),
+                                                                      -bbox.min().y(),
+                                                                      cols(),
+                                                                      rows() ) );
+        }
+
+        template <class DestT>
+        void rasterize( const DestT&        dest,
+                        const math::Rect2i& bbox ) const
+        {
+            auto fill = [this]( const math::Rect2i&             tile_bbox,
+                                const math::Rect2i&             needed,
+                                const Image_Memory<pixel_type>& tile )
+            {
+                filter_tile( tile_bbox, needed, tile );
+            };
+            block::rasterize_tiles<pixel_type>( dest,
+                                                bbox,
+                                                planes(),
+                                                m_tile_size,
+                                                m_num_threads,
+                                                morph_halo(),
+                                                fill );
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Binary_Morphology_View";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + ImageT::full_name() + ">";
+        }
+
+    private:
+
+        /**
+         * Pixels the structuring elements reach around each output pixel
+        */
+        block::Halo morph_halo() const
+        {
+            return detail::stages_halo( m_stages );
+        }
+
+        /**
+         * Set the bits of `area` outside the image to a stage's identity
+        */
+        void mask_outside( std::vector<uint64_t>& bits,
+                           size_t                 words,
+                           const math::Rect2i&    area,
+                           bool                   identity ) const
+        {
+            auto [begin, end] = detail::inside_columns( area, cols() );
+            for( int j = 0; j < area.height(); ++j )
+            {
+                uint64_t* row = &bits[j * words];
+                int y = area.min().y() + j;
+                if( y < 0 || y >= int( rows() ) )
+                {
+                    std::fill( row, row + words, identity ? ~uint64_t( 0 ) : uint64_t( 0 ) );
+                    continue;
+                }
+                detail::fill_bits( row, 0, begin, identity );
+                detail::fill_bits( row, end, area.width(), identity );
+            }
+        }
+
+        /**
+         * Run one erosion or dilation over packed rows covering `area`
+        */
+        template <typename OpT>
+        void run_stage( const detail::Morphology_Stage& stage,
+                        std::vector<uint64_t>&          bits,
+                        size_t                          words,
+                        math::Rect2i&                   area ) const
+        {
+            const auto   out_area = stage.shrink( area );
+            const size_t kx = stage.before_x + stage.after_x + 1;
+            const size_t ky = stage.before_y + stage.after_y + 1;
+
+            // Horizontal pass in place.  Bit i of each row now covers the window
+            // starting at column i, which is output column i.
+            for( int j = 0; j < area.height(); ++j )
+            {
+                detail::bit_row_window<OpT>( &bits[j * words], words, kx, m_scratch );
+            }
+
+            // Vertical pass over whole words
+            std::vector<uint64_t> vertical( size_t( out_area.height() ) * words );
+            detail::van_herk_rows<OpT>( bits.data(),
+                                        words,
+                                        out_area.height(),
+                                        ky,
+                                        vertical.data(),
+                                        m_prefix,
+                                        m_suffix );
+            bits.swap( vertical );
+            area = out_area;
+        }
+
+        /**
+         * Compute the pixels of bbox into the tile
+         * @param needed Tile plus the halo
+        */
+        void filter_tile( const math::Rect2i&             bbox,
+                          const math::Rect2i&             needed,
+                          const Image_Memory<pixel_type>& tile ) const
+        {
+            auto region = detail::clip_region( needed, cols(), rows() );
+            Image_Memory<source_type> source( std::max( region.width(),  1 ),
+                                              std::max( region.height(), 1 ),
+                                              planes(),
+                                              tile_memory_policy() );
+            if( region.width() > 0 && region.height() > 0 )
+            {
+                m_image.rasterize( source, region );
+            }
+
+            // Rows keep their word count through every stage, only the used width shrinks
+            const size_t words = ( size_t( needed.width() ) + 63 ) / 64;
+            std::vector<uint64_t> bits;
+            for( size_t p = 0; p < planes(); ++p )
+            {
+                // Pack the foreground of the halo region
+                math::Rect2i area = needed;
+                bits.assign( size_t( area.height() ) * words, 0 );
+                for( int j = 0; j < region.height(); ++j )
+                {
+                    uint64_t* row = &bits[( region.min().y() + j - area.min().y() ) * words];
+                    const int x0  = region.min().x() - area.min().x();
+                    for( int i = 0; i < region.width(); ++i )
+                    {
+                        if( detail::is_foreground( source( i, j, p ) ) )
+                        {
+                            row[( x0 + i ) / 64] |= uint64_t( 1 ) << ( ( x0 + i ) % 64 );
+                        }
+                    }
+                }
+
+                for( const auto& stage : m_stages )
+                {
+                    if( stage.erode )
+                    {
+                        mask_outside( bits, words, area, true );
+                        run_stage<detail::Morph_And>( stage, bits, words, area );
+                    }
+                    else
+                    {
+                        mask_outside( bits, words, area, false );
+                        run_stage<detail::Morph_Or>( stage, bits, words, area );
+                    }
+                }
+
+                for( int r = 0; r < bbox.height(); ++r )
+                for( int c = 0; c < bbox.width(); ++c )
+                {
+                    bool on = ( bits[r * words + c / 64] >> ( c % 64 ) ) & 1;
+                    if constexpr( detail::Is_Pixel_Mask<source_type>::value )
+                    {
+                        pixel_type pixel = source( bbox.min().x() + c - region.min().x(),
+                                                   bbox.min().y() + r - region.min().y(),
+                                                   p );
+                        if( on )
+                        {
+                            pixel.validate();
+                        }
+                        else
+                        {
+                            pixel.invalidate();
+                        }
+                        tile( c, r, p ) = pixel;
+                    }
+                    else
+                    {
+                        tile( c, r, p ) = pixel_type( on ? 1 : 0 );
+                    }
+                }
+            }
+        }
+
+        /// Source image
+        ImageT m_image;
+
+        /// Operation
+        Morphology_Op m_op;
+
+        /// Structuring element size
+        math::Size2i m_size;
+
+        /// Erosions and dilations to run
+        std::vector<detail::Morphology_Stage> m_stages;
+
+        /// Tile size
+        math::Size2i m_tile_size;
+
+        /// Threads for rasterizing
+        size_t m_num_threads;
+
+        /// Scratch buffers.  Per thread, since tiles run in parallel.
+        static thread_local inline std::vector<uint64_t> m_prefix;
+        static thread_local inline std::vector<uint64_t> m_suffix;
+        static thread_local inline std::vector<uint64_t> m_scratch;
+
+}; // End of Binary_Morphology_View Class
+
+} // End of ops namespace
+
+/**
+ * Grayscale morphology with a rectangular structuring element
+*/
+template <typename ImageT>
+ops::Morphology_View<ImageT> morphology( const Image_Base<ImageT>& image,
+                                         ops::Morphology_Op        op,
+                                         const math::Size2i&       size,
+                                         const math::Size2i&       tile_size   = math::Size2i( { 256, 256 } ),
+                                         size_t                    num_threads = 0 )
+{
+    return ops::Morphology_View<ImageT>( image.impl(), op, size, tile_size, num_threads );
+}
+
+/**
+ * Grayscale erosion (minimum) over a rectangle
+*/
+template <typename ImageT>
+ops::Morphology_View<ImageT> erode( const Image_Base<ImageT>& image,
+                                   const math::Size2i&       size )
+{
+    return morphology( image, ops::Morphology_Op::ERODE, size );
+}
+
+/**
+ * Grayscale dilation (maximum) over a rectangle
+*/
+template <typename ImageT>
+ops::Morphology_View<ImageT> dilate( const Image_Base<ImageT>& image,
+                                    const math::Size2i&       size )
+{
+    return morphology( image, ops::Morphology_Op::DILATE, size );
+}
+
+/**
+ * Grayscale opening (erosion, then dilation) over a rectangle
+*/
+template <typename ImageT>
+ops::Morphology_View<ImageT> opening( const Image_Base<ImageT>& image,
+                                     const math::Size2i&       size )
+{
+    return morphology( image, ops::Morphology_Op::OPENING, size );
+}
+
+/**
+ * Grayscale closing (dilation, then erosion) over a rectangle
+*/
+template <typename ImageT>
+ops::Morphology_View<ImageT> closing( const Image_Base<ImageT>& image,
+                                     const math::Size2i&       size )
+{
+    return morphology( image, ops::Morphology_Op::CLOSING, size );
+}
+
+/**
+ * Binary morphology of a mask with a rectangular structuring element
+*/
+template <typename ImageT>
+ops::Binary_Morphology_View<ImageT> binary_morphology( const Image_Base<ImageT>& image,
+                                                       ops::Morphology_Op        op,
+                                                       const math::Size2i&       size,
+                                                       const math::Size2i&       tile_size   = math::Size2i( { 256, 256 } ),
+                                                       size_t                    num_threads = 0 )
+{
+    return ops::Binary_Morphology_View<ImageT>( image.impl(), op, size, tile_size, num_threads );
+}
+
+/**
+ * Shrink the foreground (valid pixels) of a mask
+*/
+template <typename ImageT>
+ops::Binary_Morphology_View<ImageT> binary_erode( const Image_Base<ImageT>& image,
+                                                  const math::Size2i&       size )
+{
+    return binary_morphology( image, ops::Morphology_Op::ERODE, size );
+}
+
+/**
+ * Grow the foreground (valid pixels) of a mask
+*/
+template <typename ImageT>
+ops::Binary_Morphology_View<ImageT> binary_dilate( const Image_Base<ImageT>& image,
+                                                   const math::Size2i&       size )
+{
+    return binary_morphology( image, ops::Morphology_Op::DILATE, size );
+}
+
+/**
+ * Remove foreground specks smaller than the element from a mask
+*/
+template <typename ImageT>
+ops::Binary_Morphology_View<ImageT> binary_opening( const Image_Base<ImageT>& image,
+                                                    const math::Size2i&       size )
+{
+    return binary_morphology( image, ops::Morphology_Op::OPENING, size );
+}
+
+/**
+ * Fill background holes smaller than the element in a mask
+*/
+template <typename ImageT>
+ops::Binary_Morphology_View<ImageT> binary_closing( const Image_Base<ImageT>& image,
+                                                    const math::Size2i&       size )
+{
+    return binary_morphology( image, ops::Morphology_Op::CLOSING, size );
+}
+
+} // End of tmns::image namespace
@@ -0,0 +1,557 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Separable_Convolution_View.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "../../pixel/Pixel_Accessor_Loose.hpp"
+#include "../../types/Compound_Utilities.hpp"
+#include "../../types/Image_Base.hpp"
+#include "../../types/Image_Memory.hpp"
+#include "../../types/Image_Memory_Policy.hpp"
+#include "../block/Block_Halo.hpp"
+#include "../block/Block_Tile_Rasterizer.hpp"
+#include "../crop_image.hpp"
+#include "../transform/Edge_Extension.hpp"
+#include "../transform/Interpolation.hpp"
+#include "Kernel_1D.hpp"
+
+// Terminus Libraries
+#include <terminus/math/Size.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <string>
+#include <sys/types.h>
+#include <type_traits>
+#include <vector>
+
+namespace tmns::image {
+namespace ops {
+
+/**
+ * Filters an image with a separable kernel: a horizontal pass with one 1D kernel,
+ * then a vertical pass with another.
+ *
+ * Work is done a tile at a time.  Each tile prerasterizes the child over the tile
+ * plus the kernel's halo, copies it a row at a time into a float (double for double
+ * channels) buffer with the channels interleaved, and runs both passes over whole
+ * rows.  Only halo pixels off the image go through the edge functor.  The
+ * inner loops are plain multiply-adds over contiguous arrays, which the compiler
+ * vectorizes.  The SSE4.1/AVX2 kernels behind `convert()` are fixed-format channel
+ * conversions compiled into the library; this view is a header template over any
+ * channel type and kernel, so it relies on the compiler rather than on that dispatch.
+ * Tiles are spread over threads, so the child must be safe to read from several
+ * threads.  Tiles crossing a wrapping edge load only the strips they read.
+ *
+ * `prerasterize()` fetches the child over the region plus halo once, then filters
+ * from that local copy, so a block worker pulling a composed view through here reads
+ * its input a single time instead of once per tile.
+ *
+ * Integer outputs are rounded and clamped, so filters with negative weights (such
+ * as Sobel) should be applied to a signed or floating-point image.
+*/
+template <typename ImageT,
+          typename EdgeT>
+class Separable_Convolution_View : public Image_Base<Separable_Convolution_View<ImageT,EdgeT>>
+{
+    public:
+
+        /// Pixel Type
+        typedef typename ImageT::pixel_type pixel_type;
+
+        /// Type returned from pixel operators
+        typedef pixel_type result_type;
+
+        /// Pixel Access Type
+        typedef Pixel_Accessor_Loose<Separable_Convolution_View> pixel_accessor;
+
+        /// Channel Type
+        typedef typename math::Compound_Channel_Type<pixel_type>::type channel_type;
+
+        /// Type the passes are computed in
+        typedef std::conditional_t<std::is_same_v<channel_type,double>,double,float> accum_type;
+
+        /// Channels per pixel
+        static constexpr size_t CHANNELS = math::Compound_Channel_Count<pixel_type>::value;
+
+        /**
+         * Constructor
+         * @param image       Source image
+         * @param kernel_x    Horizontal kernel
+         * @param kernel_y    Vertical kernel
+         * @param edge        Edge handling
+         * @param tile_size   Size of the tiles computed at once
+         * @param num_threads Threads for rasterizing.  0 uses the global `rasterize_parallel_settings()`.
+        */
+        Separable_Convolution_View( const ImageT&       image,
+                                    const Kernel_1D&    kernel_x,
+                                    const Kernel_1D&    kernel_y,
+                                    const EdgeT&        edge        = EdgeT(),
+                                    const math::Size2i& tile_size   = math::Size2i( { 256, 256 } ),
+                                    size_t              num_threads = 0 )
+          : m_image( image ),
+            m_kernel_x( kernel_x ),
+            m_kernel_y( kernel_y ),
+            m_edge( edge ),
+            m_tile_size( tile_size ),
+            m_num_threads( num_threads )
+        {}
+
+        /**
+         * Number of image columns
+         */
+        size_t cols() const { return m_image.cols(); }
+
+        /**
+         * Number of image rows
+         */
+        size_t rows() const { return m_image.rows(); }
+
+        /**
+         * Number of image planes
+         */
+        size_t planes() const { return m_image.planes(); }
+
+        /**
+         * Get the origin
+        */
+        pixel_accessor origin() const
+        {
+            return pixel_accessor( *this, 0, 0, 0 );
+        }
+
+        /**
+         * Filter a single pixel.  Reads the whole kernel footprint; use rasterize()
+         * for anything bigger.
+         */
+        result_type operator()( size_t c,
+                                size_t r,
+                                size_t p = 0 ) const
+        {
+            auto child = [this]( ssize_t x, ssize_t y, size_t plane )
+            {
+                return m_image( size_t( x ), size_t( y ), plane );
+            };
+
+            detail::Pixel_Accumulator<pixel_type> acc;
+            for( size_t j = 0; j < m_kernel_y.size(); ++j )
+            for( size_t i = 0; i < m_kernel_x.size(); ++i )
+            {
+                acc.add( read_pixel( child,
+                                     ssize_t( c + i ) - m_kernel_x.origin(),
+                                     ssize_t( r + j ) - m_kernel_y.origin(),
+                                     p ),
+                         m_kernel_x[i] * m_kernel_y[j] );
+            }
+            return acc.value();
+        }
+
+        /**
+         * Get the child image
+        */
+        const ImageT& child() const { return m_image; }
+
+        /**
+         * Get the horizontal kernel
+        */
+        const Kernel_1D& kernel_x() const { return m_kernel_x; }
+
+        /**
+         * Get the vertical kernel
+        */
+        const Kernel_1D& kernel_y() const { return m_kernel_y; }
+
+        /**
+         * Input pixels needed around an output region, including the child's
+        */
+        block::Halo halo() const
+        {
+            return kernel_halo() + block::image_halo( m_image );
+        }
+
+        typedef Crop_View<Image_Memory<pixel_type>> prerasterize_type;
+        prerasterize_type prerasterize( const math::Rect2i& bbox ) const
+        {
+            // Init output data
+            Image_Memory<pixel_type> buffer( bbox.width(),
+                                             bbox.height(),
+                                             planes() );
+
+            // Fetch the child over the halo once, then filter the tiles from that copy.
+            // A region wrapping around an edge comes in pieces, which the tiles load
+            // themselves.
+            auto regions = m_edge.source_regions( kernel_halo().expand( bbox ), cols(), rows() );
+            if( regions.size() == 1 )
+            {
+                typedef typename ImageT::prerasterize_type Source_T;
+                Separable_Convolution_View<Source_T,EdgeT> local( m_image.prerasterize( regions.front() ),
+                                                                  m_kernel_x,
+                                                                  m_kernel_y,
+                                                                  m_edge,
+                                                                  m_tile_size,
+                                                                  m_num_threads );
+                local.rasterize( buffer, bbox );
+            }
+            else
+            {
+                rasterize( buffer, bbox );
+            }
+
+            // "Fake" the bbox image so it looks like a full size image.
+            return Crop_View<Image_Memory<pixel_type>>( buffer,
+                                                        math::Rect2i( -bbox.min().x(),
+                                                                      -bbox.min().y(),
+                                                                      cols(),
+                                                                      rows() ) );
+        }
+
+        template <class DestT>
+        void rasterize( const DestT&        dest,
+                        const math::Rect2i& bbox ) const
+        {
+            auto fill = [this]( const math::Rect2i&             tile_bbox,
+                                const math::Rect2i&             needed,
+                                const Image_Memory<pixel_type>& tile )
+            {
+                filter_tile( tile_bbox, needed, tile );
+            };
+            block::rasterize_tiles<pixel_type>( dest,
+                                                bbox,
+                                                planes(),
+                                                m_tile_size,
+                                                m_num_threads,
+                                                kernel_halo(),
+                                                fill );
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Separable_Convolution_View";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + ImageT::full_name() + "," + EdgeT::full_name() + ">";
+        }
+
+    private:
+
+        /**
+         * Pixels the kernels reach around each output pixel
+        */
+        block::Halo kernel_halo() const
+        {
+            return block::Halo( m_kernel_x.before(),
+                                m_kernel_y.before(),
+                                m_kernel_x.after(),
+                                m_kernel_y.after() );
+        }
+
+        /**
+         * Read a pixel through the edge functor
+         * @param lookup Reads an in-bounds child pixel, in child coordinates
+        */
+        template <typename LookupT>
+        pixel_type read_pixel( const LookupT& lookup,
+                               ssize_t        c,
+                               ssize_t        r,
+                               size_t         p ) const
+        {
+            ssize_t ncols = cols(), nrows = rows();
+            if( c < 0 || r < 0 || c >= ncols || r >= nrows )
+            {
+                if constexpr( EdgeT::CONSTANT )
+                {
+                    return m_edge.value();
+                }
+                else
+                {
+                    m_edge.remap( c, r, ncols, nrows );
+                }
+            }
+            return lookup( c, r, p );
+        }
+
+        /**
+         * Compute the pixels of bbox into the tile
+         * @param needed Tile plus the kernel halo
+        */
+        void filter_tile( const math::Rect2i&             bbox,
+                          const math::Rect2i&             needed,
+                          const Image_Memory<pixel_type>& tile ) const
+        {
+            // Child pixels needed to cover the halo.  Tiles crossing a wrapping edge
+            // load the strips they read from the far side, and a tile entirely off the
+            // image with a constant edge loads nothing.
+            auto regions = m_edge.source_regions( needed, cols(), rows() );
+            std::vector<Image_Memory<pixel_type>> sources;
+            sources.reserve( regions.size() );
+            for( const auto& region : regions )
+            {
+                sources.emplace_back( region.width(),
+                                      region.height(),
+                                      planes(),
+                                      tile_memory_policy() );
+                m_image.rasterize( sources.back(), region );
+            }
+
+            auto lookup = [&]( ssize_t c, ssize_t r, size_t p )
+            {
+                for( size_t i = 0; i < regions.size(); ++i )
+                {
+                    const auto& region = regions[i];
+                    ssize_t x = c - region.min().x();
+                    ssize_t y = r - region.min().y();
+                    if( x >= 0 && y >= 0 && x < region.width() && y < region.height() )
+                    {
+                        return pixel_type( sources[i]( size_t( x ), size_t( y ), p ) );
+                    }
+                }
+                return pixel_type( m_image( size_t( c ), size_t( r ), p ) );
+            };
+
+            const size_t in_width  = CHANNELS * needed.width();
+            const size_t out_width = CHANNELS * bbox.width();
+            std::vector<accum_type> line( in_width );
+            std::vector<accum_type> horizontal( out_width * needed.height() );
+            std::vector<accum_type> output( out_width );
+
+            auto store = [&]( int i, const pixel_type& pixel )
+            {
+                for( size_t ch = 0; ch < CHANNELS; ++ch )
+                {
+                    line[i * CHANNELS + ch] = accum_type( compound_select_channel<const channel_type&>( pixel, ch ) );
+                }
+            };
+
+            // Columns of the halo inside the image, which every row copies as one span
+            const ssize_t ncols = cols(), nrows = rows();
+            const ssize_t x0    = needed.min().x();
+            const ssize_t ix0   = std::clamp<ssize_t>( x0, 0, ncols );
+            const ssize_t ix1   = std::clamp<ssize_t>( x0 + needed.width(), ix0, ncols );
+
+            for( size_t p = 0; p < planes(); ++p )
+            {
+                // Horizontal pass over every row of the halo
+                for( int j = 0; j < needed.height(); ++j )
+                {
+                    ssize_t y = needed.min().y() + j;
+                    bool constant_row = false;
+                    if( y < 0 || y >= nrows )
+                    {
+                        if constexpr( EdgeT::CONSTANT )
+                        {
+                            constant_row = true;
+                        }
+                        else
+                        {
+                            ssize_t unused_c = 0;
+                            m_edge.remap( unused_c, y, ncols, nrows );
+                        }
+                    }
+
+                    if( constant_row )
+                    {
+                        for( int i = 0; i < needed.width(); ++i )
+                        {
+                            store( i, read_pixel( lookup, x0 + i, y, p ) );
+                        }
+                    }
+                    else
+                    {
+                        // Off-image columns go through the edge functor one at a time
+                        for( ssize_t x = x0; x < std::min<ssize_t>( ix0, x0 + needed.width() ); ++x )
+                        {
+                            store( int( x - x0 ), read_pixel( lookup, x, y, p ) );
+                        }
+                        for( ssize_t x = std::max( ix1, x0 ); x < x0 + needed.width(); ++x )
+                        {
+                            store( int( x - x0 ), read_pixel( lookup, x, y, p ) );
+                        }
+
+                        // Remapped runs are merged, so one loaded region holds the whole span
+                        bool copied = ( ix1 <= ix0 );
+                        for( size_t k = 0; !copied && k < regions.size(); ++k )
+                        {
+                            const auto& region = regions[k];
+                            if( ix0 >= region.min().x() && ix1 <= region.min().x() + region.width() &&
+                                y   >= region.min().y() && y   <  region.min().y() + region.height() )
+                            {
+                                const pixel_type* src = &sources[k]( size_t( ix0 - region.min().x() ),
+                                                                     size_t( y - region.min().y() ),
+                                                                     p );
+                                for( ssize_t x = ix0; x < ix1; ++x, ++src )
+                                {
+                                    store( int( x - x0 ), *src );
+                                }
+                                copied = true;
+                            }
+                        }
+                        for( ssize_t x = ix0; !copied && x < ix1; ++x )
+                        {
+                            store( int( x - x0 ), lookup( x, y, p ) );
+                        }
+                    }
+
+                    accum_type* out = &horizontal[j * out_width];
+                    std::fill( out, out + out_width, accum_type( 0 ) );
+                    for( size_t t = 0; t < m_kernel_x.size(); ++t )
+                    {
+                        const accum_type  weight = accum_type( m_kernel_x[t] );
+                        const accum_type* in     = &line[t * CHANNELS];
+                        for( size_t i = 0; i < out_width; ++i )
+                        {
+                            out[i] += weight * in[i];
+                        }
+                    }
+                }
+
+                // Vertical pass, one output row at a time
+                for( int r = 0; r < bbox.height(); ++r )
+                {
+                    std::fill( output.begin(), output.end(), accum_type( 0 ) );
+                    for( size_t t = 0; t < m_kernel_y.size(); ++t )
+                    {
+                        const accum_type  weight = accum_type( m_kernel_y[t] );
+                        const accum_type* in     = &horizontal[( r + t ) * out_width];
+                        for( size_t i = 0; i < out_width; ++i )
+                        {
+                            output[i] += weight * in[i];
+                        }
+                    }
+
+                    for( int c = 0; c < bbox.width(); ++c )
+                    {
+                        pixel_type& pixel = tile( c, r, p );
+                        for( size_t ch = 0; ch < CHANNELS; ++ch )
+                        {
+                            compound_select_channel<channel_type&>( pixel, ch ) = detail::saturate_channel<channel_type>( output[c * CHANNELS + ch] );
+                        }
+                    }
+                }
+            }
+        }
+
+        /// Source image
+        ImageT m_image;
+
+        /// Horizontal kernel
+        Kernel_1D m_kernel_x;
+
+        /// Vertical kernel
+        Kernel_1D m_kernel_y;
+
+        /// Edge handling
+        EdgeT m_edge;
+
+        /// Tile size
+        math::Size2i m_tile_size;
+
+        /// Threads for rasterizing
+        size_t m_num_threads;
+
+}; // End of Separable_Convolution_View Class
+
+} // End of ops namespace
+
+/**
+ * Filter an image with separate horizontal and vertical kernels, repeating the edge
+ * pixels outward
+*/
+template <typename ImageT>
+ops::Separable_Convolution_View<ImageT,ops::Extend_Edge>
+    separable_convolution( const Image_Base<ImageT>& image,
+                           const ops::Kernel_1D&     kernel_x,
+                           const ops::Kernel_1D&     kernel_y )
+{
+    return ops::Separable_Convolution_View<ImageT,ops::Extend_Edge>( image.impl(),
+                                                                     kernel_x,
+                                                                     kernel_y );
+}
+
+/**
+ * Filter an image with separate horizontal and vertical kernels
+*/
+template <typename ImageT,
+          typename EdgeT>
+ops::Separable_Convolution_View<ImageT,EdgeT>
+    separable_convolution( const Image_Base<ImageT>& image,
+                           const ops::Kernel_1D&     kernel_x,
+                           const ops::Kernel_1D&     kernel_y,
+                           const EdgeT&              edge,
+                           const math::Size2i&       tile_size   = math::Size2i( { 256, 256 } ),
+                           size_t                    num_threads = 0 )
+{
+    return ops::Separable_Convolution_View<ImageT,EdgeT>( image.impl(),
+                                                          kernel_x,
+                                                          kernel_y,
+                                                          edge,
+                                                          tile_size,
+                                                          num_threads );
+}
+
+/**
+ * Gaussian blur
+ * @param sigma Standard deviation, in pixels
+*/
+template <typename ImageT>
+ops::Separable_Convolution_View<ImageT,ops::Extend_Edge>
+    gaussian_blur( const Image_Base<ImageT>& image,
+                   double                    sigma )
+{
+    auto kernel = ops::Kernel_1D::gaussian( sigma );
+    return separable_convolution( image, kernel, kernel );
+}
+
+/**
+ * Moving average over a size x size window
+*/
+template <typename ImageT>
+ops::Separable_Convolution_View<ImageT,ops::Extend_Edge>
+    box_blur( const Image_Base<ImageT>& image,
+              int                       size )
+{
+    auto kernel = ops::Kernel_1D::box( size );
+    return separable_convolution( image, kernel, kernel );
+}
+
+/**
+ * Sobel derivative along x, positive where values increase to the right
+*/
+template <typename ImageT>
+ops::Separable_Convolution_View<ImageT,ops::Extend_Edge>
+    sobel_x( const Image_Base<ImageT>& image )
+{
+    return separable_convolution( image,
+                                  ops::Kernel_1D::sobel_derivative(),
+                                  ops::Kernel_1D::sobel_smoothing() );
+}
+
+/**
+ * Sobel derivative along y, positive where values increase downward
+*/
+template <typename ImageT>
+ops::Separable_Convolution_View<ImageT,ops::Extend_Edge>
+    sobel_y( const Image_Base<ImageT>& image )
+{
+    return separable_convolution( image,
+                                  ops::Kernel_1D::sobel_smoothing(),
+                                  ops::Kernel_1D::sobel_derivative() );
+}
+
+} // End of tmns::image namespace
@@ -0,0 +1,224 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    image_math.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "../types/Compound_Utilities.hpp"
+#include "per_pixel_views/Per_Pixel_View_Binary.hpp"
+#include "per_pixel_views/Per_Pixel_View_Nary.hpp"
+#include "per_pixel_views/Per_Pixel_View_Unary.hpp"
+
+// Terminus Libraries
+#include <terminus/math/types/Functors.hpp>
+
+// C++ Libraries
+#include <type_traits>
+
+namespace tmns::image::ops {
+
+/**
+ * Channel arithmetic.  Results use the common type of the two channels, so
+ * uint8 - uint8 stays uint8 (cast to float first for signed band math).
+*/
+#define TMNS_IMAGE_CHANNEL_FUNCTOR( NAME, OP )                                   \
+struct NAME                                                                      \
+{                                                                                \
+    template <typename Arg1T,                                                    \
+              typename Arg2T>                                                    \
+    std::common_type_t<Arg1T,Arg2T> operator()( const Arg1T& arg1,               \
+                                                const Arg2T& arg2 ) const        \
+    {                                                                            \
+        return std::common_type_t<Arg1T,Arg2T>( arg1 OP arg2 );                  \
+    }                                                                            \
+};
+
+TMNS_IMAGE_CHANNEL_FUNCTOR( Channel_Sum_Functor,        + )
+TMNS_IMAGE_CHANNEL_FUNCTOR( Channel_Difference_Functor, - )
+TMNS_IMAGE_CHANNEL_FUNCTOR( Channel_Product_Functor,    * )
+TMNS_IMAGE_CHANNEL_FUNCTOR( Channel_Quotient_Functor,   / )
+
+#undef TMNS_IMAGE_CHANNEL_FUNCTOR
+
+/**
+ * Channel comparisons.  Each channel of the result is a bool.
+*/
+#define TMNS_IMAGE_CHANNEL_COMPARE_FUNCTOR( NAME, OP )                           \
+struct NAME                                                                      \
+{                                                                                \
+    template <typename Arg1T,                                                    \
+              typename Arg2T>                                                    \
+    bool operator()( const Arg1T& arg1,                                          \
+                     const Arg2T& arg2 ) const                                   \
+    {                                                                            \
+        return arg1 OP arg2;                                                     \
+    }                                                                            \
+};
+
+TMNS_IMAGE_CHANNEL_COMPARE_FUNCTOR( Channel_Equal_Functor,            == )
+TMNS_IMAGE_CHANNEL_COMPARE_FUNCTOR( Channel_Not_Equal_Functor,        != )
+TMNS_IMAGE_CHANNEL_COMPARE_FUNCTOR( Channel_Less_Functor,             <  )
+TMNS_IMAGE_CHANNEL_COMPARE_FUNCTOR( Channel_Less_Equal_Functor,       <= )
+TMNS_IMAGE_CHANNEL_COMPARE_FUNCTOR( Channel_Greater_Functor,          >  )
+TMNS_IMAGE_CHANNEL_COMPARE_FUNCTOR( Channel_Greater_Equal_Functor,    >= )
+
+#undef TMNS_IMAGE_CHANNEL_COMPARE_FUNCTOR
+
+/**
+ * Apply a channel functor with a fixed scalar on the right-hand side
+*/
+template <typename FunctorT,
+          typename ScalarT>
+class Channel_Arg_Val_Functor
+{
+    public:
+
+        Channel_Arg_Val_Functor( ScalarT value )
+          : m_value( value ) {}
+
+        template <typename ArgT>
+        std::invoke_result_t<FunctorT,ArgT,ScalarT> operator()( const ArgT& arg ) const
+        {
+            return m_func( arg, m_value );
+        }
+
+    private:
+
+        FunctorT m_func;
+        ScalarT  m_value;
+
+}; // End of Channel_Arg_Val_Functor class
+
+/**
+ * Apply a channel functor with a fixed scalar on the left-hand side
+*/
+template <typename FunctorT,
+          typename ScalarT>
+class Channel_Val_Arg_Functor
+{
+    public:
+
+        Channel_Val_Arg_Functor( ScalarT value )
+          : m_value( value ) {}
+
+        template <typename ArgT>
+        std::invoke_result_t<FunctorT,ScalarT,ArgT> operator()( const ArgT& arg ) const
+        {
+            return m_func( m_value, arg );
+        }
+
+    private:
+
+        FunctorT m_func;
+        ScalarT  m_value;
+
+}; // End of Channel_Val_Arg_Functor class
+
+/**
+ * Combine two images pixel-by-pixel with any functor.  Evaluated lazily, in the same
+ * pass as the rest of the expression.
+*/
+template <typename Image1T,
+          typename Image2T,
+          typename FunctorT>
+Per_Pixel_View_Binary<Image1T,Image2T,FunctorT> per_pixel_view( const Image_Base<Image1T>& image1,
+                                                                const Image_Base<Image2T>& image2,
+                                                                const FunctorT&            func )
+{
+    return Per_Pixel_View_Binary<Image1T,Image2T,FunctorT>( image1.impl(), image2.impl(), func );
+}
+
+/**
+ * Combine any number of images pixel-by-pixel.  The functor gets one pixel per image.
+*/
+template <typename FunctorT,
+          typename... ImagesT>
+Per_Pixel_View_Nary<FunctorT,ImagesT...> per_pixel_nary_view( const FunctorT&               func,
+                                                              const Image_Base<ImagesT>&... images )
+{
+    return Per_Pixel_View_Nary<FunctorT,ImagesT...>( func, images.impl()... );
+}
+
+} // End of tmns::image::ops namespace
+
+namespace tmns::image {
+
+/**
+ * Image operators.  Each one returns a lazy view, so an expression such as
+ * `( nir - red ) / ( nir + red )` is evaluated in a single pass when it is rasterized,
+ * without intermediate images.  The operators work channel-by-channel.
+ *
+ * For each operator this defines image-image, image-scalar and scalar-image overloads.
+*/
+#define TMNS_IMAGE_BINARY_OPERATOR( OP, FUNC )                                                              \
+template <typename Image1T,                                                                                 \
+          typename Image2T>                                                                                 \
+ops::Per_Pixel_View_Binary<Image1T,                                                                         \
+                           Image2T,                                                                         \
+                           cmp::Binary_Compound_Functor<ops::FUNC,                                          \
+                                                        typename Image1T::pixel_type,                       \
+                                                        typename Image2T::pixel_type>>                      \
+    operator OP ( const Image_Base<Image1T>& image1,                                                        \
+                  const Image_Base<Image2T>& image2 )                                                       \
+{                                                                                                           \
+    typedef cmp::Binary_Compound_Functor<ops::FUNC,                                                         \
+                                         typename Image1T::pixel_type,                                      \
+                                         typename Image2T::pixel_type> func_type;                           \
+    return ops::Per_Pixel_View_Binary<Image1T,Image2T,func_type>( image1.impl(), image2.impl() );           \
+}                                                                                                           \
+                                                                                                            \
+template <typename ImageT,                                                                                  \
+          typename ScalarT>                                                                                 \
+typename std::enable_if_t<math::Is_Scalar<ScalarT>::value,                                                  \
+                          ops::Per_Pixel_View_Unary<ImageT,                                                 \
+                                                    cmp::Unary_Compound_Functor<ops::Channel_Arg_Val_Functor<ops::FUNC,ScalarT>, \
+                                                                                typename ImageT::pixel_type>>> \
+    operator OP ( const Image_Base<ImageT>& image,                                                          \
+                  ScalarT                   value )                                                         \
+{                                                                                                           \
+    typedef cmp::Unary_Compound_Functor<ops::Channel_Arg_Val_Functor<ops::FUNC,ScalarT>,                    \
+                                        typename ImageT::pixel_type> func_type;                             \
+    return ops::Per_Pixel_View_Unary<ImageT,func_type>( image.impl(),                                       \
+                                                        func_type( ops::Channel_Arg_Val_Functor<ops::FUNC,ScalarT>( value ) ) ); \
+}                                                                                                           \
+                                                                                                            \
+template <typename ImageT,                                                                                  \
+          typename ScalarT>                                                                                 \
+typename std::enable_if_t<math::Is_Scalar<ScalarT>::value,                                                  \
+                          ops::Per_Pixel_View_Unary<ImageT,                                                 \
+                                                    cmp::Unary_Compound_Functor<ops::Channel_Val_Arg_Functor<ops::FUNC,ScalarT>, \
+                                                                                typename ImageT::pixel_type>>> \
+    operator OP ( ScalarT                   value,                                                          \
+                  const Image_Base<ImageT>& image )                                                         \
+{                                                                                                           \
+    typedef cmp::Unary_Compound_Functor<ops::Channel_Val_Arg_Functor<ops::FUNC,ScalarT>,                    \
+                                        typename ImageT::pixel_type> func_type;                             \
+    return ops::Per_Pixel_View_Unary<ImageT,func_type>( image.impl(),                                       \
+                                                        func_type( ops::Channel_Val_Arg_Functor<ops::FUNC,ScalarT>( value ) ) ); \
+}
+
+TMNS_IMAGE_BINARY_OPERATOR( +,  Channel_Sum_Functor )
+TMNS_IMAGE_BINARY_OPERATOR( -,  Channel_Difference_Functor )
+TMNS_IMAGE_BINARY_OPERATOR( *,  Channel_Product_Functor )
+TMNS_IMAGE_BINARY_OPERATOR( /,  Channel_Quotient_Functor )
+TMNS_IMAGE_BINARY_OPERATOR( ==, Channel_Equal_Functor )
+TMNS_IMAGE_BINARY_OPERATOR( !=, Channel_Not_Equal_Functor )
+TMNS_IMAGE_BINARY_OPERATOR( <,  Channel_Less_Functor )
+TMNS_IMAGE_BINARY_OPERATOR( <=, Channel_Less_Equal_Functor )
+TMNS_IMAGE_BINARY_OPERATOR( >,  Channel_Greater_Functor )
+TMNS_IMAGE_BINARY_OPERATOR( >=, Channel_Greater_Equal_Functor )
+
+#undef TMNS_IMAGE_BINARY_OPERATOR
+
+} // End of tmns::image namespace
@@ -0,0 +1,87 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    lookup_table.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include "../pixel/Channel_Lookup_Table.hpp"
+#include "../pixel/Pixel_Cast_Utilities.hpp"
+#include "per_pixel_views/Per_Pixel_View_Unary.hpp"
+
+namespace tmns::image::ops {
+
+/**
+ * View type which maps every channel of an image through a lookup table
+*/
+template <typename ImageT,
+          typename DstChannelT>
+using Lookup_Table_View = Per_Pixel_View_Unary<ImageT,
+                                               cmp::Unary_Compound_Functor<pix::Channel_Lookup_Functor<typename pix::Image_Channel_Type<ImageT>::type,
+                                                                                                       DstChannelT>,
+                                                                           typename ImageT::pixel_type>>;
+
+/**
+ * Map every channel of the image through an existing lookup table
+*/
+template <typename DstChannelT,
+          typename ImageT>
+Lookup_Table_View<ImageT,DstChannelT>
+    apply_lookup_table( const Image_Base<ImageT>& image,
+                        typename pix::Channel_Lookup_Table<typename pix::Image_Channel_Type<ImageT>::type,
+                                                           DstChannelT>::ptr_t table )
+{
+    typedef pix::Channel_Lookup_Functor<typename pix::Image_Channel_Type<ImageT>::type,DstChannelT> lookup_type;
+    typedef cmp::Unary_Compound_Functor<lookup_type,typename ImageT::pixel_type>               func_type;
+    return Lookup_Table_View<ImageT,DstChannelT>( image.impl(),
+                                                  func_type( lookup_type( std::move( table ) ) ) );
+}
+
+/**
+ * Apply an arbitrary tone curve to every channel.  The curve is evaluated once per
+ * possible channel value when the view is created.
+ *
+ * @param image Image with 8/16-bit integer channels
+ * @param curve Function taking a source channel value and returning the new value
+*/
+template <typename DstChannelT,
+          typename ImageT,
+          typename FuncT>
+Lookup_Table_View<ImageT,DstChannelT>
+    tone_curve( const Image_Base<ImageT>& image,
+                const FuncT&              curve )
+{
+    typedef pix::Channel_Lookup_Table<typename pix::Image_Channel_Type<ImageT>::type,DstChannelT> table_type;
+    return apply_lookup_table<DstChannelT>( image,
+                                            std::make_shared<const table_type>( curve ) );
+}
+
+/**
+ * Apply a tone curve, sharing the table through the lookup-table cache.  The name and
+ * parameters must fully describe the curve (ex: "gamma", { 2.2 }).
+*/
+template <typename DstChannelT,
+          typename ImageT,
+          typename FuncT>
+Lookup_Table_View<ImageT,DstChannelT>
+    tone_curve( const Image_Base<ImageT>&  image,
+                const std::string&         name,
+                const std::vector<double>& params,
+                const FuncT&               curve )
+{
+    typedef pix::Channel_Lookup_Table<typename pix::Image_Channel_Type<ImageT>::type,DstChannelT> table_type;
+    return apply_lookup_table<DstChannelT>( image,
+                                            table_type::cached( name, params, curve ) );
+}
+
+} // End of tmns::image::ops namespace
@@ -15,14 +15,21 @@
 #pragma once
 
 // Terminus Libraries
+#include "../pixel/Channel_Lookup_Table.hpp"
 #include "../pixel/Pixel_Cast_Utilities.hpp"
 #include "per_pixel_views/Per_Pixel_View_Unary.hpp"
 #include "statistics/channel_operations.hpp"
 
+// C++ Libraries
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
 namespace tmns::image::ops {
 
 /**
- * Normalizes pixel data to specified range.
+ * Normalizes pixel data to specified range.  Integer results outside the channel's
+ * range saturate, since values outside [old_min, old_max] map past [new_min, new_max].
 */
 template <typename PixelT>
 class Channel_Normalize_Functor: public math::Unary_Return_Same_Type
@@ -51,7 +58,14 @@ class Channel_Normalize_Functor: public math::Unary_Return_Same_Type
         template <typename ChannelT>
         ChannelT operator()( ChannelT value ) const
         {
-            return (ChannelT)((value - m_old_min) * m_old_to_new_ratio + m_new_min);
+            double result = (value - m_old_min) * m_old_to_new_ratio + m_new_min;
+            if constexpr ( std::is_integral_v<ChannelT> )
+            {
+                result = std::clamp( result,
+                                     double( std::numeric_limits<ChannelT>::lowest() ),
+                                     double( std::numeric_limits<ChannelT>::max() ) );
+            }
+            return (ChannelT)result;
         }
 
     private:
@@ -60,6 +74,102 @@ class Channel_Normalize_Functor: public math::Unary_Return_Same_Type
         double m_old_to_new_ratio;
 }; // End of Channel_Normalize_Functor class
 
+/**
+ * Normalize functor for small integer channels.  Maps through a cached lookup table
+ * built from Channel_Normalize_Functor when one is worth building, otherwise computes
+ * each value directly.  Either way the result is identical.
+*/
+template <typename PixelT>
+class Channel_Normalize_Lookup_Functor : public math::Return_Fixed_Type<typename math::Compound_Channel_Type<PixelT>::type>
+{
+    public:
+
+        typedef typename math::Compound_Channel_Type<PixelT>::type channel_type;
+
+        typedef typename pix::Channel_Lookup_Table<channel_type,channel_type>::ptr_t table_ptr_t;
+
+        Channel_Normalize_Lookup_Functor( const Channel_Normalize_Functor<PixelT>& func,
+                                          table_ptr_t                              table )
+          : m_func( func ),
+            m_table( std::move( table ) ) {}
+
+        channel_type operator()( channel_type value ) const
+        {
+            return m_table ? (*m_table)( value ) : m_func( value );
+        }
+
+        /**
+         * Get the lookup table, or null if values are computed directly
+        */
+        const table_ptr_t& table() const
+        {
+            return m_table;
+        }
+
+    private:
+
+        Channel_Normalize_Functor<PixelT> m_func;
+
+        table_ptr_t m_table;
+
+}; // End of Channel_Normalize_Lookup_Functor class
+
+/**
+ * Pick the normalize functor for a pixel type.  Small integer channels get a cached
+ * lookup table built from Channel_Normalize_Functor, so the result is identical.
+*/
+template <typename PixelT>
+struct Channel_Normalize_Functor_Type
+{
+    typedef typename math::Compound_Channel_Type<PixelT>::type channel_type;
+
+    typedef std::conditional_t<pix::Has_Channel_Lookup_Table<channel_type>::value,
+                               Channel_Normalize_Lookup_Functor<PixelT>,
+                               Channel_Normalize_Functor<PixelT>> type;
+
+    /**
+     * Create the functor
+     * @param num_values Channel values the functor will convert.  A table is only built
+     *                   when there are at least as many values as table entries, so small
+     *                   16-bit images don't pay for 65536 evaluations.
+    */
+    static type create( channel_type old_min,
+                        channel_type old_max,
+                        channel_type new_min,
+                        channel_type new_max,
+                        size_t       num_values = std::numeric_limits<size_t>::max() )
+    {
+        Channel_Normalize_Functor<PixelT> func( old_min, old_max, new_min, new_max );
+        if constexpr ( pix::Has_Channel_Lookup_Table<channel_type>::value )
+        {
+            typedef pix::Channel_Lookup_Table<channel_type,channel_type> table_type;
+            if( num_values < table_type::SIZE )
+            {
+                return type( func, nullptr );
+            }
+            return type( func, table_type::cached( "normalize",
+                                                   { double( old_min ),
+                                                     double( old_max ),
+                                                     double( new_min ),
+                                                     double( new_max ) },
+                                                   func ) );
+        }
+        else
+        {
+            return func;
+        }
+    }
+
+    /**
+     * Number of channel values in an image
+    */
+    template <typename ImageT>
+    static size_t num_values( const Image_Base<ImageT>& image )
+    {
+        return image.cols() * image.rows() * image.planes() * math::Compound_Channel_Count<PixelT>::value;
+    }
+}; // End of Channel_Normalize_Functor_Type struct
+
 /**
  * Normalizes pixel data to specified range, but does not touch alpha 
  * channels
@@ -73,16 +183,18 @@ class Channel_Normalize_Retain_Alpha_Functor: public math::Unary_Return_Same_Typ
         
         typedef typename pix::Pixel_Without_Alpha<PixelT>::type   non_alpha_type;
         
-        typedef Channel_Normalize_Functor<non_alpha_type>         norm_func_type;
+        typedef typename Channel_Normalize_Functor_Type<non_alpha_type>::type norm_func_type;
 
         Channel_Normalize_Retain_Alpha_Functor( channel_type old_min,
                                                 channel_type old_max,
                                                 channel_type new_min,
-                                                channel_type new_max )
-            : m_compound_func( norm_func_type( old_min,
-                                               old_max,
-                                               new_min,
-                                               new_max ) )
+                                                channel_type new_max,
+                                                size_t       num_values = std::numeric_limits<size_t>::max() )
+            : m_compound_func( Channel_Normalize_Functor_Type<non_alpha_type>::create( old_min,
+                                                                                       old_max,
+                                                                                       new_min,
+                                                                                       new_max,
+                                                                                       num_values ) )
         {
         }
 
@@ -120,7 +232,8 @@ Per_Pixel_View_Unary<ImageT, Channel_Normalize_Retain_Alpha_Functor<typename Ima
                             typename pix::Image_Channel_Type<ImageT>::type new_high  )
 {
     typedef Channel_Normalize_Retain_Alpha_Functor<typename ImageT::pixel_type> func_type;
-    func_type func ( old_low, old_high, new_low, new_high );
+    func_type func ( old_low, old_high, new_low, new_high,
+                     Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::num_values( image ) );
     return Per_Pixel_View_Unary<ImageT, func_type >( image.impl(), func );
 }
 
@@ -128,7 +241,7 @@ Per_Pixel_View_Unary<ImageT, Channel_Normalize_Retain_Alpha_Functor<typename Ima
  * Renormalize the values in an image to fall within the range [low,high).
  */
 template <typename ImageT>
-Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Functor<typename ImageT::pixel_type>,
+Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<typename Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::type,
                                                          typename ImageT::pixel_type> >
     normalize( const Image_Base<ImageT>&                      image,
                typename pix::Image_Channel_Type<ImageT>::type old_low,
@@ -136,13 +249,14 @@ Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Funct
                typename pix::Image_Channel_Type<ImageT>::type new_low,
                typename pix::Image_Channel_Type<ImageT>::type new_high  )
 {
-    typedef cmp::Unary_Compound_Functor<Channel_Normalize_Functor<typename ImageT::pixel_type>,
+    typedef cmp::Unary_Compound_Functor<typename Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::type,
                                         typename ImageT::pixel_type> func_type;
 
-    func_type func( Channel_Normalize_Functor<typename ImageT::pixel_type>( old_low,
+    func_type func( Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::create( old_low,
                                                                             old_high,
                                                                             new_low,
-                                                                            new_high ) );
+                                                                            new_high,
+                                                                            Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::num_values( image ) ) );
     return Per_Pixel_View_Unary<ImageT, func_type >( image.impl(), func );
 }
 
@@ -150,12 +264,12 @@ Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Funct
  * Renormalize the values in an image to fall within the range [low,high).
  */
 template <class ImageT>
-Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Functor<typename ImageT::pixel_type>, typename ImageT::pixel_type> >
+Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<typename Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::type, typename ImageT::pixel_type> >
     normalize( const Image_Base<ImageT>&                      image,
                typename pix::Image_Channel_Type<ImageT>::type low,
                typename pix::Image_Channel_Type<ImageT>::type high )
 {
-    typedef cmp::Unary_Compound_Functor<Channel_Normalize_Functor<typename ImageT::pixel_type>,
+    typedef cmp::Unary_Compound_Functor<typename Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::type,
                                         typename ImageT::pixel_type> func_type;
     
     typename pix::Image_Channel_Type<ImageT>::type old_min;
@@ -163,10 +277,11 @@ Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Funct
     
     min_max_channel_values( image, old_min, old_max );
 
-    func_type func( Channel_Normalize_Functor<typename ImageT::pixel_type>( old_min,
+    func_type func( Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::create( old_min,
                                                                             old_max,
                                                                             low,
-                                                                            high ) );
+                                                                            high,
+                                                                            Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::num_values( image ) ) );
     
     return Per_Pixel_View_Unary<ImageT, func_type >( image.impl(), func );
 }
@@ -177,12 +292,12 @@ Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Funct
  * type trait but is generally zero.
  */
 template <typename ImageT>
-Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Functor<typename ImageT::pixel_type>,
+Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<typename Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::type,
                                                          typename ImageT::pixel_type> >
     normalize( const Image_Base<ImageT>&                      image,
                typename pix::Image_Channel_Type<ImageT>::type high )
 {
-    typedef cmp::Unary_Compound_Functor<Channel_Normalize_Functor<typename ImageT::pixel_type>,
+    typedef cmp::Unary_Compound_Functor<typename Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::type,
                                         typename ImageT::pixel_type> func_type;
     
     typedef Channel_Range<typename pix::Image_Channel_Type<ImageT>::type> range_type;
@@ -192,10 +307,11 @@ Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Funct
     
     min_max_channel_values( image, old_min, old_max );
 
-    func_type func( Channel_Normalize_Functor<typename ImageT::pixel_type>( old_min,
+    func_type func( Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::create( old_min,
                                                                             old_max,
                                                                             range_type::min(),
-                                                                            high ) );
+                                                                            high,
+                                                                            Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::num_values( image ) ) );
     
     return Per_Pixel_View_Unary<ImageT, func_type >( image.impl(), func );
 }
@@ -207,11 +323,11 @@ Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Funct
  * positve value for integral types.
  */
 template <typename ImageT>
-Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Functor<typename ImageT::pixel_type>,
+Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<typename Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::type,
                                                          typename ImageT::pixel_type> >
     normalize( const Image_Base<ImageT>& image )
 {
-    typedef cmp::Unary_Compound_Functor<Channel_Normalize_Functor<typename ImageT::pixel_type>,
+    typedef cmp::Unary_Compound_Functor<typename Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::type,
                                         typename ImageT::pixel_type> func_type;
 
     typedef Channel_Range<typename pix::Image_Channel_Type<ImageT>::type> range_type;
@@ -221,10 +337,11 @@ Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Funct
     
     min_max_channel_values( image, old_min, old_max );
     
-    func_type func( Channel_Normalize_Functor<typename ImageT::pixel_type>( old_min,
+    func_type func( Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::create( old_min,
                                                                             old_max,
                                                                             range_type::min(),
-                                                                            range_type::max() ) );
+                                                                            range_type::max(),
+                                                                            Channel_Normalize_Functor_Type<typename ImageT::pixel_type>::num_values( image ) ) );
     return Per_Pixel_View_Unary<ImageT, func_type >( image.impl(), func );
 }
 
@@ -0,0 +1,117 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Per_Pixel_Accessor_Binary.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <sys/types.h>
+#include <type_traits>
+
+namespace tmns::image::ops {
+
+/**
+ * Pixel accessor for operating on Binary Image-Views.  Both iterators move together.
+*/
+template <typename ImageIter1T,
+          typename ImageIter2T,
+          typename FunctorT>
+class Per_Pixel_Accessor_Binary
+{
+    public:
+
+        /// @brief Result of pixel accessing
+        typedef typename std::invoke_result<FunctorT,
+                                            typename ImageIter1T::pixel_type,
+                                            typename ImageIter2T::pixel_type>::type                result_type;
+
+        /// @brief Pixel Type
+        typedef typename std::remove_cv<typename std::remove_reference<result_type>::type>::type  pixel_type;
+
+        /// @brief Offset Type (Allows floating-point access if parent does too)
+        typedef typename ImageIter1T::offset_type                                                 offset_type;
+
+        /**
+         * Constructor
+         */
+        Per_Pixel_Accessor_Binary( const ImageIter1T&  iter1,
+                                   const ImageIter2T&  iter2,
+                                   const FunctorT&     func )
+          : m_iter1( iter1 ),
+            m_iter2( iter2 ),
+            m_func( func )
+        {
+        }
+
+        /**
+         * Get the next column
+         */
+        Per_Pixel_Accessor_Binary& next_col() { m_iter1.next_col(); m_iter2.next_col(); return (*this); }
+
+        /**
+         * Get the previous column
+         */
+        Per_Pixel_Accessor_Binary& prev_col() { m_iter1.prev_col(); m_iter2.prev_col(); return (*this); }
+
+        /**
+         * Get the next row
+         */
+        Per_Pixel_Accessor_Binary& next_row() { m_iter1.next_row(); m_iter2.next_row(); return (*this); }
+
+        /**
+         * Get the previous row
+         */
+        Per_Pixel_Accessor_Binary& prev_row() { m_iter1.prev_row(); m_iter2.prev_row(); return (*this); }
+
+        /**
+         * Get the next plane
+         */
+        Per_Pixel_Accessor_Binary& next_plane() { m_iter1.next_plane(); m_iter2.next_plane(); return *this; }
+
+        /**
+         * Get the previous plane
+         */
+        Per_Pixel_Accessor_Binary& prev_plane() { m_iter1.prev_plane(); m_iter2.prev_plane(); return *this; }
+
+        /**
+         * Advance the iterator
+         */
+        Per_Pixel_Accessor_Binary& advance( offset_type di,
+                                            offset_type dj,
+                                            ssize_t     dp = 0 )
+        {
+            m_iter1.advance( di, dj, dp );
+            m_iter2.advance( di, dj, dp );
+            return *this;
+        }
+
+        /**
+         * Dereference Operator
+        */
+        result_type operator*() const
+        {
+            return m_func( *m_iter1, *m_iter2 );
+        }
+
+    private:
+
+        /// @brief  Image Iterators
+        ImageIter1T     m_iter1;
+        ImageIter2T     m_iter2;
+
+        /// @brief Function to apply
+        const FunctorT& m_func;
+
+}; // End of Per_Pixel_Accessor_Binary class
+
+} // End of tmns::image::ops namespace
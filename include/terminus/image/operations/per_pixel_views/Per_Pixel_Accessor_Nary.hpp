@@ -0,0 +1,111 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Per_Pixel_Accessor_Nary.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <sys/types.h>
+#include <tuple>
+#include <type_traits>
+
+namespace tmns::image::ops {
+
+/**
+ * Pixel accessor for operating on N-ary Image-Views.  All iterators move together.
+*/
+template <typename FunctorT,
+          typename... ImageItersT>
+class Per_Pixel_Accessor_Nary
+{
+    public:
+
+        /// @brief Result of pixel accessing
+        typedef typename std::invoke_result<FunctorT,typename ImageItersT::pixel_type...>::type   result_type;
+
+        /// @brief Pixel Type
+        typedef typename std::remove_cv<typename std::remove_reference<result_type>::type>::type  pixel_type;
+
+        /// @brief Offset Type (Allows floating-point access if the first parent does too)
+        typedef typename std::tuple_element_t<0,std::tuple<ImageItersT...>>::offset_type          offset_type;
+
+        /**
+         * Constructor
+         */
+        Per_Pixel_Accessor_Nary( const FunctorT&        func,
+                                 const ImageItersT&...  iters )
+          : m_iters( iters... ),
+            m_func( func )
+        {
+        }
+
+        /**
+         * Get the next column
+         */
+        Per_Pixel_Accessor_Nary& next_col() { std::apply( []( auto&... it ){ ( it.next_col(), ... ); }, m_iters ); return (*this); }
+
+        /**
+         * Get the previous column
+         */
+        Per_Pixel_Accessor_Nary& prev_col() { std::apply( []( auto&... it ){ ( it.prev_col(), ... ); }, m_iters ); return (*this); }
+
+        /**
+         * Get the next row
+         */
+        Per_Pixel_Accessor_Nary& next_row() { std::apply( []( auto&... it ){ ( it.next_row(), ... ); }, m_iters ); return (*this); }
+
+        /**
+         * Get the previous row
+         */
+        Per_Pixel_Accessor_Nary& prev_row() { std::apply( []( auto&... it ){ ( it.prev_row(), ... ); }, m_iters ); return (*this); }
+
+        /**
+         * Get the next plane
+         */
+        Per_Pixel_Accessor_Nary& next_plane() { std::apply( []( auto&... it ){ ( it.next_plane(), ... ); }, m_iters ); return *this; }
+
+        /**
+         * Get the previous plane
+         */
+        Per_Pixel_Accessor_Nary& prev_plane() { std::apply( []( auto&... it ){ ( it.prev_plane(), ... ); }, m_iters ); return *this; }
+
+        /**
+         * Advance the iterator
+         */
+        Per_Pixel_Accessor_Nary& advance( offset_type di,
+                                          offset_type dj,
+                                          ssize_t     dp = 0 )
+        {
+            std::apply( [&]( auto&... it ){ ( it.advance( di, dj, dp ), ... ); }, m_iters );
+            return *this;
+        }
+
+        /**
+         * Dereference Operator
+        */
+        result_type operator*() const
+        {
+            return std::apply( [this]( const auto&... it ) -> result_type { return m_func( *it... ); }, m_iters );
+        }
+
+    private:
+
+        /// @brief  Image Iterators
+        std::tuple<ImageItersT...> m_iters;
+
+        /// @brief Function to apply
+        const FunctorT& m_func;
+
+}; // End of Per_Pixel_Accessor_Nary class
+
+} // End of tmns::image::ops namespace
@@ -85,6 +85,16 @@ class Per_Pixel_Accessor_Unary
             return *this;
         }
 
+        /**
+         * Get the child iterator
+        */
+        const ImageIterT& iterator() const { return m_iter; }
+
+        /**
+         * Get the functor
+        */
+        const FunctorT& functor() const { return m_func; }
+
         /**
          * Dereference Operator
         */
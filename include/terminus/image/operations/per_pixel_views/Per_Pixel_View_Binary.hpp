@@ -0,0 +1,202 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Per_Pixel_View_Binary.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "../../types/Image_Base.hpp"
+#include "../../types/Image_Traits.hpp"
+#include "../block/Block_Halo.hpp"
+#include "../rasterize.hpp"
+#include "Per_Pixel_Accessor_Binary.hpp"
+
+// C++ Libraries
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace tmns::image {
+namespace ops {
+
+/**
+ * Class which applies the input functor on every pair of pixels from two images.
+ * Nothing is evaluated until rasterize, so a whole expression is computed in one pass.
+*/
+template <typename Image1T,
+          typename Image2T,
+          typename FunctorT>
+class Per_Pixel_View_Binary : public Image_Base<Per_Pixel_View_Binary<Image1T,Image2T,FunctorT> >
+{
+    public:
+
+        /// Result Type
+        typedef typename std::invoke_result<FunctorT,
+                                            typename Image1T::pixel_type,
+                                            typename Image2T::pixel_type>::type                    result_type;
+
+        /// Pixel Type
+        typedef typename std::remove_cv<typename std::remove_reference<result_type>::type>::type     pixel_type;
+
+        /// Pixel Iterator Type
+        typedef Per_Pixel_Accessor_Binary<typename Image1T::pixel_accessor,
+                                          typename Image2T::pixel_accessor,
+                                          FunctorT>                                                 pixel_accessor;
+
+        /**
+         * Constructor
+         * @param image1
+         * @param image2
+        */
+        Per_Pixel_View_Binary( const Image1T& image1,
+                               const Image2T& image2 )
+          : m_image1( image1 ),
+            m_image2( image2 )
+        {
+            check_sizes();
+        }
+
+        /**
+         * Constructor
+         * @param image1
+         * @param image2
+         * @param func
+         */
+        Per_Pixel_View_Binary( const Image1T&  image1,
+                               const Image2T&  image2,
+                               const FunctorT& func )
+          : m_image1( image1 ),
+            m_image2( image2 ),
+            m_func( func )
+        {
+            check_sizes();
+        }
+
+        /**
+         * Get image columns
+        */
+        size_t cols() const
+        {
+            return m_image1.cols();
+        }
+
+        /**
+         * Get image rows
+        */
+        size_t rows() const
+        {
+            return m_image1.rows();
+        }
+
+        /**
+         * Get image planes
+         */
+        size_t planes() const
+        {
+            return m_image1.planes();
+        }
+
+        /**
+         * Get the origin of the image
+         */
+        pixel_accessor origin() const
+        {
+            return pixel_accessor( m_image1.origin(),
+                                   m_image2.origin(),
+                                   m_func );
+        }
+
+        /**
+         * Apply the functor on a single pixel
+         */
+        result_type operator()( size_t x, size_t y, size_t p = 0 ) const
+        {
+            return m_func( m_image1( x, y, p ),
+                           m_image2( x, y, p ) );
+        }
+
+        /**
+         * Input pixels needed around an output region, covering both images
+        */
+        block::Halo halo() const
+        {
+            return block::Halo::merge( block::image_halo( m_image1 ),
+                                       block::image_halo( m_image2 ) );
+        }
+
+        /**
+         * Pre-reasterize
+        */
+        typedef Per_Pixel_View_Binary<typename Image1T::prerasterize_type,
+                                      typename Image2T::prerasterize_type,
+                                      FunctorT> prerasterize_type;
+        prerasterize_type prerasterize( const math::Rect2i& bbox ) const
+        {
+            return prerasterize_type( m_image1.prerasterize( bbox ),
+                                      m_image2.prerasterize( bbox ),
+                                      m_func );
+        }
+
+        /**
+         * Rasterize the image
+        */
+        template <typename DestT>
+        void rasterize( const DestT&        dest,
+                        const math::Rect2i& bbox ) const
+        {
+            ops::rasterize( prerasterize( bbox ),
+                            dest,
+                            bbox );
+        }
+
+    private:
+
+        /**
+         * Both images must have the same dimensions
+        */
+        void check_sizes() const
+        {
+            if( m_image1.cols()   != m_image2.cols() ||
+                m_image1.rows()   != m_image2.rows() ||
+                m_image1.planes() != m_image2.planes() )
+            {
+                std::stringstream sout;
+                sout << "Per_Pixel_View_Binary: Image arguments must have the same dimensions. Image1: "
+                     << m_image1.cols() << " x " << m_image1.rows() << " x " << m_image1.planes()
+                     << ", Image2: " << m_image2.cols() << " x " << m_image2.rows() << " x "
+                     << m_image2.planes();
+                tmns::log::error( sout.str() );
+                throw std::runtime_error( sout.str() );
+            }
+        }
+
+        /// Images to combine
+        Image1T m_image1;
+        Image2T m_image2;
+
+        /// Function to apply on the pixel pairs
+        FunctorT  m_func;
+}; // End of Per_Pixel_View_Binary class
+
+} // End of ops namespace
+
+/**
+ * Allow multiplication
+*/
+template <typename Image1T,
+          typename Image2T,
+          typename FunctorT>
+struct Is_Multiply_Accessible<ops::Per_Pixel_View_Binary<Image1T,Image2T,FunctorT>>
+       : std::is_reference<typename ops::Per_Pixel_View_Binary<Image1T,Image2T,FunctorT>::result_type>::type {};
+
+} // End of tmns::image namespace
@@ -0,0 +1,184 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Per_Pixel_View_Nary.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "../../types/Image_Base.hpp"
+#include "../../types/Image_Traits.hpp"
+#include "../block/Block_Halo.hpp"
+#include "../rasterize.hpp"
+#include "Per_Pixel_Accessor_Nary.hpp"
+
+// C++ Libraries
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+
+namespace tmns::image {
+namespace ops {
+
+/**
+ * Class which applies the input functor on the matching pixels of any number of
+ * images, e.g. band math across several rasters.  The functor takes one pixel per
+ * image, in order.
+*/
+template <typename FunctorT,
+          typename... ImagesT>
+class Per_Pixel_View_Nary : public Image_Base<Per_Pixel_View_Nary<FunctorT,ImagesT...> >
+{
+    static_assert( sizeof...(ImagesT) > 0, "Per_Pixel_View_Nary needs at least one image" );
+
+    public:
+
+        /// Result Type
+        typedef typename std::invoke_result<FunctorT,typename ImagesT::pixel_type...>::type         result_type;
+
+        /// Pixel Type
+        typedef typename std::remove_cv<typename std::remove_reference<result_type>::type>::type     pixel_type;
+
+        /// Pixel Iterator Type
+        typedef Per_Pixel_Accessor_Nary<FunctorT,typename ImagesT::pixel_accessor...>               pixel_accessor;
+
+        /**
+         * Constructor
+         * @param func
+         * @param images
+         */
+        Per_Pixel_View_Nary( const FunctorT&     func,
+                             const ImagesT&...   images )
+          : m_images( images... ),
+            m_func( func )
+        {
+            check_sizes();
+        }
+
+        /**
+         * Get image columns
+        */
+        size_t cols() const
+        {
+            return std::get<0>( m_images ).cols();
+        }
+
+        /**
+         * Get image rows
+        */
+        size_t rows() const
+        {
+            return std::get<0>( m_images ).rows();
+        }
+
+        /**
+         * Get image planes
+         */
+        size_t planes() const
+        {
+            return std::get<0>( m_images ).planes();
+        }
+
+        /**
+         * Get the origin of the image
+         */
+        pixel_accessor origin() const
+        {
+            return std::apply( [this]( const auto&... image ){ return pixel_accessor( m_func, image.origin()... ); },
+                               m_images );
+        }
+
+        /**
+         * Apply the functor on a single pixel
+         */
+        result_type operator()( size_t x, size_t y, size_t p = 0 ) const
+        {
+            return std::apply( [&]( const auto&... image ) -> result_type { return m_func( image( x, y, p )... ); },
+                               m_images );
+        }
+
+        /**
+         * Input pixels needed around an output region, covering every image
+        */
+        block::Halo halo() const
+        {
+            return std::apply( []( const auto&... image )
+                               {
+                                   block::Halo result;
+                                   ( ( result = block::Halo::merge( result, block::image_halo( image ) ) ), ... );
+                                   return result;
+                               },
+                               m_images );
+        }
+
+        /**
+         * Pre-reasterize
+        */
+        typedef Per_Pixel_View_Nary<FunctorT,typename ImagesT::prerasterize_type...> prerasterize_type;
+        prerasterize_type prerasterize( const math::Rect2i& bbox ) const
+        {
+            return std::apply( [&]( const auto&... image ){ return prerasterize_type( m_func, image.prerasterize( bbox )... ); },
+                               m_images );
+        }
+
+        /**
+         * Rasterize the image
+        */
+        template <typename DestT>
+        void rasterize( const DestT&        dest,
+                        const math::Rect2i& bbox ) const
+        {
+            ops::rasterize( prerasterize( bbox ),
+                            dest,
+                            bbox );
+        }
+
+    private:
+
+        /**
+         * All images must have the same dimensions
+        */
+        void check_sizes() const
+        {
+            bool same = std::apply( [this]( const auto&... image ){
+                return ( ( image.cols()   == cols() &&
+                           image.rows()   == rows() &&
+                           image.planes() == planes() ) && ... );
+            }, m_images );
+            if( !same )
+            {
+                std::stringstream sout;
+                sout << "Per_Pixel_View_Nary: Image arguments must have the same dimensions.";
+                tmns::log::error( sout.str() );
+                throw std::runtime_error( sout.str() );
+            }
+        }
+
+        /// Images to combine
+        std::tuple<ImagesT...> m_images;
+
+        /// Function to apply on the matching pixels
+        FunctorT  m_func;
+}; // End of Per_Pixel_View_Nary class
+
+} // End of ops namespace
+
+/**
+ * Allow multiplication
+*/
+template <typename FunctorT,
+          typename... ImagesT>
+struct Is_Multiply_Accessible<ops::Per_Pixel_View_Nary<FunctorT,ImagesT...>>
+       : std::is_reference<typename ops::Per_Pixel_View_Nary<FunctorT,ImagesT...>::result_type>::type {};
+
+} // End of tmns::image namespace
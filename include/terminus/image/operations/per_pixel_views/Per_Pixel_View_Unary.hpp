@@ -17,6 +17,7 @@
 // Terminus Image Libraries
 #include "../../types/Image_Base.hpp"
 #include "../../types/Image_Traits.hpp"
+#include "../block/Block_Halo.hpp"
 #include "../rasterize.hpp"
 #include "Per_Pixel_Accessor_Unary.hpp"
 
@@ -115,6 +116,14 @@ class Per_Pixel_View_Unary : public Image_Base<Per_Pixel_View_Unary<ImageT,Funct
             return (*this);
         }
 
+        /**
+         * Input pixels needed around an output region
+        */
+        block::Halo halo() const
+        {
+            return block::image_halo( m_image );
+        }
+
         /**
          * Pre-reasterize
         */
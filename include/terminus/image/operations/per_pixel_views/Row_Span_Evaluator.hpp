@@ -0,0 +1,123 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Row_Span_Evaluator.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <iterator>
+#include <span>
+#include <string>
+#include <sys/types.h>
+#include <type_traits>
+#include <vector>
+
+// Terminus Image Libraries
+#include "../../pixel/Pixel_Accessor_MemStride.hpp"
+#include "Per_Pixel_Accessor_Unary.hpp"
+
+namespace tmns::image::ops {
+
+/**
+ * Check if a functor can process a whole row at once, through
+ * `void operator()( std::span<const InT> input, std::span<OutT> output ) const`.
+ * The span form must give the same values as calling the functor per pixel.
+*/
+template <typename FunctorT,
+          typename InT,
+          typename OutT,
+          typename = void>
+struct Has_Span_Operator : std::false_type {};
+
+template <typename FunctorT,
+          typename InT,
+          typename OutT>
+struct Has_Span_Operator<FunctorT,
+                         InT,
+                         OutT,
+                         std::void_t<decltype( std::declval<const FunctorT&>()( std::declval<std::span<const InT>>(),
+                                                                                std::declval<std::span<OutT>>() ) )>>
+    : std::true_type {};
+
+namespace detail {
+
+/**
+ * Evaluates a row of pixels from an accessor in one call, when the accessor chain
+ * bottoms out in contiguous memory and every functor along the way has a span
+ * operator.  Anything else reports `supported == false` and is done per pixel.
+*/
+template <typename AccessorT>
+struct Row_Span_Evaluator
+{
+    static constexpr bool supported = false;
+};
+
+/**
+ * Rows of in-memory images are already contiguous
+*/
+template <typename PixelT>
+struct Row_Span_Evaluator<Pixel_Accessor_MemStride<PixelT>>
+{
+    static constexpr bool supported = true;
+
+    static const PixelT* row( const Pixel_Accessor_MemStride<PixelT>& acc,
+                              size_t                                  /*width*/ )
+    {
+        return &( *acc );
+    }
+
+    static void evaluate( const Pixel_Accessor_MemStride<PixelT>& acc,
+                          size_t                                  width,
+                          PixelT*                                 output )
+    {
+        const PixelT* input = row( acc, width );
+        std::copy( input, input + width, output );
+    }
+};
+
+/**
+ * Per-pixel views evaluate their child's row, then apply the span operator
+*/
+template <typename ImageIterT,
+          typename FunctorT>
+struct Row_Span_Evaluator<Per_Pixel_Accessor_Unary<ImageIterT,FunctorT>>
+{
+    typedef Per_Pixel_Accessor_Unary<ImageIterT,FunctorT> accessor_type;
+    typedef typename ImageIterT::pixel_type               input_type;
+    typedef typename accessor_type::pixel_type            output_type;
+
+    static constexpr bool supported = Row_Span_Evaluator<ImageIterT>::supported &&
+                                      Has_Span_Operator<FunctorT,input_type,output_type>::value;
+
+    static void evaluate( const accessor_type& acc,
+                          size_t               width,
+                          output_type*         output )
+    {
+        const input_type* input = Row_Span_Evaluator<ImageIterT>::row( acc.iterator(), width );
+        acc.functor()( std::span<const input_type>( input, width ),
+                       std::span<output_type>( output, width ) );
+    }
+
+    static const output_type* row( const accessor_type& acc,
+                                   size_t               width )
+    {
+        thread_local std::vector<output_type> scratch;
+        scratch.resize( width );
+        evaluate( acc, width, scratch.data() );
+        return scratch.data();
+    }
+};
+
+} // End of detail namespace
+} // End of tmns::image::ops namespace
@@ -27,9 +27,11 @@ namespace tmns::image::ops {
 */
 template< typename PixelT,
           typename ImageT >
-Per_Pixel_View_Unary<ImageT,pix::Pixel_Cast_Rescale_Functor<PixelT>> pixel_cast_rescale( const Image_Base<ImageT>& image )
+Per_Pixel_View_Unary<ImageT,typename pix::Pixel_Cast_Rescale_Functor_Type<PixelT,typename ImageT::pixel_type>::type>
+    pixel_cast_rescale( const Image_Base<ImageT>& image )
 {
-    return Per_Pixel_View_Unary<ImageT,pix::Pixel_Cast_Rescale_Functor<PixelT>>( image.impl() );
+    typedef typename pix::Pixel_Cast_Rescale_Functor_Type<PixelT,typename ImageT::pixel_type>::type func_type;
+    return Per_Pixel_View_Unary<ImageT,func_type>( image.impl(), func_type() );
 }
 
 
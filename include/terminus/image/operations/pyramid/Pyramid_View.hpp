@@ -0,0 +1,385 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Pyramid_View.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "../../pixel/Pixel_Accessor_Loose.hpp"
+#include "../../types/Image_Base.hpp"
+#include "../block/Block_Generator_Manager.hpp"
+#include "../crop_image.hpp"
+#include "Reduce_View.hpp"
+
+// Terminus Libraries
+#include <terminus/core/cache/Cache_Local.hpp>
+#include <terminus/log/utility.hpp>
+#include <terminus/math/Size.hpp>
+
+// C++ Libraries
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace tmns::image::ops {
+namespace detail {
+
+template <typename ImageT>
+struct Pyramid_State;
+
+} // End of detail namespace
+
+/**
+ * One level of a Pyramid_View.  Level 0 is the base image; each level above it is
+ * the one below reduced by 2.  With a cache, levels are built one block at a time
+ * from the blocks of the level below, and every view of the pyramid shares them.
+*/
+template <typename ImageT>
+class Pyramid_Level_View : public Image_Base<Pyramid_Level_View<ImageT>>
+{
+    public:
+
+        /// Pixel Type
+        typedef typename ImageT::pixel_type pixel_type;
+
+        /// Type returned from pixel operators
+        typedef pixel_type result_type;
+
+        /// Pixel Access Type
+        typedef Pixel_Accessor_Loose<Pyramid_Level_View> pixel_accessor;
+
+        /**
+         * Constructor.  Use Pyramid_View::level() instead.
+        */
+        Pyramid_Level_View( std::shared_ptr<const detail::Pyramid_State<ImageT>> state,
+                            size_t                                               level )
+          : m_state( std::move( state ) ),
+            m_level( level )
+        {}
+
+        /**
+         * Number of image columns
+         */
+        size_t cols() const { return m_state->level_sizes[m_level].width(); }
+
+        /**
+         * Number of image rows
+         */
+        size_t rows() const { return m_state->level_sizes[m_level].height(); }
+
+        /**
+         * Number of image planes
+         */
+        size_t planes() const { return m_state->base.planes(); }
+
+        /**
+         * Get the pyramid level
+        */
+        size_t level() const { return m_level; }
+
+        /**
+         * Get the origin
+        */
+        pixel_accessor origin() const
+        {
+            return pixel_accessor( *this, 0, 0, 0 );
+        }
+
+        /**
+         * Fetch a single pixel.  Not recommended.
+         */
+        result_type operator()( size_t c,
+                                size_t r,
+                                size_t p = 0 ) const
+        {
+            if( m_level == 0 )
+            {
+                return m_state->base( c, r, p );
+            }
+            if( !m_state->cache )
+            {
+                return ( *m_state->reducers[m_level - 1] )( c, r, p );
+            }
+
+            const auto& manager = m_state->managers[m_level - 1];
+            auto block_index    = manager.get_block_index( math::Point2i( { int( c ), int( r ) } ) );
+            auto start_pixel    = manager.get_block_start_pixel( block_index );
+            const auto& handle  = manager.block( block_index );
+            result_type result  = handle->operator()( c - start_pixel.x(),
+                                                      r - start_pixel.y(),
+                                                      p );
+            handle.release();
+            return result;
+        }
+
+        typedef Crop_View<Image_Memory<pixel_type>> prerasterize_type;
+        prerasterize_type prerasterize( const math::Rect2i& bbox ) const
+        {
+            // Init output data
+            Image_Memory<pixel_type> buffer( bbox.width(),
+                                             bbox.height(),
+                                             planes() );
+
+            // Fill in the output data from this view
+            rasterize( buffer, bbox );
+
+            // "Fake" the bbox image so it looks like a full size image.
+            return Crop_View<Image_Memory<pixel_type>>( buffer,
+                                                        math::Rect2i( -bbox.min().x(),
+                                                                      -bbox.min().y(),
+                                                                      cols(),
+                                                                      rows() ) );
+        }
+
+        /**
+         * Copy a region into the destination, generating any missing blocks
+        */
+        template <class DestT>
+        void rasterize( const DestT&        dest,
+                        const math::Rect2i& bbox ) const
+        {
+            if( m_level == 0 )
+            {
+                m_state->base.rasterize( dest, bbox );
+                return;
+            }
+            if( !m_state->cache )
+            {
+                m_state->reducers[m_level - 1]->rasterize( dest, bbox );
+                return;
+            }
+
+            const auto& manager = m_state->managers[m_level - 1];
+            const auto& bsize   = m_state->block_size;
+            int bx0 = bbox.min().x() / bsize.width();
+            int by0 = bbox.min().y() / bsize.height();
+            int bx1 = ( bbox.min().x() + bbox.width()  - 1 ) / bsize.width();
+            int by1 = ( bbox.min().y() + bbox.height() - 1 ) / bsize.height();
+            for( int by = by0; by <= by1; ++by )
+            for( int bx = bx0; bx <= bx1; ++bx )
+            {
+                math::Point2i block_index( { bx, by } );
+                auto start_pixel = manager.get_block_start_pixel( block_index );
+                auto region = math::Rect2i::intersection( math::Rect2i( start_pixel.x(),
+                                                                        start_pixel.y(),
+                                                                        bsize.width(),
+                                                                        bsize.height() ),
+                                                          bbox );
+
+                const auto& handle = manager.block( block_index );
+                handle->rasterize( crop_image( dest, region - bbox.min() ),
+                                   region - start_pixel );
+                handle.release();
+            }
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Pyramid_Level_View";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + ImageT::full_name() + ">";
+        }
+
+    private:
+
+        /// Shared pyramid data
+        std::shared_ptr<const detail::Pyramid_State<ImageT>> m_state;
+
+        /// Level of this view
+        size_t m_level;
+
+}; // End of Pyramid_Level_View Class
+
+namespace detail {
+
+/**
+ * Everything the levels of one pyramid share
+*/
+template <typename ImageT>
+struct Pyramid_State
+{
+    typedef Reduce_View<Pyramid_Level_View<ImageT>> reduce_type;
+
+    Pyramid_State( const ImageT&                   image,
+                   core::cache::Cache_Local::ptr_t cache_,
+                   const math::Size2i&             block_size_ )
+      : base( image ),
+        cache( std::move( cache_ ) ),
+        block_size( block_size_ )
+    {}
+
+    /// Level 0
+    ImageT base;
+
+    /// Block cache.  Null to recompute levels on every request.
+    core::cache::Cache_Local::ptr_t cache;
+
+    /// Size of cached blocks
+    math::Size2i block_size;
+
+    /// Size of each level
+    std::vector<math::Size2i> level_sizes;
+
+    /// Builds level k from level k-1, at index k-1
+    std::vector<std::shared_ptr<reduce_type>> reducers;
+
+    /// Cached blocks of level k, at index k-1
+    std::vector<block::Block_Generator_Manager<reduce_type>> managers;
+
+}; // End of Pyramid_State struct
+
+} // End of detail namespace
+
+/**
+ * Multi-resolution pyramid over an image.  Levels are lazy views; nothing is
+ * computed until a region of a level is rasterized, and then only the blocks under
+ * that region (and the blocks below them) are built.  Blocks live in the cache, so
+ * consumers sharing the pyramid, or copies of it, reuse each other's work.
+ *
+ * The base image must be safe to read from several threads if levels are.
+*/
+template <typename ImageT>
+class Pyramid_View
+{
+    public:
+
+        /// View type for a level
+        typedef Pyramid_Level_View<ImageT> level_type;
+
+        /**
+         * Constructor
+         * @param image      Base image
+         * @param cache      Block cache.  Null computes levels on every request.
+         * @param filter     Reduction filter
+         * @param num_levels Levels including the base.  0 keeps reducing down to a
+         *                   single pixel.
+         * @param block_size Size of cached blocks
+        */
+        Pyramid_View( const ImageT&                   image,
+                      core::cache::Cache_Local::ptr_t cache,
+                      Pyramid_Filter                  filter     = Pyramid_Filter::GAUSSIAN,
+                      size_t                          num_levels = 0,
+                      const math::Size2i&             block_size = math::Size2i( { 256, 256 } ) )
+          : m_filter( filter )
+        {
+            if( block_size.width() <= 0 || block_size.height() <= 0 )
+            {
+                std::stringstream sout;
+                sout << "Pyramid_View: Illegal block size: " << block_size.to_string();
+                log::error( sout.str() );
+                throw std::runtime_error( sout.str() );
+            }
+
+            auto state = std::make_shared<detail::Pyramid_State<ImageT>>( image, cache, block_size );
+
+            // Level sizes, halving (rounding up) each time
+            math::Size2i size( { int( image.cols() ), int( image.rows() ) } );
+            state->level_sizes.push_back( size );
+            while( ( num_levels == 0 && ( size.width() > 1 || size.height() > 1 ) ) ||
+                   state->level_sizes.size() < num_levels )
+            {
+                size = math::Size2i( { ( size.width() + 1 ) / 2, ( size.height() + 1 ) / 2 } );
+                state->level_sizes.push_back( size );
+            }
+
+            // The reducers live inside the state, so their views of the level below
+            // hold it without ownership.  Otherwise the state could never be freed.
+            std::shared_ptr<const detail::Pyramid_State<ImageT>> unowned( std::shared_ptr<const detail::Pyramid_State<ImageT>>(),
+                                                                          state.get() );
+            state->managers.resize( state->level_sizes.size() - 1 );
+            for( size_t k = 1; k < state->level_sizes.size(); ++k )
+            {
+                auto reducer = std::make_shared<typename detail::Pyramid_State<ImageT>::reduce_type>( level_type( unowned, k - 1 ),
+                                                                                                      filter );
+                state->reducers.push_back( reducer );
+                if( cache )
+                {
+                    auto res = state->managers[k - 1].initialize( cache, block_size, reducer );
+                    if( res.has_error() )
+                    {
+                        log::error( "Pyramid_View: Unable to set up level ", k, ": ", res.error().message() );
+                        throw std::runtime_error( res.error().message() );
+                    }
+                }
+            }
+            m_state = state;
+        }
+
+        /**
+         * Number of levels, including the base
+        */
+        size_t num_levels() const { return m_state->level_sizes.size(); }
+
+        /**
+         * Get a level as a view.  Level 0 is the base image.
+         * @throws std::runtime_error if the level does not exist
+        */
+        level_type level( size_t k ) const
+        {
+            if( k >= num_levels() )
+            {
+                std::stringstream sout;
+                sout << "Pyramid_View: Level " << k << " requested, but only " << num_levels() << " exist";
+                log::error( sout.str() );
+                throw std::runtime_error( sout.str() );
+            }
+            return level_type( m_state, k );
+        }
+
+        /**
+         * Get the base image
+        */
+        const ImageT& base() const { return m_state->base; }
+
+        /**
+         * Get the reduction filter
+        */
+        Pyramid_Filter filter() const { return m_filter; }
+
+        /**
+         * Get the block size
+        */
+        const math::Size2i& block_size() const { return m_state->block_size; }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Pyramid_View";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + ImageT::full_name() + ">";
+        }
+
+    private:
+
+        /// Levels, blocks and cache, shared with every level view
+        std::shared_ptr<const detail::Pyramid_State<ImageT>> m_state;
+
+        /// Reduction filter
+        Pyramid_Filter m_filter;
+
+}; // End of Pyramid_View Class
+
+} // End of tmns::image::ops namespace
@@ -0,0 +1,231 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Reduce_View.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "../../pixel/Pixel_Accessor_Loose.hpp"
+#include "../../types/Image_Base.hpp"
+#include "../../types/Image_Memory.hpp"
+#include "../../types/Image_Memory_Policy.hpp"
+#include "../crop_image.hpp"
+#include "../transform/Interpolation.hpp"
+
+// C++ Libraries
+#include <algorithm>
+#include <string>
+
+namespace tmns::image {
+namespace ops {
+
+/**
+ * Filter applied before dropping every other row and column
+*/
+enum class Pyramid_Filter
+{
+    BOX      = 0 /**< Average of each 2x2 block */,
+    GAUSSIAN = 1 /**< 5x5 binomial (1 4 6 4 1) kernel, as in Burt-Adelson pyramids */,
+}; // End of Pyramid_Filter enum
+
+/**
+ * Reduces an image by a factor of 2 in each direction.  Odd sizes round up, and
+ * pixels past the edge repeat the edge.
+ *
+ * Rasterizing a region reads only the matching region of the child (plus the
+ * filter's border), so chains of these stay proportional to the area requested.
+*/
+template <typename ImageT>
+class Reduce_View : public Image_Base<Reduce_View<ImageT>>
+{
+    public:
+
+        /// Pixel Type
+        typedef typename ImageT::pixel_type pixel_type;
+
+        /// Type returned from pixel operators
+        typedef pixel_type result_type;
+
+        /// Pixel Access Type
+        typedef Pixel_Accessor_Loose<Reduce_View> pixel_accessor;
+
+        /**
+         * Constructor
+        */
+        Reduce_View( const ImageT&  image,
+                     Pyramid_Filter filter = Pyramid_Filter::GAUSSIAN )
+          : m_image( image ),
+            m_filter( filter )
+        {}
+
+        /**
+         * Number of image columns
+         */
+        size_t cols() const { return ( m_image.cols() + 1 ) / 2; }
+
+        /**
+         * Number of image rows
+         */
+        size_t rows() const { return ( m_image.rows() + 1 ) / 2; }
+
+        /**
+         * Number of image planes
+         */
+        size_t planes() const { return m_image.planes(); }
+
+        /**
+         * Get the origin
+        */
+        pixel_accessor origin() const
+        {
+            return pixel_accessor( *this, 0, 0, 0 );
+        }
+
+        /**
+         * Compute a single pixel straight from the child
+         */
+        result_type operator()( size_t c,
+                                size_t r,
+                                size_t p = 0 ) const
+        {
+            return reduce_pixel( m_image, 0, 0, c, r, p );
+        }
+
+        /**
+         * Get the child image
+        */
+        const ImageT& child() const { return m_image; }
+
+        /**
+         * Get the filter
+        */
+        Pyramid_Filter filter() const { return m_filter; }
+
+        typedef Crop_View<Image_Memory<pixel_type>> prerasterize_type;
+        prerasterize_type prerasterize( const math::Rect2i& bbox ) const
+        {
+            // Child pixels under the filter, clipped to the child
+            int before = ( m_filter == Pyramid_Filter::GAUSSIAN ) ? 2 : 0;
+            int after  = ( m_filter == Pyramid_Filter::GAUSSIAN ) ? 2 : 1;
+            int x0 = std::max( 2 * bbox.min().x() - before, 0 );
+            int y0 = std::max( 2 * bbox.min().y() - before, 0 );
+            int x1 = std::min( 2 * ( bbox.min().x() + bbox.width()  - 1 ) + after + 1, int( m_image.cols() ) );
+            int y1 = std::min( 2 * ( bbox.min().y() + bbox.height() - 1 ) + after + 1, int( m_image.rows() ) );
+
+            Image_Memory<pixel_type> source( x1 - x0,
+                                             y1 - y0,
+                                             planes(),
+                                             tile_memory_policy() );
+            m_image.rasterize( source, math::Rect2i( x0, y0, x1 - x0, y1 - y0 ) );
+
+            Image_Memory<pixel_type> buffer( bbox.width(),
+                                             bbox.height(),
+                                             planes() );
+            for( size_t p = 0; p < planes(); ++p )
+            for( int r = 0; r < bbox.height(); ++r )
+            for( int c = 0; c < bbox.width(); ++c )
+            {
+                buffer( c, r, p ) = reduce_pixel( source,
+                                                  x0,
+                                                  y0,
+                                                  bbox.min().x() + c,
+                                                  bbox.min().y() + r,
+                                                  p );
+            }
+
+            // "Fake" the bbox image so it looks like a full size image.
+            return Crop_View<Image_Memory<pixel_type>>( buffer,
+                                                        math::Rect2i( -bbox.min().x(),
+                                                                      -bbox.min().y(),
+                                                                      cols(),
+                                                                      rows() ) );
+        }
+
+        template <class DestT>
+        void rasterize( const DestT&        dest,
+                        const math::Rect2i& bbox ) const
+        {
+            ops::rasterize( prerasterize( bbox ), dest, bbox );
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Reduce_View";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + ImageT::full_name() + ">";
+        }
+
+    private:
+
+        /**
+         * Filter around child pixel (2c, 2r)
+         * @param src    Child pixels, starting at child pixel (x0, y0)
+        */
+        template <typename SourceT>
+        pixel_type reduce_pixel( const SourceT& src,
+                                 int            x0,
+                                 int            y0,
+                                 size_t         c,
+                                 size_t         r,
+                                 size_t         p ) const
+        {
+            static constexpr double BOX_WEIGHTS[]      = { 0.5, 0.5 };
+            static constexpr double GAUSSIAN_WEIGHTS[] = { 1 / 16.0, 4 / 16.0, 6 / 16.0, 4 / 16.0, 1 / 16.0 };
+
+            bool gaussian = ( m_filter == Pyramid_Filter::GAUSSIAN );
+            const double* weights = gaussian ? GAUSSIAN_WEIGHTS : BOX_WEIGHTS;
+            int taps   = gaussian ? 5 : 2;
+            int offset = gaussian ? -2 : 0;
+            int max_c  = int( m_image.cols() ) - 1;
+            int max_r  = int( m_image.rows() ) - 1;
+
+            detail::Pixel_Accumulator<pixel_type> acc;
+            for( int j = 0; j < taps; ++j )
+            {
+                int sr = std::clamp( int( 2 * r ) + offset + j, 0, max_r ) - y0;
+                for( int i = 0; i < taps; ++i )
+                {
+                    int sc = std::clamp( int( 2 * c ) + offset + i, 0, max_c ) - x0;
+                    acc.add( src( sc, sr, p ), weights[i] * weights[j] );
+                }
+            }
+            return acc.value();
+        }
+
+        /// Source image
+        ImageT m_image;
+
+        /// Reduction filter
+        Pyramid_Filter m_filter;
+
+}; // End of Reduce_View Class
+
+} // End of ops namespace
+
+/**
+ * Reduce an image by a factor of 2 in each direction
+*/
+template <typename ImageT>
+ops::Reduce_View<ImageT> reduce_image( const Image_Base<ImageT>& image,
+                                       ops::Pyramid_Filter       filter = ops::Pyramid_Filter::GAUSSIAN )
+{
+    return ops::Reduce_View<ImageT>( image.impl(), filter );
+}
+
+} // End of tmns::image namespace
@@ -15,55 +15,106 @@
 #pragma once
 
 // Terminus Methods
+#include <terminus/core/work/Thread.hpp>
 #include <terminus/log/utility.hpp>
 #include <terminus/math/Rectangle.hpp>
 
 // Terminus Image Methods
 #include "../types/Image_Traits.hpp"
+#include "detail/Parallel_Band.hpp"
+#include "per_pixel_views/Row_Span_Evaluator.hpp"
+
+// C++ Libraries
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace tmns::image::ops {
 
+/**
+ * Controls when `rasterize()` splits the destination into row bands and evaluates
+ * them on separate threads.  Off by default, since every view in the expression must
+ * then be safe to read from several threads at once.  Memory images and the per-pixel
+ * views are; views with their own caches should be wrapped in a Block_Rasterize_View.
+*/
+struct Rasterize_Parallel_Settings
+{
+    /// Max threads to use.  0 uses the hardware concurrency, 1 disables threading.
+    size_t num_threads { 1 };
+
+    /// Regions with fewer pixels (cols x rows x planes) than this are rasterized serially
+    size_t min_pixels { 512 * 512 };
+
+    /// Each thread gets at least this many rows
+    size_t min_rows_per_thread { 16 };
+
+    /**
+     * Get the number of threads to use for a region of this size
+    */
+    size_t thread_count( const math::Rect2i& bbox,
+                         size_t              planes ) const
+    {
+        size_t rows   = bbox.height();
+        size_t pixels = size_t( bbox.width() ) * rows * planes;
+        if( num_threads == 1 || pixels < min_pixels || rows < 2 )
+        {
+            return 1;
+        }
+
+        size_t threads = ( num_threads == 0 ) ? std::max<size_t>( std::thread::hardware_concurrency(), 1 )
+                                              : num_threads;
+        size_t max_by_rows = rows / std::max<size_t>( min_rows_per_thread, 1 );
+        return std::max<size_t>( std::min( threads, max_by_rows ), 1 );
+    }
+
+}; // End of Rasterize_Parallel_Settings struct
+
+namespace detail {
+
+/// Guards the default parallel settings
+inline std::mutex g_rasterize_parallel_mtx;
+
+/// Default parallel settings
+inline Rasterize_Parallel_Settings g_rasterize_parallel_settings;
 
 /**
- * Master Rasterization Function
- *
- * This is called by views that do not have specially optimized rasterization
- * methods.  The user can also call it explicitly when pixel-by-pixel rasterization
- * is preferred to the default optimized rasterization behavior.  This can be useful
- * in some cases, such as when the views are heavily subsampled.
- */
+ * Copy rows [start_row, start_row + num_rows) of the bbox into the same rows of the
+ * destination.
+*/
 template <class SrcT, class DestT>
-void rasterize( const SrcT&          src,
-                const DestT&         dest,
-                const math::Rect2i&  bbox )
+void rasterize_rows( const SrcT&          src,
+                     const DestT&         dest,
+                     const math::Rect2i&  bbox,
+                     int                  start_row,
+                     int                  num_rows )
 {
     typedef typename DestT::pixel_type     DestPixelT;
     typedef typename SrcT::pixel_accessor  SrcAccT;
     typedef typename DestT::pixel_accessor DestAccT;
 
-    // Sanity Checks
-    if( ((int)dest.cols()) != bbox.width() ||
-        ((int)dest.rows()) != bbox.height() ||
-        dest.planes()      != src.planes() )
-    {
-        std::stringstream sout;
-        sout << "rasterize: Source and destination must have same dimensions. Source: "
-            << src.cols() << " x " << src.rows() << ", Dest: " << dest.cols() << " x "
-            << dest.rows();
-
-        tmns::log::error( sout.str() );
-        throw std::runtime_error( sout.str() );
-    }
-
     // Get the plane data
-    SrcAccT  splane = src.origin().advance(bbox.min().x(),bbox.min().y());
-    DestAccT dplane = dest.origin();
+    SrcAccT  splane = src.origin().advance( bbox.min().x(), bbox.min().y() + start_row );
+    DestAccT dplane = dest.origin().advance( 0, start_row );
     for( int plane=src.planes(); plane; --plane )
     {
         SrcAccT  srow = splane;
         DestAccT drow = dplane;
-        for( int row=bbox.height(); row; --row )
+        for( int row=num_rows; row; --row )
         {
+            // Whole rows at once when the source and destination are both in memory
+            if constexpr( Row_Span_Evaluator<SrcAccT>::supported &&
+                          std::is_same_v<DestAccT,Pixel_Accessor_MemStride<DestPixelT>> &&
+                          std::is_same_v<DestPixelT,typename SrcAccT::pixel_type> )
+            {
+                Row_Span_Evaluator<SrcAccT>::evaluate( srow, bbox.width(), &( *drow ) );
+                srow.next_row();
+                drow.next_row();
+                continue;
+            }
+
             SrcAccT  scol = srow;
             DestAccT dcol = drow;
             for( int col = bbox.width(); col; --col )
@@ -88,6 +139,186 @@ void rasterize( const SrcT&          src,
     }
 }
 
+/**
+ * Evaluates one row band.  The band is prerasterized on its own, so any work a view
+ * does up front is split across the threads too.
+*/
+template <class SrcT, class DestT>
+class Rasterize_Band_Task
+{
+    public:
+
+        Rasterize_Band_Task( const SrcT&          src,
+                             const DestT&         dest,
+                             const math::Rect2i&  bbox,
+                             int                  start_row,
+                             int                  num_rows )
+          : m_src( src ),
+            m_dest( dest ),
+            m_bbox( bbox ),
+            m_start_row( start_row ),
+            m_num_rows( num_rows ) {}
+
+        void operator()()
+        {
+            bool in_band = g_rasterize_in_band;
+            g_rasterize_in_band = true;
+            try
+            {
+                math::Rect2i band_bbox( m_bbox.min().x(),
+                                        m_bbox.min().y() + m_start_row,
+                                        m_bbox.width(),
+                                        m_num_rows );
+                rasterize_rows( m_src.prerasterize( band_bbox ),
+                                m_dest,
+                                m_bbox,
+                                m_start_row,
+                                m_num_rows );
+            }
+            catch( ... )
+            {
+                m_error = std::current_exception();
+            }
+            g_rasterize_in_band = in_band;
+        }
+
+        const std::exception_ptr& error() const
+        {
+            return m_error;
+        }
+
+    private:
+
+        const SrcT&         m_src;
+        const DestT&        m_dest;
+        math::Rect2i        m_bbox;
+        int                 m_start_row;
+        int                 m_num_rows;
+        std::exception_ptr  m_error;
+
+}; // End of Rasterize_Band_Task class
+
+} // End of detail namespace
+
+/**
+ * Get the default settings used by `rasterize()`
+*/
+inline Rasterize_Parallel_Settings rasterize_parallel_settings()
+{
+    std::unique_lock<std::mutex> lck( detail::g_rasterize_parallel_mtx );
+    return detail::g_rasterize_parallel_settings;
+}
+
+/**
+ * Set the default settings used by `rasterize()`.  Set `num_threads` to anything
+ * other than 1 to turn on parallel rasterization for every view.
+*/
+inline void set_rasterize_parallel_settings( const Rasterize_Parallel_Settings& settings )
+{
+    std::unique_lock<std::mutex> lck( detail::g_rasterize_parallel_mtx );
+    detail::g_rasterize_parallel_settings = settings;
+}
+
+/**
+ * Resolve the thread count for a view that threads its own work.  0 falls back to the
+ * global `rasterize_parallel_settings()`, and inside a parallel rasterize it is always 1.
+*/
+inline size_t rasterize_thread_count( size_t num_threads )
+{
+    if( detail::g_rasterize_in_band )
+    {
+        return 1;
+    }
+    if( num_threads == 0 )
+    {
+        num_threads = rasterize_parallel_settings().num_threads;
+    }
+    return ( num_threads == 0 ) ? std::max<size_t>( std::thread::hardware_concurrency(), 1 )
+                                : num_threads;
+}
+
+/**
+ * Master Rasterization Function
+ *
+ * This is called by views that do not have specially optimized rasterization
+ * methods.  The user can also call it explicitly when pixel-by-pixel rasterization
+ * is preferred to the default optimized rasterization behavior.  This can be useful
+ * in some cases, such as when the views are heavily subsampled.
+ *
+ * Large regions are split into row bands and evaluated on separate threads per the
+ * settings.  Calls made while evaluating a band always run serially.
+ */
+template <class SrcT, class DestT>
+void rasterize( const SrcT&                         src,
+                const DestT&                        dest,
+                const math::Rect2i&                 bbox,
+                const Rasterize_Parallel_Settings&  settings )
+{
+    // Sanity Checks
+    if( ((int)dest.cols()) != bbox.width() ||
+        ((int)dest.rows()) != bbox.height() ||
+        dest.planes()      != src.planes() )
+    {
+        std::stringstream sout;
+        sout << "rasterize: Source and destination must have same dimensions. Source: "
+            << src.cols() << " x " << src.rows() << ", Dest: " << dest.cols() << " x "
+            << dest.rows();
+
+        tmns::log::error( sout.str() );
+        throw std::runtime_error( sout.str() );
+    }
+
+    size_t num_threads = detail::g_rasterize_in_band ? 1 : settings.thread_count( bbox, src.planes() );
+    if( num_threads <= 1 )
+    {
+        detail::rasterize_rows( src, dest, bbox, 0, bbox.height() );
+        return;
+    }
+
+    // Split rows evenly.  The caller's thread takes the first band.
+    typedef detail::Rasterize_Band_Task<SrcT,DestT> Task_Type;
+    std::vector<std::shared_ptr<Task_Type>> tasks;
+    size_t rows = bbox.height();
+    for( size_t i = 0; i < num_threads; ++i )
+    {
+        size_t start_row = ( rows * i ) / num_threads;
+        size_t end_row   = ( rows * ( i + 1 ) ) / num_threads;
+        tasks.push_back( std::make_shared<Task_Type>( src, dest, bbox, start_row, end_row - start_row ) );
+    }
+
+    std::vector<std::shared_ptr<core::work::Thread>> threads;
+    for( size_t i = 1; i < tasks.size(); ++i )
+    {
+        threads.push_back( std::make_shared<core::work::Thread>( tasks[i] ) );
+    }
+    ( *tasks[0] )();
+
+    for( auto& thread : threads )
+    {
+        thread->join();
+    }
+
+    // Rethrow the first failing band so errors don't depend on thread timing
+    for( const auto& task : tasks )
+    {
+        if( task->error() )
+        {
+            std::rethrow_exception( task->error() );
+        }
+    }
+}
+
+/**
+ * Rasterize with the default parallel settings
+*/
+template <class SrcT, class DestT>
+void rasterize( const SrcT&          src,
+                const DestT&         dest,
+                const math::Rect2i&  bbox )
+{
+    rasterize( src, dest, bbox, rasterize_parallel_settings() );
+}
+
 /**
  * Helper function to rasterize the entire source image
 */
@@ -15,6 +15,7 @@
 #pragma once
 
 // Terminus Image Libraries
+#include "block/Block_Halo.hpp"
 #include "rasterize.hpp"
 
 namespace tmns::image::ops {
@@ -110,6 +111,14 @@ class Select_Plane_View : public Image_Base<Select_Plane_View<ImageT> >
             return *this;
         }
 
+        /**
+         * Input pixels needed around an output region
+        */
+        block::Halo halo() const
+        {
+            return block::image_halo( m_child );
+        }
+
         /**
          * Pre-rasterize image
         */
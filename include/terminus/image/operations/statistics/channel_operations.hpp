@@ -18,8 +18,14 @@
 #include <terminus/image/pixel/Channel_Cast_Utilities.hpp>
 #include <terminus/image/pixel/Pixel_Cast_Utilities.hpp>
 #include <terminus/image/types/for_each_pixel.hpp>
+#include <terminus/math/types/Functors.hpp>
 #include <terminus/math/types/Math_Functors.hpp>
 
+// C++ Libraries
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
 namespace tmns {
 namespace image::ops {
 /**
@@ -42,6 +48,158 @@ class Channel_Accumulator : public AccumulatorT
         }
 }; // End of Channel_Accumulator class
 
+/**
+ * Channel min/max accumulator which can be merged, so for_each_pixel() can split
+ * it across threads.
+*/
+template <typename ValueT>
+class Channel_Min_Max_Accumulator : public math::Return_Fixed_Type<void>
+{
+    public:
+
+        /**
+         * Add another value
+        */
+        void operator()( const ValueT& value )
+        {
+            if( !m_valid )
+            {
+                m_min   = value;
+                m_max   = value;
+                m_valid = true;
+            }
+            else if( value < m_min )
+            {
+                m_min = value;
+            }
+            else if( value > m_max )
+            {
+                m_max = value;
+            }
+        }
+
+        /**
+         * Fold in the values seen by another accumulator
+        */
+        void merge( const Channel_Min_Max_Accumulator& other )
+        {
+            if( other.m_valid )
+            {
+                ( *this )( other.m_min );
+                ( *this )( other.m_max );
+            }
+        }
+
+        /**
+         * Get the minimum value
+        */
+        ValueT minimum() const
+        {
+            check_valid();
+            return m_min;
+        }
+
+        /**
+         * Get the maximum value
+        */
+        ValueT maximum() const
+        {
+            check_valid();
+            return m_max;
+        }
+
+    private:
+
+        void check_valid() const
+        {
+            if( !m_valid )
+            {
+                std::stringstream sout;
+                sout << "Channel_Min_Max_Accumulator: no samples provided.";
+                tmns::log::error( sout.str() );
+                throw std::runtime_error( sout.str() );
+            }
+        }
+
+        ValueT m_min {};
+        ValueT m_max {};
+        bool   m_valid { false };
+
+}; // End of Channel_Min_Max_Accumulator class
+
+/**
+ * Channel mean and standard deviation accumulator.  Uses Welford's update, and Chan's
+ * formula to merge, so splitting across threads doesn't cost precision.
+*/
+template <typename ValueT>
+class Channel_Moments_Accumulator : public math::Return_Fixed_Type<void>
+{
+    public:
+
+        /**
+         * Add another value
+        */
+        void operator()( const ValueT& value )
+        {
+            m_count += 1;
+            double delta = double( value ) - m_mean;
+            m_mean += delta / m_count;
+            m_m2   += delta * ( double( value ) - m_mean );
+        }
+
+        /**
+         * Fold in the values seen by another accumulator
+        */
+        void merge( const Channel_Moments_Accumulator& other )
+        {
+            if( other.m_count == 0 )
+            {
+                return;
+            }
+            double count = m_count + other.m_count;
+            double delta = other.m_mean - m_mean;
+            m_mean  += delta * other.m_count / count;
+            m_m2    += other.m_m2 + delta * delta * m_count * other.m_count / count;
+            m_count  = count;
+        }
+
+        /**
+         * Get the mean
+        */
+        double mean() const
+        {
+            check_valid();
+            return m_mean;
+        }
+
+        /**
+         * Get the total (not sample) standard deviation
+        */
+        double stddev() const
+        {
+            check_valid();
+            return std::sqrt( m_m2 / m_count );
+        }
+
+    private:
+
+        void check_valid() const
+        {
+            if( m_count == 0 )
+            {
+                std::stringstream sout;
+                sout << "Channel_Moments_Accumulator: no samples provided.";
+                tmns::log::error( sout.str() );
+                throw std::runtime_error( sout.str() );
+            }
+        }
+
+        double m_count { 0 };
+        double m_mean { 0 };
+        double m_m2 { 0 };
+
+}; // End of Channel_Moments_Accumulator class
+
 /**
  * Locate the minimum value of of all channels stored in all planes of the 
  * image
@@ -51,7 +209,7 @@ typename pix::Pixel_Channel_Type<typename ImageT::pixel_type>::type
     min_channel_value( const Image_Base<ImageT>& image )
 {
     typedef typename pix::Pixel_Channel_Type<typename ImageT::pixel_type>::type accum_type;
-    Channel_Accumulator<math::Min_Max_Accumulator<accum_type> > accumulator;
+    Channel_Accumulator<Channel_Min_Max_Accumulator<accum_type> > accumulator;
     core::utility::Progress_Callback_Null junk_callback;
     for_each_pixel( image, accumulator, junk_callback );
     return accumulator.minimum();
@@ -65,7 +223,7 @@ typename pix::Pixel_Channel_Type<typename ImageT::pixel_type>::type
     max_channel_value( const Image_Base<ImageT>& image )
 {
     typedef typename pix::Pixel_Channel_Type<typename ImageT::pixel_type>::type accum_type;
-    Channel_Accumulator<math::Min_Max_Accumulator<accum_type> > accumulator;
+    Channel_Accumulator<Channel_Min_Max_Accumulator<accum_type> > accumulator;
     core::utility::Progress_Callback_Null junk_callback;
     for_each_pixel( image, accumulator, junk_callback );
     return accumulator.maximum();
@@ -81,7 +239,7 @@ void min_max_channel_values( const Image_Base<ImageT>&
                              typename pix::Pixel_Channel_Type<typename ImageT::pixel_type>::type& max )
 {
     typedef typename pix::Pixel_Channel_Type<typename ImageT::pixel_type>::type accum_type;
-    Channel_Accumulator<math::Min_Max_Accumulator<accum_type> > accumulator;
+    Channel_Accumulator<Channel_Min_Max_Accumulator<accum_type> > accumulator;
     core::utility::Progress_Callback_Null junk_callback;
     for_each_pixel( image, accumulator, junk_callback );
     min = accumulator.minimum();
@@ -117,9 +275,9 @@ template <typename ImageT>
 double mean_channel_value( const Image_Base<ImageT>& image )
 {
     typedef typename pix::Pixel_Channel_Type<typename ImageT::pixel_type>::type accum_type;
-    Channel_Accumulator<math::Mean_Accumulator<accum_type> > accumulator;
+    Channel_Accumulator<Channel_Moments_Accumulator<accum_type> > accumulator;
     for_each_pixel( image, accumulator );
-    return accumulator.value();
+    return accumulator.mean();
 }
 
 /**
@@ -139,9 +297,9 @@ template <typename ImageT>
 double stddev_channel_value( const Image_Base<ImageT>& image )
 {
     typedef typename pix::Pixel_Channel_Type<typename ImageT::pixel_type>::type channel_type;
-    Channel_Accumulator<math::Std_Dev_Accumulator<channel_type> > accumulator;
+    Channel_Accumulator<Channel_Moments_Accumulator<channel_type> > accumulator;
     for_each_pixel( image, accumulator );
-    return accumulator.value();
+    return accumulator.stddev();
 }
 
 /**
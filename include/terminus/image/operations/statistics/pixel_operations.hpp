@@ -22,6 +22,7 @@
 #include <terminus/math/types/Functors.hpp>
 
 // C++ Libraries
+#include <algorithm>
 #include <vector>
 
 namespace tmns::image::ops {
@@ -66,6 +67,27 @@ class EW_Min_Max_Accumulator : public math::Return_Fixed_Type<void>
             }
         }
 
+        /**
+         * Fold in the values seen by another accumulator
+        */
+        void merge( const EW_Min_Max_Accumulator& other )
+        {
+            if( !other.m_valid )
+            {
+                return;
+            }
+            if( !m_valid )
+            {
+                *this = other;
+                return;
+            }
+            for( size_t i = 0; i < math::Compound_Channel_Count<ValueT>::value; i++ )
+            {
+                m_min[i] = std::min( m_min[i], other.m_min[i] );
+                m_max[i] = std::max( m_max[i], other.m_max[i] );
+            }
+        }
+
         /**
          * Check if the accumulator is valid yet
         */
@@ -143,6 +165,19 @@ class EW_Std_Dev_Accumulator : public math::Return_Fixed_Type<void>
             }
         }
 
+        /**
+         * Fold in the sums from another accumulator
+        */
+        void merge( const EW_Std_Dev_Accumulator& other )
+        {
+            m_num_samples += other.m_num_samples;
+            for ( size_t i = 0; i < math::Compound_Channel_Count<ValueT>::value; i++ )
+            {
+                m_sum[i]   += other.m_sum[i];
+                m_sum_2[i] += other.m_sum_2[i];
+            }
+        }
+
         /**
          * Compute the standard deviation from the 2 summation values
         */
@@ -155,7 +190,7 @@ class EW_Std_Dev_Accumulator : public math::Return_Fixed_Type<void>
             }
             
             ValueT result;
-            for( size_t i = 0; m_sum.size(); i++ )
+            for( size_t i = 0; i < m_sum.size(); i++ )
             {
                 result[i] = sqrt( m_sum_2[i] / m_num_samples - ( m_sum[i] / m_num_samples ) 
                                   * ( m_sum[i] / m_num_samples ) );
@@ -202,6 +237,19 @@ class EW_Median_Accumulator : public math::Return_Fixed_Type<void>
             }
         }
 
+        /**
+         * Append the values from another accumulator
+        */
+        void merge( const EW_Median_Accumulator& other )
+        {
+            for( int i = 0; i < math::Compound_Channel_Count<ValueT>::value; i++ )
+            {
+                m_values[i].insert( m_values[i].end(),
+                                    other.m_values[i].begin(),
+                                    other.m_values[i].end() );
+            }
+        }
+
         /**
          * Compute the median and return it.
         */
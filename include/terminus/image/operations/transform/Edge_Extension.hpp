@@ -0,0 +1,281 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Edge_Extension.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/Rectangle.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <sys/types.h>
+#include <utility>
+#include <vector>
+
+namespace tmns::image::ops {
+
+/**
+ * Edge functors decide what a sampler sees outside the source image.  Each provides
+ *
+ * - `CONSTANT`: true if out-of-bounds pixels have a fixed `value()`, otherwise
+ *   `remap( c, r, cols, rows )` moves an out-of-bounds pixel onto the image
+ * - `source_regions( needed, cols, rows )`: a few disjoint in-bounds rectangles which
+ *   together hold every pixel read to evaluate `needed`.  Their total size never
+ *   exceeds the size of `needed`, so a block on the border of a huge image only loads
+ *   the pixels it actually reads.
+*/
+namespace detail {
+
+/**
+ * Clip a region to the image bounds.  May return an empty region.
+*/
+inline math::Rect2i clip_region( const math::Rect2i& needed,
+                                 int                 cols,
+                                 int                 rows )
+{
+    int x0 = int( std::clamp<int64_t>( needed.min().x(), 0, cols ) );
+    int y0 = int( std::clamp<int64_t>( needed.min().y(), 0, rows ) );
+    int x1 = int( std::clamp<int64_t>( int64_t( needed.min().x() ) + needed.width(),  0, cols ) );
+    int y1 = int( std::clamp<int64_t>( int64_t( needed.min().y() ) + needed.height(), 0, rows ) );
+    return math::Rect2i( x0, y0, std::max( x1 - x0, 0 ), std::max( y1 - y0, 0 ) );
+}
+
+/**
+ * Runs of source coordinates [begin, end) that an axis range lands on once remapped
+ * by `EdgeT::remap_axis()`, sorted and merged.  A range at least two periods long
+ * covers the whole axis.
+*/
+template <typename EdgeT>
+std::vector<std::pair<int,int>> remapped_runs( int64_t begin,
+                                               int64_t end,
+                                               int     n )
+{
+    std::vector<std::pair<int,int>> runs;
+    if( end <= begin || n <= 0 )
+    {
+        return runs;
+    }
+    if( end - begin >= 2 * int64_t( n ) )
+    {
+        runs.emplace_back( 0, n );
+        return runs;
+    }
+
+    std::vector<int> coords;
+    coords.reserve( end - begin );
+    for( int64_t v = begin; v < end; ++v )
+    {
+        coords.push_back( int( EdgeT::remap_axis( v, n ) ) );
+    }
+    std::sort( coords.begin(), coords.end() );
+    coords.erase( std::unique( coords.begin(), coords.end() ), coords.end() );
+
+    for( int v : coords )
+    {
+        if( !runs.empty() && runs.back().second == v )
+        {
+            runs.back().second = v + 1;
+        }
+        else
+        {
+            runs.emplace_back( v, v + 1 );
+        }
+    }
+    return runs;
+}
+
+/**
+ * Rectangles of source pixels a needed region lands on once remapped.  Each axis
+ * remaps independently, so these are the products of the runs along x and y.
+*/
+template <typename EdgeT>
+std::vector<math::Rect2i> remapped_regions( const math::Rect2i& needed,
+                                            int                 cols,
+                                            int                 rows )
+{
+    auto xs = remapped_runs<EdgeT>( needed.min().x(), int64_t( needed.min().x() ) + needed.width(),  cols );
+    auto ys = remapped_runs<EdgeT>( needed.min().y(), int64_t( needed.min().y() ) + needed.height(), rows );
+
+    std::vector<math::Rect2i> regions;
+    regions.reserve( xs.size() * ys.size() );
+    for( const auto& [y0, y1] : ys )
+    for( const auto& [x0, x1] : xs )
+    {
+        regions.emplace_back( x0, y0, x1 - x0, y1 - y0 );
+    }
+    return regions;
+}
+
+} // End of detail namespace
+
+/**
+ * Pixels outside the image have a fixed value, zero by default
+*/
+template <typename PixelT>
+class Constant_Edge
+{
+    public:
+
+        /**
+         * Constructor
+        */
+        explicit Constant_Edge( const PixelT& value = PixelT() )
+          : m_value( value )
+        {}
+
+        static constexpr bool CONSTANT = true;
+
+        const PixelT& value() const
+        {
+            return m_value;
+        }
+
+        std::vector<math::Rect2i> source_regions( const math::Rect2i& needed,
+                                                  int                 cols,
+                                                  int                 rows ) const
+        {
+            auto clipped = detail::clip_region( needed, cols, rows );
+            if( clipped.width() <= 0 || clipped.height() <= 0 )
+            {
+                return {};
+            }
+            return { clipped };
+        }
+
+        static std::string class_name() { return "Constant_Edge"; }
+        static std::string full_name()  { return class_name(); }
+
+    private:
+
+        /// Value outside the image
+        PixelT m_value;
+
+}; // End of Constant_Edge Class
+
+/**
+ * Pixels outside the image repeat the nearest edge pixel
+*/
+struct Extend_Edge
+{
+    static constexpr bool CONSTANT = false;
+
+    void remap( ssize_t& c,
+                ssize_t& r,
+                ssize_t  cols,
+                ssize_t  rows ) const
+    {
+        c = remap_axis( c, cols );
+        r = remap_axis( r, rows );
+    }
+
+    static ssize_t remap_axis( ssize_t v, ssize_t n )
+    {
+        return std::clamp<ssize_t>( v, 0, n - 1 );
+    }
+
+    /// Far-away blocks are pulled onto the image, so they still load their edge
+    std::vector<math::Rect2i> source_regions( const math::Rect2i& needed,
+                                              int                 cols,
+                                              int                 rows ) const
+    {
+        return detail::remapped_regions<Extend_Edge>( needed, cols, rows );
+    }
+
+    static std::string class_name() { return "Extend_Edge"; }
+    static std::string full_name()  { return class_name(); }
+
+}; // End of Extend_Edge struct
+
+/**
+ * The image tiles the plane
+*/
+struct Periodic_Edge
+{
+    static constexpr bool CONSTANT = false;
+
+    void remap( ssize_t& c,
+                ssize_t& r,
+                ssize_t  cols,
+                ssize_t  rows ) const
+    {
+        c = remap_axis( c, cols );
+        r = remap_axis( r, rows );
+    }
+
+    static ssize_t remap_axis( ssize_t v, ssize_t n )
+    {
+        v %= n;
+        return ( v < 0 ) ? v + n : v;
+    }
+
+    /// Blocks crossing an edge load the strip from the opposite side, not the image
+    std::vector<math::Rect2i> source_regions( const math::Rect2i& needed,
+                                              int                 cols,
+                                              int                 rows ) const
+    {
+        return detail::remapped_regions<Periodic_Edge>( needed, cols, rows );
+    }
+
+    static std::string class_name() { return "Periodic_Edge"; }
+    static std::string full_name()  { return class_name(); }
+
+}; // End of Periodic_Edge struct
+
+/**
+ * The image is mirrored about its edge pixels, so -1 reads 1 and cols reads cols - 2
+*/
+struct Reflect_Edge
+{
+    static constexpr bool CONSTANT = false;
+
+    void remap( ssize_t& c,
+                ssize_t& r,
+                ssize_t  cols,
+                ssize_t  rows ) const
+    {
+        c = remap_axis( c, cols );
+        r = remap_axis( r, rows );
+    }
+
+    static ssize_t remap_axis( ssize_t v, ssize_t n )
+    {
+        if( n == 1 )
+        {
+            return 0;
+        }
+        ssize_t period = 2 * ( n - 1 );
+        v %= period;
+        if( v < 0 )
+        {
+            v += period;
+        }
+        return ( v < n ) ? v : period - v;
+    }
+
+    /// Mirrored pixels mostly fall inside the clipped block, so this is usually one region
+    std::vector<math::Rect2i> source_regions( const math::Rect2i& needed,
+                                              int                 cols,
+                                              int                 rows ) const
+    {
+        return detail::remapped_regions<Reflect_Edge>( needed, cols, rows );
+    }
+
+    static std::string class_name() { return "Reflect_Edge"; }
+    static std::string full_name()  { return class_name(); }
+
+}; // End of Reflect_Edge struct
+
+} // End of tmns::image::ops namespace
@@ -0,0 +1,206 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Interpolation.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "../../types/Compound_Utilities.hpp"
+
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <sys/types.h>
+#include <type_traits>
+
+namespace tmns::image::ops {
+namespace detail {
+
+/**
+ * Convert a filtered value back to a channel.  Integer channels are rounded and
+ * clamped, since weights can push values outside the input range.
+*/
+template <typename ChannelT>
+ChannelT saturate_channel( double value )
+{
+    if constexpr( std::is_integral_v<ChannelT> )
+    {
+        value = std::clamp( std::round( value ),
+                            double( std::numeric_limits<ChannelT>::lowest() ),
+                            double( std::numeric_limits<ChannelT>::max() ) );
+    }
+    return ChannelT( value );
+}
+
+/**
+ * Accumulates weighted pixels channel by channel in double precision
+*/
+template <typename PixelT>
+class Pixel_Accumulator
+{
+    public:
+
+        typedef typename math::Compound_Channel_Type<PixelT>::type channel_type;
+
+        static constexpr size_t CHANNELS = math::Compound_Channel_Count<PixelT>::value;
+
+        /**
+         * Add a weighted pixel
+        */
+        void add( const PixelT& pixel,
+                  double        weight )
+        {
+            for( size_t ch = 0; ch < CHANNELS; ++ch )
+            {
+                m_sum[ch] += weight * double( compound_select_channel<const channel_type&>( pixel, ch ) );
+            }
+        }
+
+        /**
+         * Get the accumulated pixel
+        */
+        PixelT value() const
+        {
+            PixelT result = PixelT();
+            for( size_t ch = 0; ch < CHANNELS; ++ch )
+            {
+                compound_select_channel<channel_type&>( result, ch ) = saturate_channel<channel_type>( m_sum[ch] );
+            }
+            return result;
+        }
+
+    private:
+
+        /// Running sums, one per channel
+        double m_sum[CHANNELS] {};
+
+}; // End of Pixel_Accumulator Class
+
+} // End of detail namespace
+
+/**
+ * Interpolators sample an edge-extended source at a real-valued location.  Each one
+ * declares how far its kernel reaches around `floor(x)`, which the transform views
+ * use to bound the source region a destination block needs:
+ *
+ *   columns floor(x) - PAD_BEFORE  through  floor(x) + PAD_AFTER
+*/
+
+/**
+ * Take the closest pixel
+*/
+struct Nearest_Interpolation
+{
+    static constexpr int PAD_BEFORE = 0;
+    static constexpr int PAD_AFTER  = 1;
+
+    template <typename SamplerT>
+    typename SamplerT::pixel_type operator()( const SamplerT& src,
+                                              double          x,
+                                              double          y,
+                                              size_t          p ) const
+    {
+        return src( ssize_t( std::floor( x + 0.5 ) ),
+                    ssize_t( std::floor( y + 0.5 ) ),
+                    p );
+    }
+
+    static std::string class_name() { return "Nearest_Interpolation"; }
+    static std::string full_name()  { return class_name(); }
+
+}; // End of Nearest_Interpolation struct
+
+/**
+ * Blend the surrounding 2x2 pixels
+*/
+struct Bilinear_Interpolation
+{
+    static constexpr int PAD_BEFORE = 0;
+    static constexpr int PAD_AFTER  = 1;
+
+    template <typename SamplerT>
+    typename SamplerT::pixel_type operator()( const SamplerT& src,
+                                              double          x,
+                                              double          y,
+                                              size_t          p ) const
+    {
+        double fx = std::floor( x ), fy = std::floor( y );
+        double dx = x - fx,          dy = y - fy;
+        ssize_t c = ssize_t( fx ),   r = ssize_t( fy );
+
+        detail::Pixel_Accumulator<typename SamplerT::pixel_type> acc;
+        acc.add( src( c,     r,     p ), ( 1 - dx ) * ( 1 - dy ) );
+        acc.add( src( c + 1, r,     p ),       dx   * ( 1 - dy ) );
+        acc.add( src( c,     r + 1, p ), ( 1 - dx ) *       dy   );
+        acc.add( src( c + 1, r + 1, p ),       dx   *       dy   );
+        return acc.value();
+    }
+
+    static std::string class_name() { return "Bilinear_Interpolation"; }
+    static std::string full_name()  { return class_name(); }
+
+}; // End of Bilinear_Interpolation struct
+
+/**
+ * Cubic convolution over the surrounding 4x4 pixels (Keys, a = -0.5)
+*/
+struct Bicubic_Interpolation
+{
+    static constexpr int PAD_BEFORE = 1;
+    static constexpr int PAD_AFTER  = 2;
+
+    template <typename SamplerT>
+    typename SamplerT::pixel_type operator()( const SamplerT& src,
+                                              double          x,
+                                              double          y,
+                                              size_t          p ) const
+    {
+        double fx = std::floor( x ), fy = std::floor( y );
+        ssize_t c = ssize_t( fx ),   r = ssize_t( fy );
+
+        double wx[4], wy[4];
+        weights( x - fx, wx );
+        weights( y - fy, wy );
+
+        detail::Pixel_Accumulator<typename SamplerT::pixel_type> acc;
+        for( int j = 0; j < 4; ++j )
+        for( int i = 0; i < 4; ++i )
+        {
+            acc.add( src( c + i - 1, r + j - 1, p ), wx[i] * wy[j] );
+        }
+        return acc.value();
+    }
+
+    static std::string class_name() { return "Bicubic_Interpolation"; }
+    static std::string full_name()  { return class_name(); }
+
+    private:
+
+        /**
+         * Kernel weights for the pixels at offsets -1, 0, 1, 2 from floor(x)
+        */
+        static void weights( double t, double w[4] )
+        {
+            static constexpr double A = -0.5;
+            double t2 = t * t, t3 = t2 * t;
+            w[0] = A * ( t3 - 2 * t2 + t );
+            w[1] = ( A + 2 ) * t3 - ( A + 3 ) * t2 + 1;
+            w[2] = -( A + 2 ) * t3 + ( 2 * A + 3 ) * t2 - A * t;
+            w[3] = A * ( t2 - t3 );
+        }
+
+}; // End of Bicubic_Interpolation struct
+
+} // End of tmns::image::ops namespace
@@ -0,0 +1,499 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Transform_View.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "../../pixel/Pixel_Accessor_Loose.hpp"
+#include "../../types/Image_Base.hpp"
+#include "../../types/Image_Memory.hpp"
+#include "../../types/Image_Memory_Policy.hpp"
+#include "../block/Block_Guarded_Functor.hpp"
+#include "../block/Block_Processor.hpp"
+#include "../crop_image.hpp"
+#include "../rasterize.hpp"
+#include "Edge_Extension.hpp"
+#include "Interpolation.hpp"
+#include "Transforms.hpp"
+
+// Terminus Libraries
+#include <terminus/math/Size.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <sys/types.h>
+#include <thread>
+#include <vector>
+
+namespace tmns::image {
+namespace ops {
+namespace detail {
+
+/**
+ * Reads source pixels for an interpolator.  Pixels in one of the loaded regions come
+ * from its prerasterized source; other in-bounds pixels fall back to the child image,
+ * so a footprint estimate that comes up short costs speed rather than correctness.
+ * Out-of-bounds pixels go through the edge functor.
+*/
+template <typename SourceT,
+          typename ImageT,
+          typename EdgeT>
+class Edge_Sampler
+{
+    public:
+
+        typedef typename ImageT::pixel_type pixel_type;
+
+        Edge_Sampler( const std::vector<SourceT>&      sources,
+                      const std::vector<math::Rect2i>& regions,
+                      const ImageT&                    image,
+                      const EdgeT&                     edge )
+          : m_sources( sources ),
+            m_regions( regions ),
+            m_image( image ),
+            m_edge( edge ),
+            m_cols( image.cols() ),
+            m_rows( image.rows() )
+        {}
+
+        pixel_type operator()( ssize_t c,
+                               ssize_t r,
+                               size_t  p ) const
+        {
+            if( c < 0 || r < 0 || c >= m_cols || r >= m_rows )
+            {
+                if constexpr( EdgeT::CONSTANT )
+                {
+                    return m_edge.value();
+                }
+                else
+                {
+                    m_edge.remap( c, r, m_cols, m_rows );
+                }
+            }
+            for( size_t i = 0; i < m_regions.size(); ++i )
+            {
+                const auto& region = m_regions[i];
+                if( c >= region.min().x() && c < region.min().x() + region.width() &&
+                    r >= region.min().y() && r < region.min().y() + region.height() )
+                {
+                    return m_sources[i]( size_t( c ), size_t( r ), p );
+                }
+            }
+            return m_image( size_t( c ), size_t( r ), p );
+        }
+
+    private:
+
+        const std::vector<SourceT>&      m_sources;
+        const std::vector<math::Rect2i>& m_regions;
+        const ImageT& m_image;
+        const EdgeT&  m_edge;
+        ssize_t m_cols;
+        ssize_t m_rows;
+
+}; // End of Edge_Sampler Class
+
+} // End of detail namespace
+
+/**
+ * Geometric resampling view.  Each destination pixel is mapped back into the source
+ * through the transform's `reverse()` and sampled with the interpolator, with the
+ * edge functor supplying pixels outside the source.
+ *
+ * Rasterizing splits the destination into blocks.  For each block the transform is
+ * used to bound the source pixels it reads, only those pixels of the child are
+ * prerasterized (a few strips for a block wrapping around an edge), and the blocks
+ * are spread across threads.  Memory stays bounded by the block size no matter how
+ * large the output is, so the child must be safe to read from several threads, like
+ * the views wrapped by a Block_Rasterize_View.
+ *
+ * Destination points which map to non-finite or absurdly distant source locations
+ * are set to the default pixel value.
+*/
+template <typename ImageT,
+          typename TransformT,
+          typename InterpT,
+          typename EdgeT>
+class Transform_View : public Image_Base<Transform_View<ImageT,TransformT,InterpT,EdgeT>>
+{
+    public:
+
+        /// Pixel Type
+        typedef typename ImageT::pixel_type pixel_type;
+
+        /// Type returned from pixel operators
+        typedef pixel_type result_type;
+
+        /// Pixel Access Type
+        typedef Pixel_Accessor_Loose<Transform_View> pixel_accessor;
+
+        /// Source locations beyond this many pixels are treated as invalid.  Small enough
+        /// that a footprint's corners and size, padded for the interpolator, fit in an int.
+        static constexpr double MAX_COORDINATE = 1 << 29;
+        static_assert( 2 * int64_t( MAX_COORDINATE ) + InterpT::PAD_BEFORE + InterpT::PAD_AFTER + 3
+                           <= std::numeric_limits<int>::max(),
+                       "Transform_View footprints must fit in a Rect2i" );
+
+        /**
+         * Constructor
+         * @param image       Source image
+         * @param transform   Maps destination points back into the source
+         * @param cols        Destination width
+         * @param rows        Destination height
+         * @param interp      Interpolator
+         * @param edge        Edge handling
+         * @param block_size  Destination block size
+         * @param num_threads Threads for rasterizing.  0 uses the global `rasterize_parallel_settings()`.
+        */
+        Transform_View( const ImageT&       image,
+                        const TransformT&   transform,
+                        size_t              cols,
+                        size_t              rows,
+                        const InterpT&      interp      = InterpT(),
+                        const EdgeT&        edge        = EdgeT(),
+                        const math::Size2i& block_size  = math::Size2i( { 256, 256 } ),
+                        size_t              num_threads = 0 )
+          : m_image( image ),
+            m_transform( transform ),
+            m_interp( interp ),
+            m_edge( edge ),
+            m_cols( cols ),
+            m_rows( rows ),
+            m_block_size( block_size ),
+            m_num_threads( num_threads )
+        {}
+
+        /**
+         * Number of image columns
+         */
+        size_t cols() const { return m_cols; }
+
+        /**
+         * Number of image rows
+         */
+        size_t rows() const { return m_rows; }
+
+        /**
+         * Number of image planes
+         */
+        size_t planes() const { return m_image.planes(); }
+
+        /**
+         * Get the origin
+        */
+        pixel_accessor origin() const
+        {
+            return pixel_accessor( *this, 0, 0, 0 );
+        }
+
+        /**
+         * Evaluate a single pixel straight from the child.  Use rasterize() for
+         * anything bigger.
+         */
+        result_type operator()( size_t c,
+                                size_t r,
+                                size_t p = 0 ) const
+        {
+            const std::vector<ImageT>       sources;
+            const std::vector<math::Rect2i> regions;
+            detail::Edge_Sampler<ImageT,ImageT,EdgeT> sampler( sources, regions, m_image, m_edge );
+            return sample( sampler, c, r, p );
+        }
+
+        /**
+         * Get the child image
+        */
+        const ImageT& child() const { return m_image; }
+
+        /**
+         * Get the transform
+        */
+        const TransformT& transform() const { return m_transform; }
+
+        /**
+         * Get the block size
+        */
+        const math::Size2i& block_size() const { return m_block_size; }
+
+        /**
+         * Get the requested thread count
+        */
+        size_t num_threads() const { return m_num_threads; }
+
+        /**
+         * Source pixels needed for a block of destination pixels, as the few disjoint
+         * regions of the source the edge functor maps them onto.  May be empty.
+        */
+        std::vector<math::Rect2i> source_footprint( const math::Rect2i& bbox ) const
+        {
+            auto extent = reverse_extent( m_transform, bbox );
+            if( !extent.is_valid() )
+            {
+                return {};
+            }
+
+            // Sampled extents can miss a little between grid points
+            int pad = Has_Reverse_Extent<TransformT>::value ? 0 : 1;
+            auto lower = [&]( double v ){ return int64_t( std::floor( std::clamp( v, -MAX_COORDINATE, MAX_COORDINATE ) ) ); };
+
+            int64_t x0 = lower( extent.min_x ) - InterpT::PAD_BEFORE - pad;
+            int64_t y0 = lower( extent.min_y ) - InterpT::PAD_BEFORE - pad;
+            int64_t x1 = lower( extent.max_x ) + InterpT::PAD_AFTER + pad + 1;
+            int64_t y1 = lower( extent.max_y ) + InterpT::PAD_AFTER + pad + 1;
+            return m_edge.source_regions( math::Rect2i( int( x0 ), int( y0 ), int( x1 - x0 ), int( y1 - y0 ) ),
+                                          m_image.cols(),
+                                          m_image.rows() );
+        }
+
+        typedef Crop_View<Image_Memory<pixel_type>> prerasterize_type;
+        prerasterize_type prerasterize( const math::Rect2i& bbox ) const
+        {
+            // Init output data
+            Image_Memory<pixel_type> buffer( bbox.width(),
+                                             bbox.height(),
+                                             planes() );
+
+            // Fill in the output data from this view
+            rasterize( buffer, bbox );
+
+            // "Fake" the bbox image so it looks like a full size image.
+            return Crop_View<Image_Memory<pixel_type>>( buffer,
+                                                        math::Rect2i( -bbox.min().x(),
+                                                                      -bbox.min().y(),
+                                                                      cols(),
+                                                                      rows() ) );
+        }
+
+        template <class DestT>
+        void rasterize( const DestT&        dest,
+                        const math::Rect2i& bbox ) const
+        {
+            size_t threads = rasterize_thread_count( m_num_threads );
+
+            typedef block::Block_Guarded_Functor<Transform_Functor<DestT>> Block_Func;
+            Block_Func transformer( Transform_Functor<DestT>( *this, dest, bbox.min() ) );
+            block::Block_Processor<Block_Func> process( transformer,
+                                                        m_block_size,
+                                                        threads );
+            process( bbox );
+            transformer.rethrow();
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Transform_View";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + ImageT::full_name() + "," + InterpT::full_name()
+                                + "," + EdgeT::full_name() + ">";
+        }
+
+    private:
+
+        /**
+         * Map one destination pixel and sample it
+        */
+        template <typename SamplerT>
+        pixel_type sample( const SamplerT& sampler,
+                           size_t          c,
+                           size_t          r,
+                           size_t          p ) const
+        {
+            auto pt = m_transform.reverse( math::Point2d( { double( c ), double( r ) } ) );
+            if( !( std::abs( pt.x() ) < MAX_COORDINATE ) ||
+                !( std::abs( pt.y() ) < MAX_COORDINATE ) )
+            {
+                return pixel_type();
+            }
+            return m_interp( sampler, pt.x(), pt.y(), p );
+        }
+
+        /**
+         * Called by the block processor for each destination block.  Loads the
+         * block's source footprint, resamples into a pooled tile, then copies the
+         * tile into the destination.
+         */
+        template <typename DestT>
+        class Transform_Functor
+        {
+            public:
+
+                Transform_Functor( const Transform_View&  image,
+                                   const DestT&           dest,
+                                   const math::Vector2i&  offset )
+                  : m_image( image ),
+                    m_dest( dest ),
+                    m_offset( offset )
+                {}
+
+                void operator()( const math::Rect2i& bbox ) const
+                {
+                    process( bbox );
+                }
+
+                /**
+                 * Get this class name
+                 */
+                static std::string class_name()
+                {
+                    return "Transform_Functor";
+                }
+
+                static std::string full_name()
+                {
+                    return class_name() + "<" + DestT::full_name() + ">";
+                }
+
+            private:
+
+                void process( const math::Rect2i& bbox ) const
+                {
+                    const ImageT& child = m_image.m_image;
+                    auto regions = m_image.source_footprint( bbox );
+
+                    Image_Memory<pixel_type> tile( bbox.width(),
+                                                   bbox.height(),
+                                                   m_image.planes(),
+                                                   tile_memory_policy() );
+
+                    auto fill = [&]( const auto& sampler )
+                    {
+                        for( size_t p = 0; p < tile.planes(); ++p )
+                        for( int r = 0; r < bbox.height(); ++r )
+                        for( int c = 0; c < bbox.width(); ++c )
+                        {
+                            tile( c, r, p ) = m_image.sample( sampler,
+                                                              bbox.min().x() + c,
+                                                              bbox.min().y() + r,
+                                                              p );
+                        }
+                    };
+
+                    // Empty if the block maps entirely off the source
+                    std::vector<typename ImageT::prerasterize_type> sources;
+                    sources.reserve( regions.size() );
+                    for( const auto& region : regions )
+                    {
+                        sources.push_back( child.prerasterize( region ) );
+                    }
+                    detail::Edge_Sampler<typename ImageT::prerasterize_type,ImageT,EdgeT> sampler( sources,
+                                                                                                   regions,
+                                                                                                   child,
+                                                                                                   m_image.m_edge );
+                    fill( sampler );
+
+                    tile.rasterize( crop_image( m_dest, bbox - m_offset ),
+                                    math::Rect2i( 0, 0, bbox.width(), bbox.height() ) );
+                }
+
+                /// Parent view
+                const Transform_View& m_image;
+
+                /// Destination Image
+                const DestT& m_dest;
+
+                /// Offset of the destination within the view
+                math::Vector2i m_offset;
+
+        }; // End of Transform_Functor Class
+
+        template <typename DestT> friend class Transform_Functor;
+
+        /// Source image
+        ImageT m_image;
+
+        /// Destination to source mapping
+        TransformT m_transform;
+
+        /// Interpolator
+        InterpT m_interp;
+
+        /// Edge handling
+        EdgeT m_edge;
+
+        /// Destination size
+        size_t m_cols;
+        size_t m_rows;
+
+        /// Destination block size
+        math::Size2i m_block_size;
+
+        /// Threads for rasterizing
+        size_t m_num_threads;
+
+}; // End of Transform_View Class
+
+} // End of ops namespace
+
+/**
+ * Resample an image through a transform, with bilinear interpolation and zero
+ * outside the source
+*/
+template <typename ImageT,
+          typename TransformT>
+ops::Transform_View<ImageT,
+                    TransformT,
+                    ops::Bilinear_Interpolation,
+                    ops::Constant_Edge<typename ImageT::pixel_type>>
+    transform( const Image_Base<ImageT>& image,
+               const TransformT&         transform,
+               size_t                    cols,
+               size_t                    rows )
+{
+    return ops::Transform_View<ImageT,
+                               TransformT,
+                               ops::Bilinear_Interpolation,
+                               ops::Constant_Edge<typename ImageT::pixel_type>>( image.impl(),
+                                                                                 transform,
+                                                                                 cols,
+                                                                                 rows );
+}
+
+/**
+ * Resample an image through a transform
+*/
+template <typename ImageT,
+          typename TransformT,
+          typename InterpT,
+          typename EdgeT>
+ops::Transform_View<ImageT,TransformT,InterpT,EdgeT>
+    transform( const Image_Base<ImageT>& image,
+               const TransformT&         transform,
+               size_t                    cols,
+               size_t                    rows,
+               const InterpT&            interp,
+               const EdgeT&              edge,
+               const math::Size2i&       block_size  = math::Size2i( { 256, 256 } ),
+               size_t                    num_threads = 0 )
+{
+    return ops::Transform_View<ImageT,TransformT,InterpT,EdgeT>( image.impl(),
+                                                                 transform,
+                                                                 cols,
+                                                                 rows,
+                                                                 interp,
+                                                                 edge,
+                                                                 block_size,
+                                                                 num_threads );
+}
+
+} // End of tmns::image namespace
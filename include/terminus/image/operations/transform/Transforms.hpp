@@ -0,0 +1,329 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Transforms.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/math/Point.hpp>
+#include <terminus/math/Rectangle.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace tmns::image::ops {
+
+/**
+ * Continuous region of source coordinates, used to bound what a destination block reads
+*/
+struct Source_Extent
+{
+    double min_x {  std::numeric_limits<double>::infinity() };
+    double min_y {  std::numeric_limits<double>::infinity() };
+    double max_x { -std::numeric_limits<double>::infinity() };
+    double max_y { -std::numeric_limits<double>::infinity() };
+
+    /**
+     * Grow to include a point.  Non-finite points are skipped.
+    */
+    void add( double x, double y )
+    {
+        if( !std::isfinite( x ) || !std::isfinite( y ) )
+        {
+            return;
+        }
+        min_x = std::min( min_x, x );
+        min_y = std::min( min_y, y );
+        max_x = std::max( max_x, x );
+        max_y = std::max( max_y, y );
+    }
+
+    /**
+     * Check if any point was added
+    */
+    bool is_valid() const
+    {
+        return min_x <= max_x && min_y <= max_y;
+    }
+
+}; // End of Source_Extent struct
+
+/**
+ * Affine transform, mapping source pixel coordinates to destination coordinates with
+ *
+ *   x' = a * x + b * y + c
+ *   y' = d * x + e * y + f
+ *
+ * Transform views evaluate it backwards, so the inverse is kept as well.
+*/
+class Affine_Transform
+{
+    public:
+
+        /**
+         * Constructor
+         * @throws std::runtime_error if the matrix is singular
+        */
+        Affine_Transform( double a, double b, double c,
+                          double d, double e, double f )
+          : m_forward( { a, b, c, d, e, f } )
+        {
+            double det = a * e - b * d;
+            if( std::abs( det ) < std::numeric_limits<double>::epsilon() )
+            {
+                throw std::runtime_error( "Affine_Transform matrix is singular." );
+            }
+            m_reverse = { e / det, -b / det, ( b * f - c * e ) / det,
+                         -d / det,  a / det, ( c * d - a * f ) / det };
+        }
+
+        /**
+         * Shift by a fixed offset
+        */
+        static Affine_Transform translate( double dx, double dy )
+        {
+            return Affine_Transform( 1, 0, dx, 0, 1, dy );
+        }
+
+        /**
+         * Scale about the origin
+        */
+        static Affine_Transform scale( double sx, double sy )
+        {
+            return Affine_Transform( sx, 0, 0, 0, sy, 0 );
+        }
+
+        /**
+         * Rotate counter-clockwise (in image coordinates) by an angle in radians about a point
+        */
+        static Affine_Transform rotate( double angle, double cx, double cy )
+        {
+            double cs = std::cos( angle ), sn = std::sin( angle );
+            return Affine_Transform( cs, -sn, cx - cs * cx + sn * cy,
+                                     sn,  cs, cy - sn * cx - cs * cy );
+        }
+
+        /**
+         * Map a source point into the destination
+        */
+        math::Point2d forward( const math::Point2d& pt ) const
+        {
+            return apply( m_forward, pt );
+        }
+
+        /**
+         * Map a destination point back into the source
+        */
+        math::Point2d reverse( const math::Point2d& pt ) const
+        {
+            return apply( m_reverse, pt );
+        }
+
+        /**
+         * Straight lines stay straight, so the corners bound a block exactly
+        */
+        Source_Extent reverse_extent( const math::Rect2i& bbox ) const
+        {
+            Source_Extent extent;
+            for( double y : { double( bbox.min().y() ), double( bbox.min().y() + bbox.height() - 1 ) } )
+            for( double x : { double( bbox.min().x() ), double( bbox.min().x() + bbox.width()  - 1 ) } )
+            {
+                auto pt = reverse( math::Point2d( { x, y } ) );
+                extent.add( pt.x(), pt.y() );
+            }
+            return extent;
+        }
+
+    private:
+
+        static math::Point2d apply( const std::array<double,6>& m,
+                                    const math::Point2d&        pt )
+        {
+            return math::Point2d( { m[0] * pt.x() + m[1] * pt.y() + m[2],
+                                    m[3] * pt.x() + m[4] * pt.y() + m[5] } );
+        }
+
+        /// Source to destination
+        std::array<double,6> m_forward;
+
+        /// Destination to source
+        std::array<double,6> m_reverse;
+
+}; // End of Affine_Transform Class
+
+/**
+ * Projective transform, mapping source pixel coordinates to destination coordinates
+ * through a row-major 3x3 matrix in homogeneous coordinates.
+*/
+class Homography_Transform
+{
+    public:
+
+        /**
+         * Constructor
+         * @throws std::runtime_error if the matrix is singular
+        */
+        explicit Homography_Transform( const std::array<double,9>& h )
+          : m_forward( h )
+        {
+            // Inverse through the adjugate
+            const auto& m = h;
+            std::array<double,9> adj = { m[4] * m[8] - m[5] * m[7],
+                                         m[2] * m[7] - m[1] * m[8],
+                                         m[1] * m[5] - m[2] * m[4],
+                                         m[5] * m[6] - m[3] * m[8],
+                                         m[0] * m[8] - m[2] * m[6],
+                                         m[2] * m[3] - m[0] * m[5],
+                                         m[3] * m[7] - m[4] * m[6],
+                                         m[1] * m[6] - m[0] * m[7],
+                                         m[0] * m[4] - m[1] * m[3] };
+            double det = m[0] * adj[0] + m[1] * adj[3] + m[2] * adj[6];
+            if( std::abs( det ) < std::numeric_limits<double>::epsilon() )
+            {
+                throw std::runtime_error( "Homography_Transform matrix is singular." );
+            }
+            for( size_t i = 0; i < 9; ++i )
+            {
+                m_reverse[i] = adj[i] / det;
+            }
+        }
+
+        /**
+         * Map a source point into the destination
+        */
+        math::Point2d forward( const math::Point2d& pt ) const
+        {
+            return apply( m_forward, pt );
+        }
+
+        /**
+         * Map a destination point back into the source.  Points on the horizon
+         * come back as NaN.
+        */
+        math::Point2d reverse( const math::Point2d& pt ) const
+        {
+            return apply( m_reverse, pt );
+        }
+
+    private:
+
+        static math::Point2d apply( const std::array<double,9>& m,
+                                    const math::Point2d&        pt )
+        {
+            double w = m[6] * pt.x() + m[7] * pt.y() + m[8];
+            if( std::abs( w ) < std::numeric_limits<double>::epsilon() )
+            {
+                double nan = std::numeric_limits<double>::quiet_NaN();
+                return math::Point2d( { nan, nan } );
+            }
+            return math::Point2d( { ( m[0] * pt.x() + m[1] * pt.y() + m[2] ) / w,
+                                    ( m[3] * pt.x() + m[4] * pt.y() + m[5] ) / w } );
+        }
+
+        /// Source to destination
+        std::array<double,9> m_forward;
+
+        /// Destination to source
+        std::array<double,9> m_reverse {};
+
+}; // End of Homography_Transform Class
+
+/**
+ * Wraps any callable mapping destination points back into the source, such as a
+ * camera model projection.  Return NaN for points with no source location.
+*/
+template <typename FunctorT>
+class Functor_Transform
+{
+    public:
+
+        /**
+         * Constructor
+        */
+        explicit Functor_Transform( FunctorT func )
+          : m_func( std::move( func ) )
+        {}
+
+        /**
+         * Map a destination point back into the source
+        */
+        math::Point2d reverse( const math::Point2d& pt ) const
+        {
+            return m_func( pt );
+        }
+
+    private:
+
+        /// Destination to source mapping
+        FunctorT m_func;
+
+}; // End of Functor_Transform Class
+
+/**
+ * Wrap a callable as a transform
+*/
+template <typename FunctorT>
+Functor_Transform<FunctorT> functor_transform( FunctorT func )
+{
+    return Functor_Transform<FunctorT>( std::move( func ) );
+}
+
+/**
+ * Check if a transform can bound a block of destination pixels itself
+*/
+template <typename TransformT,
+          typename = void>
+struct Has_Reverse_Extent : std::false_type {};
+
+template <typename TransformT>
+struct Has_Reverse_Extent<TransformT,
+                          std::void_t<decltype( std::declval<const TransformT&>().reverse_extent( std::declval<math::Rect2i>() ) )>>
+    : std::true_type {};
+
+/**
+ * Find the region of source coordinates a block of destination pixels maps to.
+ * Transforms without their own `reverse_extent()` are sampled on a grid over the
+ * block, which is exact for anything that doesn't bulge between grid points.
+*/
+template <typename TransformT>
+Source_Extent reverse_extent( const TransformT&   transform,
+                              const math::Rect2i& bbox )
+{
+    if constexpr( Has_Reverse_Extent<TransformT>::value )
+    {
+        return transform.reverse_extent( bbox );
+    }
+    else
+    {
+        static constexpr int GRID_SIZE = 9;
+
+        Source_Extent extent;
+        for( int j = 0; j < GRID_SIZE; ++j )
+        for( int i = 0; i < GRID_SIZE; ++i )
+        {
+            double x = bbox.min().x() + ( bbox.width()  - 1 ) * double( i ) / ( GRID_SIZE - 1 );
+            double y = bbox.min().y() + ( bbox.height() - 1 ) * double( j ) / ( GRID_SIZE - 1 );
+            auto pt = transform.reverse( math::Point2d( { x, y } ) );
+            extent.add( pt.x(), pt.y() );
+        }
+        return extent;
+    }
+}
+
+} // End of tmns::image::ops namespace
@@ -16,6 +16,7 @@
 
 // Terminus Libraries
 #include <terminus/image/pixel/Channel_Range.hpp>
+#include <terminus/image/pixel/Float16.hpp>
 #include <terminus/image/types/Compound_Utilities.hpp>
 #include <terminus/image/types/compounds/Binary_Compound_Functor.hpp>
 #include <terminus/image/types/compounds/Binary_In_Place_Compound_Functor.hpp>
@@ -69,8 +70,8 @@ class Channel_Cast_Rescale_Functor : public math::Return_Fixed_Type<DestT>
              * This will not work for clamping and casting to float. For that,
              * Clamp_And_Cast above.
              */
-            if( std::is_floating_point<SourceT>::value &&
-                ! std::is_floating_point<DestT>::value )
+            if( Is_Floating_Point_Channel<SourceT>::value &&
+                ! Is_Floating_Point_Channel<DestT>::value )
             {
                 if( source > Channel_Range<SourceT>::max() )
                 {
@@ -294,7 +295,7 @@ typename std::enable_if< math::Is_Scalar_Or_Compound<PixelT>::value,
   channel_cast_clamp_if_int( PixelT pixel )
 {
     // if floating point, use normal cast functor, otherwise, clamp
-    typedef typename std::conditional<std::is_floating_point<ChannelT>::value,
+    typedef typename std::conditional<Is_Floating_Point_Channel<ChannelT>::value,
                                         Channel_Cast_Functor<ChannelT>,
                                         Channel_Cast_Clamp_Functor<ChannelT> >::type FunctorT;
     return compound_apply( FunctorT(), pixel );
@@ -319,7 +320,7 @@ typename std::enable_if< math::Is_Scalar_Or_Compound<PixelT>::value,
                          typename math::Compound_Channel_Cast<PixelT, ChannelT>::type >::type
     channel_cast_round_if_int( PixelT pixel )
 {
-    typedef typename std::conditional<std::is_floating_point<ChannelT>::value,
+    typedef typename std::conditional<Is_Floating_Point_Channel<ChannelT>::value,
                                             Channel_Cast_Functor<ChannelT>,
                                             Channel_Cast_Round_Functor<ChannelT> >::type functor_type;
     return compound_apply( functor_type(), pixel );
@@ -345,7 +346,7 @@ typename std::enable_if< math::Is_Scalar_Or_Compound<PixelT>::value,
   channel_cast_round_and_clamp_if_int( PixelT pixel )
 {
     // If destination is float, do normal casting, if integer, do the round and clamp functor
-    typedef typename std::conditional<std::is_floating_point<ChannelT>::value,
+    typedef typename std::conditional<Is_Floating_Point_Channel<ChannelT>::value,
                                             Channel_Cast_Functor<ChannelT>,
                                             Channel_Cast_Round_Clamp_Functor<ChannelT> >::type functor_type;
 
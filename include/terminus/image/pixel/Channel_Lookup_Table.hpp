@@ -0,0 +1,302 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Channel_Lookup_Table.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/image/pixel/Channel_Cast_Utilities.hpp>
+#include <terminus/image/pixel/Channel_Type_ID.hpp>
+#include <terminus/math/types/Functors.hpp>
+
+// C++ Libraries
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+namespace tmns::image::pix {
+
+/**
+ * Channel types small enough to map through a lookup table (256 or 65536 entries)
+*/
+template <typename ChannelT>
+struct Has_Channel_Lookup_Table : std::bool_constant<std::is_integral_v<ChannelT> &&
+                                                     !std::is_same_v<ChannelT,bool> &&
+                                                     sizeof(ChannelT) <= 2> {};
+
+/**
+ * Identifies a lookup table in the cache.  The name describes the mapping (ex: "normalize")
+ * and the parameters are whatever values the mapping was built from.  The table type keeps
+ * differently typed tables with the same name apart; `Lookup_Table_Cache::get_table()`
+ * fills it in.
+*/
+struct Lookup_Table_Key
+{
+    Channel_Type_Enum   src_type { Channel_Type_Enum::UNKNOWN };
+    Channel_Type_Enum   dst_type { Channel_Type_Enum::UNKNOWN };
+    std::string         name;
+    std::vector<double> params;
+    std::type_index     table_type { typeid( void ) };
+
+    bool operator < ( const Lookup_Table_Key& rhs ) const;
+    bool operator == ( const Lookup_Table_Key& rhs ) const;
+
+}; // End of Lookup_Table_Key struct
+
+/**
+ * @class Lookup_Table_Cache
+ *
+ * Global cache of lookup tables so each mapping is only built once.  Tables are type-erased,
+ * so both the typed `Channel_Lookup_Table` and the raw byte tables used by `convert()` share it.
+ * Use `get_table()` to fetch them; it keys each table by its type so casting back is safe.
+ * The least-recently-used table is dropped once the cache is full.  Anyone still holding
+ * a dropped table keeps it alive.
+*/
+class Lookup_Table_Cache
+{
+    public:
+
+        /// Type-erased table pointer
+        typedef std::shared_ptr<const void> table_ptr_t;
+
+        /// Builds a table on a cache miss
+        typedef std::function<table_ptr_t()> builder_type;
+
+        /// Default max number of cached tables
+        static constexpr size_t DEFAULT_MAX_ENTRIES = 128;
+
+        /**
+         * Get the global cache instance
+        */
+        static Lookup_Table_Cache& instance();
+
+        /**
+         * Get the table for this key, building it if it isn't cached.
+         * The builder runs outside the lock.
+        */
+        table_ptr_t get( const Lookup_Table_Key& key,
+                         const builder_type&     builder );
+
+        /**
+         * Get a table of a known type, building it if it isn't cached.  The key is stamped
+         * with the table type, so a table stored under the same name by another caller is
+         * never handed back as the wrong type.
+         * @param builder Returns a `std::shared_ptr<const TableT>`
+        */
+        template <typename TableT,
+                  typename BuilderT>
+        std::shared_ptr<const TableT> get_table( Lookup_Table_Key key,
+                                                 const BuilderT&  builder )
+        {
+            key.table_type = typeid( TableT );
+            auto table = get( key, [&](){
+                return table_ptr_t( std::shared_ptr<const TableT>( builder() ) );
+            });
+            return std::static_pointer_cast<const TableT>( table );
+        }
+
+        /**
+         * Set the max number of cached tables
+        */
+        void set_max_entries( size_t max_entries );
+
+        /**
+         * Get the number of cached tables
+        */
+        size_t size() const;
+
+        /**
+         * Drop all cached tables
+        */
+        void clear();
+
+    private:
+
+        Lookup_Table_Cache() = default;
+
+        /// Drop least-recently-used tables until we're under the max count
+        void evict_locked();
+
+        /// Entry in the table
+        struct Entry
+        {
+            table_ptr_t                              table;
+            std::list<Lookup_Table_Key>::iterator    lru_pos;
+        };
+
+        /// Max tables to keep
+        size_t m_max_entries { DEFAULT_MAX_ENTRIES };
+
+        /// Most-recently used at the front
+        std::list<Lookup_Table_Key> m_lru;
+
+        /// Cached tables
+        std::map<Lookup_Table_Key,Entry> m_tables;
+
+        /// Guards the cache
+        mutable std::mutex m_mtx;
+
+}; // End of Lookup_Table_Cache class
+
+/**
+ * @class Channel_Lookup_Table
+ *
+ * Precomputed mapping from every value of a small integer channel type to a destination
+ * channel value.  Any per-channel function (casts, normalization, tone curves) costs one
+ * load per channel once the table is built.
+*/
+template <typename SrcT,
+          typename DstT>
+class Channel_Lookup_Table
+{
+    public:
+
+        static_assert( Has_Channel_Lookup_Table<SrcT>::value,
+                       "Lookup tables require an integer source of 16 bits or fewer." );
+
+        /// Pointer Type
+        typedef std::shared_ptr<const Channel_Lookup_Table<SrcT,DstT>> ptr_t;
+
+        /// Number of entries
+        static constexpr size_t SIZE = size_t(1) << ( 8 * sizeof(SrcT) );
+
+        /**
+         * Build the table by evaluating the function on every source value
+        */
+        template <typename FuncT>
+        explicit Channel_Lookup_Table( const FuncT& func )
+          : m_table( SIZE )
+        {
+            for( size_t i = 0; i < SIZE; ++i )
+            {
+                m_table[i] = DstT( func( SrcT( std::make_unsigned_t<SrcT>( i ) ) ) );
+            }
+        }
+
+        /**
+         * Table index for a source value.  Signed values use their bit pattern.
+        */
+        static size_t index( SrcT value )
+        {
+            return size_t( std::make_unsigned_t<SrcT>( value ) );
+        }
+
+        /**
+         * Look up a value
+        */
+        DstT operator()( SrcT value ) const
+        {
+            return m_table[index( value )];
+        }
+
+        /**
+         * Map a contiguous run of values
+        */
+        void apply( const SrcT* src, DstT* dst, size_t count ) const
+        {
+            const DstT* table = m_table.data();
+            for( size_t i = 0; i < count; ++i )
+            {
+                dst[i] = table[index( src[i] )];
+            }
+        }
+
+        /**
+         * Raw table data
+        */
+        const DstT* data() const
+        {
+            return m_table.data();
+        }
+
+        /**
+         * Get the cached table for the name and parameters, building it from the function
+         * on first use.  The function must be fully described by the name and parameters.
+        */
+        template <typename FuncT>
+        static ptr_t cached( const std::string&         name,
+                             const std::vector<double>& params,
+                             const FuncT&               func )
+        {
+            Lookup_Table_Key key { Channel_Type_ID<SrcT>::value,
+                                   Channel_Type_ID<DstT>::value,
+                                   name,
+                                   params };
+            return Lookup_Table_Cache::instance().get_table<Channel_Lookup_Table<SrcT,DstT>>( key, [&](){
+                return std::make_shared<const Channel_Lookup_Table<SrcT,DstT>>( func );
+            });
+        }
+
+    private:
+
+        /// Destination value for each source value
+        std::vector<DstT> m_table;
+
+}; // End of Channel_Lookup_Table class
+
+/**
+ * Channel functor which maps values through a lookup table
+*/
+template <typename SrcT,
+          typename DstT>
+class Channel_Lookup_Functor : public math::Return_Fixed_Type<DstT>
+{
+    public:
+
+        typedef typename Channel_Lookup_Table<SrcT,DstT>::ptr_t table_ptr_t;
+
+        Channel_Lookup_Functor() = default;
+
+        explicit Channel_Lookup_Functor( table_ptr_t table )
+          : m_table( std::move( table ) ) {}
+
+        DstT operator()( SrcT value ) const
+        {
+            return (*m_table)( value );
+        }
+
+        /**
+         * Get the lookup table
+        */
+        const table_ptr_t& table() const
+        {
+            return m_table;
+        }
+
+    private:
+
+        table_ptr_t m_table;
+
+}; // End of Channel_Lookup_Functor class
+
+/**
+ * Get the cached lookup table matching `channel_cast_rescale<DstT>()`
+*/
+template <typename SrcT,
+          typename DstT>
+typename Channel_Lookup_Table<SrcT,DstT>::ptr_t channel_cast_rescale_lookup_table()
+{
+    return Channel_Lookup_Table<SrcT,DstT>::cached( "channel_cast_rescale",
+                                                    {},
+                                                    Channel_Cast_Rescale_Functor<DstT>() );
+}
+
+} // End of tmns::image::pix namespace
@@ -36,6 +36,7 @@ enum Channel_Type_Enum
     FLOAT64     = 12,
     FLOAT32Free = 13,
     FLOAT64Free = 14,
+    FLOAT16     = 15,
 }; // end of Channel_Type_Enum enumeration
 
 /**
@@ -54,4 +55,15 @@ bool is_integer_type( Channel_Type_Enum value );
 */
 Result<size_t> channel_size_bytes( Channel_Type_Enum val );
 
+/**
+ * Get the number of significant bits in the channel.  UINT12 and UINT14 report 12 and 14,
+ * even though they occupy 2 bytes when unpacked.
+*/
+Result<size_t> channel_size_bits( Channel_Type_Enum val );
+
+/**
+ * Return true if the channel type can be stored bit-packed (UINT12 and UINT14)
+*/
+bool is_packable_type( Channel_Type_Enum val );
+
 } // end of tmns::image namespace
\ No newline at end of file
@@ -16,6 +16,7 @@
 
 // Terminus Libraries
 #include "Channel_Type_Enum.hpp"
+#include "Float16.hpp"
 
 namespace tmns::image {
 
@@ -41,6 +42,7 @@ template <> struct Channel_Type_ID<int32_t>{ static constexpr Channel_Type_Enum
 template <> struct Channel_Type_ID<int64_t>{ static constexpr Channel_Type_Enum value = Channel_Type_Enum::INT64;  };
 
 // Floating-Point Types
+template <> struct Channel_Type_ID<Float16>{ static constexpr Channel_Type_Enum value = Channel_Type_Enum::FLOAT16; };
 template <> struct Channel_Type_ID<float>{  static constexpr Channel_Type_Enum value = Channel_Type_Enum::FLOAT32;  };
 template <> struct Channel_Type_ID<double>{ static constexpr Channel_Type_Enum value = Channel_Type_Enum::FLOAT64;  };
 
@@ -0,0 +1,227 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Float16.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace tmns::image {
+
+/**
+ * Convert a float to IEEE half-precision bits, rounding to nearest-even.
+ * Values beyond the half range become infinity.
+*/
+inline uint16_t float_to_half_bits( float value )
+{
+    uint32_t bits;
+    std::memcpy( &bits, &value, sizeof(bits) );
+    uint32_t sign = ( bits >> 16 ) & 0x8000;
+    uint32_t mag  = bits & 0x7FFFFFFF;
+
+    // Infinity and NaN (NaNs stay quiet NaNs)
+    if( mag >= 0x7F800000 )
+    {
+        return uint16_t( sign | 0x7C00 | ( mag > 0x7F800000 ? 0x0200 | ( ( mag >> 13 ) & 0x03FF ) : 0 ) );
+    }
+
+    // Rounds past 65504
+    if( mag >= 0x477FF000 )
+    {
+        return uint16_t( sign | 0x7C00 );
+    }
+
+    // Half subnormals, or too small to represent
+    if( mag < 0x38800000 )
+    {
+        if( mag < 0x33000000 )
+        {
+            return uint16_t( sign );
+        }
+        uint32_t mantissa  = ( mag & 0x007FFFFF ) | 0x00800000;
+        uint32_t shift     = 126 - ( mag >> 23 );
+        uint32_t result    = mantissa >> shift;
+        uint32_t remainder = mantissa & ( ( 1u << shift ) - 1 );
+        uint32_t halfway   = 1u << ( shift - 1 );
+        if( remainder > halfway || ( remainder == halfway && ( result & 1 ) ) )
+        {
+            ++result;
+        }
+        return uint16_t( sign | result );
+    }
+
+    // Normal values.  A mantissa carry correctly bumps the exponent.
+    uint32_t result    = ( mag - 0x38000000 ) >> 13;
+    uint32_t remainder = mag & 0x1FFF;
+    if( remainder > 0x1000 || ( remainder == 0x1000 && ( result & 1 ) ) )
+    {
+        ++result;
+    }
+    return uint16_t( sign | result );
+}
+
+/**
+ * Convert IEEE half-precision bits to a float.  Exact.
+*/
+inline float half_bits_to_float( uint16_t half )
+{
+    uint32_t sign     = uint32_t( half & 0x8000 ) << 16;
+    uint32_t exponent = ( half >> 10 ) & 0x1F;
+    uint32_t mantissa = half & 0x03FF;
+
+    uint32_t bits;
+    if( exponent == 0x1F )
+    {
+        bits = sign | 0x7F800000 | ( mantissa << 13 );
+    }
+    else if( exponent != 0 )
+    {
+        bits = sign | ( ( exponent + 112 ) << 23 ) | ( mantissa << 13 );
+    }
+    else if( mantissa == 0 )
+    {
+        bits = sign;
+    }
+    else
+    {
+        // Subnormal, so normalize it
+        exponent = 113;
+        while( ( mantissa & 0x0400 ) == 0 )
+        {
+            mantissa <<= 1;
+            --exponent;
+        }
+        bits = sign | ( exponent << 23 ) | ( ( mantissa & 0x03FF ) << 13 );
+    }
+
+    float value;
+    std::memcpy( &value, &bits, sizeof(value) );
+    return value;
+}
+
+/**
+ * Half-precision floating-point channel type.  Math happens in float; this type only
+ * exists to halve storage.  Like the other float channels, the nominal range is [0,1].
+*/
+class Float16
+{
+    public:
+
+        /**
+         * Default Constructor
+        */
+        Float16() = default;
+
+        /**
+         * Construct from any arithmetic value
+        */
+        template <typename ValueT,
+                  typename = std::enable_if_t<std::is_arithmetic_v<ValueT>>>
+        Float16( ValueT value )
+          : m_bits( float_to_half_bits( float( value ) ) )
+        {}
+
+        /**
+         * Build from raw IEEE half bits
+        */
+        static Float16 from_bits( uint16_t bits )
+        {
+            Float16 result;
+            result.m_bits = bits;
+            return result;
+        }
+
+        /**
+         * Get the raw IEEE half bits
+        */
+        uint16_t bits() const { return m_bits; }
+
+        /**
+         * Convert to float
+        */
+        operator float() const
+        {
+            return half_bits_to_float( m_bits );
+        }
+
+        Float16& operator += ( float rhs ) { return *this = Float16( float( *this ) + rhs ); }
+        Float16& operator -= ( float rhs ) { return *this = Float16( float( *this ) - rhs ); }
+        Float16& operator *= ( float rhs ) { return *this = Float16( float( *this ) * rhs ); }
+        Float16& operator /= ( float rhs ) { return *this = Float16( float( *this ) / rhs ); }
+
+    private:
+
+        /// IEEE half bits
+        uint16_t m_bits { 0 };
+
+}; // End of Float16 Class
+
+static_assert( sizeof(Float16) == 2 );
+
+/**
+ * Floating-point channel types, including the half-precision channel which
+ * `std::is_floating_point` doesn't know about.
+*/
+template <typename ChannelT>
+struct Is_Floating_Point_Channel : std::bool_constant<std::is_floating_point_v<ChannelT> ||
+                                                      std::is_same_v<std::remove_cv_t<ChannelT>,Float16>> {};
+
+/**
+ * Convert a row of half values to float, using F16C when the CPU has it
+*/
+void convert_float16_to_float32( const Float16* src, float* dst, size_t count );
+
+/**
+ * Convert a row of floats to half values, rounding to nearest-even.  Uses F16C when
+ * the CPU has it.
+*/
+void convert_float32_to_float16( const float* src, Float16* dst, size_t count );
+
+} // End of tmns::image namespace
+
+namespace std {
+
+/**
+ * Limits for the half-precision channel
+*/
+template <>
+class numeric_limits<tmns::image::Float16>
+{
+    public:
+
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed      = true;
+        static constexpr bool is_integer     = false;
+        static constexpr bool is_exact       = false;
+        static constexpr bool has_infinity   = true;
+        static constexpr bool has_quiet_NaN  = true;
+        static constexpr int  digits         = 11;
+        static constexpr int  digits10       = 3;
+        static constexpr int  radix          = 2;
+
+        static tmns::image::Float16 min()           { return tmns::image::Float16::from_bits( 0x0400 ); }
+        static tmns::image::Float16 max()           { return tmns::image::Float16::from_bits( 0x7BFF ); }
+        static tmns::image::Float16 lowest()        { return tmns::image::Float16::from_bits( 0xFBFF ); }
+        static tmns::image::Float16 epsilon()       { return tmns::image::Float16::from_bits( 0x1400 ); }
+        static tmns::image::Float16 infinity()      { return tmns::image::Float16::from_bits( 0x7C00 ); }
+        static tmns::image::Float16 quiet_NaN()     { return tmns::image::Float16::from_bits( 0x7E00 ); }
+        static tmns::image::Float16 denorm_min()    { return tmns::image::Float16::from_bits( 0x0001 ); }
+
+}; // End of numeric_limits<Float16> Class
+
+} // End of std namespace
@@ -0,0 +1,63 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Interleave_Utilities.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <cstddef>
+#include <cstdint>
+#include <sys/types.h>
+
+namespace tmns::image {
+
+/**
+ * Gather separate channel planes into interleaved pixels.  Values are copied as raw
+ * bytes, so any channel type of 1, 2, 4 or 8 bytes works.
+ *
+ * @param src           First value of the first plane
+ * @param src_pstride   Bytes between planes
+ * @param src_rstride   Bytes between rows of a plane
+ * @param dst           First interleaved pixel
+ * @param dst_rstride   Bytes between interleaved rows
+ * @param cols          Pixels per row
+ * @param rows          Number of rows
+ * @param channels      Number of planes, which becomes channels per pixel
+ * @param channel_bytes Bytes per value
+ * @return False if the channel size is unsupported
+*/
+bool planar_to_interleaved( const uint8_t* src,
+                            ssize_t        src_pstride,
+                            ssize_t        src_rstride,
+                            uint8_t*       dst,
+                            ssize_t        dst_rstride,
+                            size_t         cols,
+                            size_t         rows,
+                            size_t         channels,
+                            size_t         channel_bytes );
+
+/**
+ * Scatter interleaved pixels into separate channel planes.  The inverse of
+ * planar_to_interleaved(), with the same parameters.
+*/
+bool interleaved_to_planar( const uint8_t* src,
+                            ssize_t        src_rstride,
+                            uint8_t*       dst,
+                            ssize_t        dst_pstride,
+                            ssize_t        dst_rstride,
+                            size_t         cols,
+                            size_t         rows,
+                            size_t         channels,
+                            size_t         channel_bytes );
+
+} // End of tmns::image namespace
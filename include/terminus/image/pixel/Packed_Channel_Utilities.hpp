@@ -0,0 +1,100 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Packed_Channel_Utilities.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/core/error/ErrorCategory.hpp>
+
+// Terminus Image Libraries
+#include "Channel_Type_Enum.hpp"
+
+// C++ Libraries
+#include <cstddef>
+#include <cstdint>
+
+namespace tmns::image {
+
+/**
+ * Packed 12/14-bit channels are stored as a little-endian bit stream.  Value `i` occupies
+ * bits [i*bits, (i+1)*bits) of the stream, and each row starts on a byte boundary.
+*/
+
+/**
+ * Number of bytes needed to hold `count` packed values
+*/
+inline size_t packed_size_bytes( size_t bits,
+                                 size_t count )
+{
+    return ( count * bits + 7 ) / 8;
+}
+
+/**
+ * Read a single value from a packed stream.  Fine for random access; use the
+ * unpack functions for whole rows.
+*/
+inline uint16_t packed_value( const uint8_t* data,
+                              size_t         index,
+                              size_t         bits )
+{
+    size_t   bit_offset = index * bits;
+    size_t   num_bytes  = ( bit_offset % 8 + bits + 7 ) / 8;
+    uint32_t word       = 0;
+    for( size_t i = 0; i < num_bytes; ++i )
+    {
+        word |= uint32_t( data[bit_offset / 8 + i] ) << ( 8 * i );
+    }
+    return uint16_t( ( word >> ( bit_offset % 8 ) ) & ( ( 1u << bits ) - 1 ) );
+}
+
+/**
+ * Pack 12-bit values held in uint16.  Values above 4095 saturate.
+ * @return False if any value saturated
+*/
+bool pack_uint12( const uint16_t* src, uint8_t* dst, size_t count );
+
+/**
+ * Unpack 12-bit values into uint16
+*/
+void unpack_uint12( const uint8_t* src, uint16_t* dst, size_t count );
+
+/**
+ * Pack 14-bit values held in uint16.  Values above 16383 saturate.
+ * @return False if any value saturated
+*/
+bool pack_uint14( const uint16_t* src, uint8_t* dst, size_t count );
+
+/**
+ * Unpack 14-bit values into uint16
+*/
+void unpack_uint14( const uint8_t* src, uint16_t* dst, size_t count );
+
+/**
+ * Pack values for a packable channel type (UINT12 or UINT14).
+ * @return True if every value fit, false if any saturated
+*/
+Result<bool> pack_channels( Channel_Type_Enum channel_type,
+                            const uint16_t*   src,
+                            uint8_t*          dst,
+                            size_t            count );
+
+/**
+ * Unpack values for a packable channel type (UINT12 or UINT14)
+*/
+Result<void> unpack_channels( Channel_Type_Enum channel_type,
+                              const uint8_t*    src,
+                              uint16_t*         dst,
+                              size_t            count );
+
+} // End of tmns::image namespace
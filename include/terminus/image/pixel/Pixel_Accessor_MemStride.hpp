@@ -189,6 +189,16 @@ class Pixel_Accessor_MemStride
             return std::distance( m_origin, m_ptr );
         }
 
+        /**
+         * Get the distance between rows, in pixels
+        */
+        ssize_t row_stride() const { return m_rstride; }
+
+        /**
+         * Get the distance between planes, in pixels
+        */
+        ssize_t plane_stride() const { return m_pstride; }
+
         /**
          * Get this class name
         */
@@ -20,8 +20,12 @@
 #include <terminus/image/pixel/Pixel_RGB.hpp>
 #include <terminus/image/pixel/Pixel_RGBA.hpp>
 #include <terminus/image/pixel/Channel_Cast_Utilities.hpp>
+#include <terminus/image/pixel/Channel_Lookup_Table.hpp>
 #include <terminus/math/types/Functors.hpp>
 
+// C++ Libraries
+#include <span>
+
 namespace tmns::image::pix {
 
 /**
@@ -253,6 +257,19 @@ struct Pixel_Cast_Functor : private math::Return_Fixed_Type<PixelT>
         return pixel_cast<PixelT>( pixel );
    }
 
+    /**
+     * Cast a whole row
+    */
+   template <typename ArgumentT>
+   void operator()( std::span<const ArgumentT> input,
+                    std::span<PixelT>          output ) const
+   {
+        for( size_t i = 0; i < input.size(); ++i )
+        {
+            output[i] = pixel_cast<PixelT>( input[i] );
+        }
+   }
+
 }; // End of Pixel_Cast_Functor
 
 /**
@@ -269,6 +286,78 @@ struct Pixel_Cast_Rescale_Functor : private math::Return_Fixed_Type<PixelT>
         {
             return pixel_cast_rescale<PixelT>( pixel );
         }
+
+        template <typename ArgumentT>
+        void operator()( std::span<const ArgumentT> input,
+                         std::span<PixelT>          output ) const
+        {
+            for( size_t i = 0; i < input.size(); ++i )
+            {
+                output[i] = pixel_cast_rescale<PixelT>( input[i] );
+            }
+        }
 }; // End of Pixel_Cast_Rescale_Functor
 
+/**
+ * Same result as Pixel_Cast_Rescale_Functor, but the channel rescale goes through a
+ * cached lookup table.  Only valid for 8/16-bit integer source channels.
+*/
+template <typename PixelT,
+          typename SrcPixelT>
+struct Pixel_Cast_Rescale_Lookup_Functor : private math::Return_Fixed_Type<PixelT>
+{
+    public:
+
+        typedef typename math::Compound_Channel_Type<SrcPixelT>::type src_channel_type;
+        typedef typename math::Compound_Channel_Type<PixelT>::type    dst_channel_type;
+
+        Pixel_Cast_Rescale_Lookup_Functor()
+          : m_func( channel_cast_rescale_lookup_table<src_channel_type,dst_channel_type>() ) {}
+
+        PixelT operator()( SrcPixelT pixel ) const
+        {
+            // Keep the channel precision through the format change, as pixel_cast_rescale does
+            if constexpr ( sizeof(src_channel_type) > sizeof(dst_channel_type) )
+            {
+                typedef typename math::Compound_Channel_Cast<PixelT,src_channel_type>::type mid_type;
+                return compound_apply( m_func, pixel_cast<mid_type>( pixel ) );
+            }
+            else
+            {
+                return pixel_cast<PixelT>( compound_apply( m_func, pixel ) );
+            }
+        }
+
+        void operator()( std::span<const SrcPixelT> input,
+                         std::span<PixelT>          output ) const
+        {
+            for( size_t i = 0; i < input.size(); ++i )
+            {
+                output[i] = ( *this )( input[i] );
+            }
+        }
+
+    private:
+
+        Channel_Lookup_Functor<src_channel_type,dst_channel_type> m_func;
+
+}; // End of Pixel_Cast_Rescale_Lookup_Functor
+
+/**
+ * Pick the rescaling pixel-cast functor for a source pixel type.  Small integer
+ * channels use the lookup table.
+*/
+template <typename PixelT,
+          typename SrcPixelT>
+struct Pixel_Cast_Rescale_Functor_Type
+{
+    typedef typename math::Compound_Channel_Type<SrcPixelT>::type src_channel_type;
+    typedef typename math::Compound_Channel_Type<PixelT>::type    dst_channel_type;
+
+    typedef std::conditional_t<Has_Channel_Lookup_Table<src_channel_type>::value &&
+                               !std::is_same_v<src_channel_type,dst_channel_type>,
+                               Pixel_Cast_Rescale_Lookup_Functor<PixelT,SrcPixelT>,
+                               Pixel_Cast_Rescale_Functor<PixelT>> type;
+};
+
 } // End of tmns::image::pix namespace
\ No newline at end of file
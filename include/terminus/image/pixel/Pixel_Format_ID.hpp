@@ -15,6 +15,7 @@
 #pragma once
 
 // Terminus Libraries
+#include "Float16.hpp"
 #include "Pixel_Format_Enum.hpp"
 #include "Pixel_Gray.hpp"
 #include "Pixel_GrayA.hpp"
@@ -65,6 +66,7 @@ template <> struct Pixel_Format_ID<int32_t>{  static const Pixel_Format_Enum val
 template <> struct Pixel_Format_ID<uint32_t>{ static const Pixel_Format_Enum value = Pixel_Format_Enum::SCALAR; };
 template <> struct Pixel_Format_ID<int64_t>{  static const Pixel_Format_Enum value = Pixel_Format_Enum::SCALAR; };
 template <> struct Pixel_Format_ID<uint64_t>{ static const Pixel_Format_Enum value = Pixel_Format_Enum::SCALAR; };
+template <> struct Pixel_Format_ID<Float16>{  static const Pixel_Format_Enum value = Pixel_Format_Enum::SCALAR; };
 template <> struct Pixel_Format_ID<float>{    static const Pixel_Format_Enum value = Pixel_Format_Enum::SCALAR; };
 template <> struct Pixel_Format_ID<double>{   static const Pixel_Format_Enum value = Pixel_Format_Enum::SCALAR; };
 
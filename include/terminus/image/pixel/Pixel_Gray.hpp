@@ -16,6 +16,7 @@
 
 // Terminus Image Libraries
 #include <terminus/image/pixel/Channel_Range.hpp>
+#include <terminus/image/pixel/Float16.hpp>
 #include <terminus/image/pixel/Pixel_Base.hpp>
 #include <terminus/math/types/Compound_Types.hpp>
 
@@ -131,6 +132,7 @@ namespace image {
 using PixelGray_u8  = Pixel_Gray<uint8_t>;
 using PixelGray_u16 = Pixel_Gray<uint16_t>;
 
+using PixelGray_f16  = Pixel_Gray<Float16>;
 using PixelGray_f32  = Pixel_Gray<float>;
 using PixelGray_f64  = Pixel_Gray<double>;
 
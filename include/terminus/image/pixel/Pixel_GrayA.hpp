@@ -15,6 +15,7 @@
 #pragma once
 
 // Terminus Image Libraries
+#include <terminus/image/pixel/Float16.hpp>
 #include <terminus/image/pixel/Pixel_Base.hpp>
 #include <terminus/math/types/Compound_Types.hpp>
 
@@ -109,6 +110,7 @@ using PixelGrayA_u16 = Pixel_GrayA<uint16_t>;
 using PixelGrayA_u32 = Pixel_GrayA<uint32_t>;
 using PixelGrayA_u64 = Pixel_GrayA<uint64_t>;
 
+using PixelGrayA_f16  = Pixel_GrayA<Float16>;
 using PixelGrayA_f32  = Pixel_GrayA<float>;
 using PixelGrayA_f64  = Pixel_GrayA<double>;
 
@@ -16,6 +16,7 @@
 
 // Terminus Libraries
 #include <terminus/image/pixel/Channel_Range.hpp>
+#include <terminus/image/pixel/Float16.hpp>
 #include <terminus/image/pixel/Pixel_Base.hpp>
 #include <terminus/math/types/Compound_Types.hpp>
 
@@ -185,6 +186,7 @@ namespace image {
 using PixelRGB_u8  = Pixel_RGB<uint8_t>;
 using PixelRGB_u16 = Pixel_RGB<uint16_t>;
 
+using PixelRGB_f16  = Pixel_RGB<Float16>;
 using PixelRGB_f32  = Pixel_RGB<float>;
 using PixelRGB_f64  = Pixel_RGB<double>;
 
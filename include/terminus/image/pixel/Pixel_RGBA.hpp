@@ -16,6 +16,7 @@
 
 // Terminus Libraries
 #include <terminus/image/pixel/Channel_Range.hpp>
+#include <terminus/image/pixel/Float16.hpp>
 #include <terminus/image/pixel/Pixel_Base.hpp>
 #include <terminus/math/types/Compound_Types.hpp>
 
@@ -153,6 +154,7 @@ namespace image {
 using PixelRGBA_u8  = Pixel_RGBA<uint8_t>;
 using PixelRGBA_u16 = Pixel_RGBA<uint16_t>;
 
+using PixelRGBA_f16  = Pixel_RGBA<Float16>;
 using PixelRGBA_f32  = Pixel_RGBA<float>;
 using PixelRGBA_f64  = Pixel_RGBA<double>;
 
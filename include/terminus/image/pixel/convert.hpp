@@ -20,6 +20,10 @@
 // Terminus Image Libraries
 #include "../types/Image_Buffer.hpp"
 
+// C++ Libraries
+#include <cstdint>
+#include <limits>
+
 namespace tmns::image {
 
 /// Convert any integer into a float in the -1 to +1 range.
@@ -29,6 +33,62 @@ void channel_convert_int_to_float( SrcT* src, DestT* dest )
   *dest = DestT(*src) * ( DestT( 1.0 ) / static_cast<DestT>( std::numeric_limits<SrcT>::max() ) );
 }
 
+/// Rescale a uint16 value to uint8
+inline void channel_convert_uint16_to_uint8( uint16_t* src, uint8_t* dest )
+{
+  *dest = uint8_t( *src / (65535/255) );
+}
+
+/// Rescale a uint8 value to uint16
+inline void channel_convert_uint8_to_uint16( uint8_t* src, uint16_t* dest )
+{
+  *dest = uint16_t( *src ) * (65535/255);
+}
+
+/// Convert a float in the 0 to +1 range to an integer type, clamping outside it.  NaN maps to 0.
+template <class SrcT, class DestT>
+void channel_convert_float_to_int( SrcT* src, DestT* dest )
+{
+  if( *src > SrcT(1.0) ) *dest = std::numeric_limits<DestT>::max();
+  else if( !( *src >= SrcT(0.0) ) ) *dest = DestT(0);
+  else *dest = DestT( *src * std::numeric_limits<DestT>::max() );
+}
+
+/**
+ * Controls when `convert()` splits a buffer into row bands and converts them on
+ * separate threads.  Every pixel is converted independently, so the output is
+ * identical no matter how the rows are split.  Off by default, like
+ * `ops::Rasterize_Parallel_Settings`, since each parallel call starts its own threads.
+ * Conversions run inside a parallel `ops::rasterize()` band stay on that band's thread.
+*/
+struct Convert_Parallel_Settings
+{
+    /// Max threads to use.  0 uses the hardware concurrency, 1 disables threading.
+    size_t num_threads { 1 };
+
+    /// Buffers with fewer pixels (cols x rows x planes) than this are converted serially
+    size_t min_pixels { 4 * 1024 * 1024 };
+
+    /// Each thread gets at least this many rows
+    size_t min_rows_per_thread { 64 };
+
+    /**
+     * Get the number of threads to use for a buffer of this size
+    */
+    size_t thread_count( const Image_Format& format ) const;
+
+}; // End of Convert_Parallel_Settings struct
+
+/**
+ * Get the default settings used by `convert()`
+*/
+Convert_Parallel_Settings convert_parallel_settings();
+
+/**
+ * Set the default settings used by `convert()`
+*/
+void set_convert_parallel_settings( const Convert_Parallel_Settings& settings );
+
 /**
  * Convert pixel data from input buffer-type to output type
  *
@@ -43,4 +103,17 @@ Result<void> convert( const Image_Buffer&  dst,
                       const Image_Buffer&  src,
                       bool                 rescale = false );
 
+/**
+ * Convert pixel data, splitting large buffers into row bands per the settings.
+ *
+ * @param dst Destination pixel container
+ * @param src Source pixel data
+ * @param rescale Flag if we need to scale imagery
+ * @param settings Controls the row-parallel split
+*/
+Result<void> convert( const Image_Buffer&               dst,
+                      const Image_Buffer&               src,
+                      bool                              rescale,
+                      const Convert_Parallel_Settings&  settings );
+
 } // End of tmns::image namespace
\ No newline at end of file
@@ -0,0 +1,149 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Image_Allocator.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <cstddef>
+#include <memory>
+
+namespace tmns::image {
+
+/**
+ * Source of raw pixel memory for `Image_Memory`.  Blocks are handed out as shared
+ * pointers whose deleter gives the memory back, so an allocator can recycle it.
+*/
+class Image_Allocator
+{
+    public:
+
+        typedef std::shared_ptr<Image_Allocator> ptr_t;
+
+        /**
+         * Destructor
+        */
+        virtual ~Image_Allocator() = default;
+
+        /**
+         * Allocate a block of memory
+         * @param bytes     Minimum size of the block
+         * @param alignment Byte alignment, a power of 2
+         * @return Null if the memory is not available
+        */
+        virtual std::shared_ptr<void> allocate( size_t bytes,
+                                                size_t alignment ) = 0;
+
+        /**
+         * Check if new blocks are always zero-filled, so trivial pixels need no
+         * initialization
+        */
+        virtual bool zero_filled() const { return false; }
+
+        /**
+         * Check if blocks live in files rather than RAM, so images may exceed the
+         * in-memory size limits
+        */
+        virtual bool is_file_backed() const { return false; }
+
+}; // End of Image_Allocator Class
+
+/**
+ * Allocator which recycles blocks.  Requests are rounded up to a size class (four
+ * classes per power of 2), and when the last reference to a block drops it goes on
+ * its class's free list instead of back to the heap.  Tiled jobs allocate the same
+ * few tile sizes over and over, so nearly every request after the first few is a
+ * free-list hit.
+ *
+ * Blocks may outlive the pool; they are freed normally once it is gone.
+ *
+ * Cached blocks are not counted against the `Cache_Local` tile cache or the GDAL cache
+ * budget, so the default limit only holds a handful of tiles.  Jobs which want more
+ * reuse can raise it on `instance()` with `set_max_cached_bytes()`.
+*/
+class Pooled_Image_Allocator : public Image_Allocator
+{
+    public:
+
+        typedef std::shared_ptr<Pooled_Image_Allocator> ptr_t;
+
+        /**
+         * Constructor
+         * @param max_cached_bytes Free blocks beyond this many bytes go back to the heap
+        */
+        explicit Pooled_Image_Allocator( size_t max_cached_bytes = DEFAULT_MAX_CACHED_BYTES );
+
+        /**
+         * Destructor.  Frees the cached blocks.
+        */
+        ~Pooled_Image_Allocator() override;
+
+        /**
+         * Allocate a block, reusing a cached one of the same size class if possible
+        */
+        std::shared_ptr<void> allocate( size_t bytes,
+                                        size_t alignment ) override;
+
+        /**
+         * Bytes sitting on the free lists
+        */
+        size_t cached_bytes() const;
+
+        /**
+         * Limit on cached bytes
+        */
+        size_t max_cached_bytes() const;
+
+        /**
+         * Change the limit on cached bytes, trimming the free lists if needed
+        */
+        void set_max_cached_bytes( size_t max_cached_bytes );
+
+        /**
+         * Number of requests served from the free lists
+        */
+        size_t hits() const;
+
+        /**
+         * Number of requests which went to the heap
+        */
+        size_t misses() const;
+
+        /**
+         * Release every cached block
+        */
+        void clear();
+
+        /**
+         * Round a request up to its size class
+        */
+        static size_t size_class( size_t bytes );
+
+        /**
+         * Pool shared by the tiled operations.  Starts with `DEFAULT_MAX_CACHED_BYTES`.
+        */
+        static ptr_t instance();
+
+        /// Default cache limit.  Enough for a 1 MB tile per thread on most machines.
+        static constexpr size_t DEFAULT_MAX_CACHED_BYTES = 16 * 1024 * 1024;
+
+    private:
+
+        struct Impl;
+
+        /// Free lists, shared with outstanding blocks so they can find their way back
+        std::shared_ptr<Impl> m_impl;
+
+}; // End of Pooled_Image_Allocator Class
+
+} // End of tmns::image namespace
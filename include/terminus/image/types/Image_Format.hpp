@@ -112,6 +112,17 @@ class Image_Format
         */
         bool premultiply() const;
 
+        /**
+         * Check if channels are bit-packed.  Only UINT12 and UINT14 channels can be
+         * packed, in which case each row is a contiguous bit stream and cstride() is 0.
+        */
+        bool packed() const;
+
+        /**
+         * Request bit-packed channel storage.  Ignored for channel types which cannot be packed.
+        */
+        void set_packed( bool packed );
+
         /**
          * Check if the data is fully structured.
         */
@@ -174,6 +185,9 @@ class Image_Format
         /// Premultiply
         bool m_premultiply { true };
 
+        /// Bit-packed channels
+        bool m_packed { false };
+
 }; // End of Image_Format Class
 
 } // End of tmns::image namespace
\ No newline at end of file
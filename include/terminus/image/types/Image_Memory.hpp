@@ -22,11 +22,13 @@
 #include "../pixel/Pixel_Accessor_MemStride.hpp"
 #include "Image_Base.hpp"
 #include "Image_Buffer.hpp"
+#include "Image_Memory_Policy.hpp"
 #include "Image_Resource_Base.hpp"
 #include "Image_Traits.hpp"
 
 // C++ Libraries
 #include <memory>
+#include <optional>
 
 namespace tmns::image {
 
@@ -73,7 +75,8 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
            m_planes( rhs.m_planes ),
            m_origin( rhs.m_origin ),
            m_rstride( rhs.m_rstride ),
-           m_pstride( rhs.m_pstride )
+           m_pstride( rhs.m_pstride ),
+           m_policy( rhs.m_policy )
         {}
 
         /**
@@ -87,6 +90,39 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
             set_size( cols, rows, planes );
         }
 
+        /**
+         * Build an empty image with a specific memory policy
+         */
+        Image_Memory( size_t                     cols,
+                      size_t                     rows,
+                      size_t                     planes,
+                      const Image_Memory_Policy& policy )
+          : m_policy( policy )
+        {
+            set_size( cols, rows, planes );
+        }
+
+        /**
+         * Wrap pixel memory owned by something else, such as another library's
+         * image.  The shared pointer's deleter should release that owner.
+         * @param rstride Distance between rows, in pixels
+         * @param pstride Distance between planes, in pixels
+         */
+        Image_Memory( std::shared_ptr<PixelT[]> data,
+                      size_t                    cols,
+                      size_t                    rows,
+                      size_t                    planes,
+                      size_t                    rstride,
+                      size_t                    pstride )
+          : m_data( std::move( data ) ),
+            m_rows( rows ),
+            m_cols( cols ),
+            m_planes( planes ),
+            m_origin( m_data.get() ),
+            m_rstride( rstride ),
+            m_pstride( pstride )
+        {}
+
         /**
          * Build the Image from any other "Image Type". Note this
          * comes after the Copy-Constructor above so if doing an
@@ -102,9 +138,27 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
             m_rstride( 0 ),
             m_pstride(0)
         {
-            set_size( old_image.cols(),
+            // Views may leave pixels alone, so keep them initialized
+            allocate( old_image.cols(),
+                      old_image.rows(),
+                      old_image.planes(),
+                      true );
+
+            old_image.rasterize( *this, old_image.full_bbox() );
+        }
+
+        /**
+         * Build the Image from any other "Image Type", using a specific memory policy
+         */
+        template <typename ImageT>
+        Image_Memory( const ImageT&              old_image,
+                      const Image_Memory_Policy& policy )
+          : m_policy( policy )
+        {
+            allocate( old_image.cols(),
                       old_image.rows(),
-                      old_image.planes() );
+                      old_image.planes(),
+                      true );
 
             old_image.rasterize( *this, old_image.full_bbox() );
         }
@@ -129,10 +183,11 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
                 planes = std::max( resource.planes(), resource.channels() );
             }
 
-            // Allocate Memory
-            set_size( resource.cols(),
+            // Allocate Memory.  The read fills every pixel.
+            allocate( resource.cols(),
                       resource.rows(),
-                      planes );
+                      planes,
+                      false );
 
             // Read from the buffer
             resource.read( this->buffer(),
@@ -146,9 +201,11 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
         template <typename InputImageT>
         const Image_Memory& operator = ( const Image_Base<InputImageT>& input_image )
         {
-            set_size( input_image.impl().cols(),
+            // A failed rasterize must not leave raw memory behind
+            allocate( input_image.impl().cols(),
                       input_image.impl().rows(),
-                      input_image.impl().planes() );
+                      input_image.impl().planes(),
+                      true );
 
             input_image.impl().rasterize( *this,
                                           input_image.full_bbox() );
@@ -225,8 +282,8 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
             Image_Buffer buffer( data(),
                                  base_type::format(),
                                  sizeof(PixelT),
-                                 sizeof(PixelT) * cols(),
-                                 sizeof(PixelT) * cols() * rows() );
+                                 sizeof(PixelT) * m_rstride,
+                                 sizeof(PixelT) * m_pstride );
             return buffer;
         }
 
@@ -245,74 +302,35 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
                                size_t rows,
                                size_t planes = 1 )
         {
-            // Check if already the correct size
-            if( cols == m_cols && rows == m_rows && planes == m_planes )
-            {
-                return outcome::ok();
-            }
-
-            /// Hypothetical Max Sizes
-            static const size_t MAX_PIXEL_SIZE   = 100000;
-            static const size_t MAX_PLANE_COUNT  = 1024;
-            static const size_t MAX_TOTAL_PIXELS = 6400000000;
-
-            // Don't oversize
-            if( cols >= MAX_PIXEL_SIZE && rows >= MAX_PIXEL_SIZE )
-            {
-                std::stringstream sout;
-                sout << "Will not allocate more than " << MAX_PIXEL_SIZE-1
-                     << " pixels on a side.";
-                return outcome::fail( core::error::ErrorCode::OUT_OF_BOUNDS,
-                                      sout.str() );
-            }
-            if( planes >= MAX_PLANE_COUNT )
-            {
-                std::stringstream sout;
-                sout << "Will not allocate more than " << MAX_PLANE_COUNT-1
-                     << " planes in the image.";
-                return outcome::fail( core::error::ErrorCode::OUT_OF_BOUNDS,
-                                      sout.str() );
-            }
-
-            uintmax_t num_pixels = cols * rows * planes;
-            if( num_pixels >= MAX_TOTAL_PIXELS )
-            {
-                std::stringstream sout;
-                sout << "Will not allocate more than " << MAX_TOTAL_PIXELS-1
-                     << " pixels in the image.";
-                return outcome::fail( core::error::ErrorCode::OUT_OF_BOUNDS,
-                                      sout.str() );
-            }
-
-            if( num_pixels == 0 )
-            {
-                m_data.reset();
-            }
-            else
-            {
-                // I like this catch because we can wrap the result and not throw
-                std::shared_ptr<PixelT[]> data( new (std::nothrow) PixelT[num_pixels] );
+            return allocate( cols, rows, planes, true );
+        }
 
-                if( !data )
-                {
-                    std::stringstream sout;
-                    sout << "Cannot allocate enough memory for a " << m_cols << " x "
-                         << m_rows << " x " << planes << " image.";
-                    return outcome::fail( core::error::ErrorCode::OUT_OF_MEMORY,
-                                          sout.str() );
-                }
+        /**
+         * Get the memory layout policy.  Until the image is first allocated, this is
+         * the current default.
+        */
+        Image_Memory_Policy policy() const
+        {
+            return m_policy ? *m_policy : image_memory_policy();
+        }
 
-                m_data = data;
-            }
+        /**
+         * Get the distance between rows, in pixels.  Larger than `cols()` when padded.
+        */
+        size_t row_stride() const { return m_rstride; }
 
-            m_cols    = cols;
-            m_rows    = rows;
-            m_planes  = planes;
-            m_origin  = m_data.get();
-            m_rstride = cols;
-            m_pstride = rows*cols;
+        /**
+         * Get the distance between planes, in pixels
+        */
+        size_t plane_stride() const { return m_pstride; }
 
-            return outcome::ok();
+        /**
+         * Check if the pixels are one gap-free run, so the whole image can be
+         * treated as a single array of `cols * rows * planes` pixels.
+        */
+        bool is_contiguous() const
+        {
+            return m_rstride == m_cols && m_pstride == m_rows * m_cols;
         }
 
         void reset()
@@ -377,6 +395,121 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
 
     private:
 
+        /**
+         * Resize the image, allocating new memory if the size has changed.
+         * @param initialize Construct the new pixels.  Skipped for trivial pixel types
+         *                   when the caller is about to overwrite all of them.
+        */
+        Result<void> allocate( size_t cols,
+                               size_t rows,
+                               size_t planes,
+                               bool   initialize )
+        {
+            // Check if already the correct size
+            if( cols == m_cols && rows == m_rows && planes == m_planes )
+            {
+                return outcome::ok();
+            }
+
+            // Take the default policy on first use, so building an empty image never locks
+            if( !m_policy )
+            {
+                m_policy = image_memory_policy();
+            }
+            const Image_Memory_Policy& policy = *m_policy;
+
+            /// Hypothetical Max Sizes
+            static const size_t MAX_PIXEL_SIZE   = 100000;
+            static const size_t MAX_PLANE_COUNT  = 1024;
+            static const size_t MAX_TOTAL_PIXELS = 6400000000;
+
+            // Don't oversize.  File-backed images are only limited by the disk.
+            bool file_backed = policy.allocator && policy.allocator->is_file_backed();
+            if( !file_backed && cols >= MAX_PIXEL_SIZE && rows >= MAX_PIXEL_SIZE )
+            {
+                std::stringstream sout;
+                sout << "Will not allocate more than " << MAX_PIXEL_SIZE-1
+                     << " pixels on a side.";
+                return outcome::fail( core::error::ErrorCode::OUT_OF_BOUNDS,
+                                      sout.str() );
+            }
+            if( planes >= MAX_PLANE_COUNT )
+            {
+                std::stringstream sout;
+                sout << "Will not allocate more than " << MAX_PLANE_COUNT-1
+                     << " planes in the image.";
+                return outcome::fail( core::error::ErrorCode::OUT_OF_BOUNDS,
+                                      sout.str() );
+            }
+
+            if( !policy.is_valid() )
+            {
+                std::stringstream sout;
+                sout << "Image memory alignment of " << policy.alignment
+                     << " is not a power of 2.";
+                return outcome::fail( core::error::ErrorCode::INVALID_CONFIGURATION,
+                                      sout.str() );
+            }
+
+            // File-backed images skip the size limits, so the products themselves must be checked
+            size_t num_pixels  = 0;
+            size_t buffer_size = 0;
+            size_t rstride     = policy.template row_stride<PixelT>( cols );
+            if( rstride < cols ||
+                detail::multiply_overflows( cols, rows, num_pixels ) ||
+                detail::multiply_overflows( num_pixels, planes, num_pixels ) ||
+                detail::multiply_overflows( rstride, rows, buffer_size ) ||
+                detail::multiply_overflows( buffer_size, planes, buffer_size ) )
+            {
+                std::stringstream sout;
+                sout << "Image size of " << cols << " x " << rows << " x " << planes
+                     << " overflows the addressable memory.";
+                return outcome::fail( core::error::ErrorCode::OUT_OF_BOUNDS,
+                                      sout.str() );
+            }
+            if( !file_backed && num_pixels >= MAX_TOTAL_PIXELS )
+            {
+                std::stringstream sout;
+                sout << "Will not allocate more than " << MAX_TOTAL_PIXELS-1
+                     << " pixels in the image.";
+                return outcome::fail( core::error::ErrorCode::OUT_OF_BOUNDS,
+                                      sout.str() );
+            }
+
+            if( num_pixels == 0 )
+            {
+                m_data.reset();
+            }
+            else
+            {
+                // I like this catch because we can wrap the result and not throw
+                auto data = detail::allocate_pixels<PixelT>( buffer_size,
+                                                             policy.alignment,
+                                                             initialize,
+                                                             policy.allocator );
+
+                if( !data )
+                {
+                    std::stringstream sout;
+                    sout << "Cannot allocate enough memory for a " << m_cols << " x "
+                         << m_rows << " x " << planes << " image.";
+                    return outcome::fail( core::error::ErrorCode::OUT_OF_MEMORY,
+                                          sout.str() );
+                }
+
+                m_data = data;
+            }
+
+            m_cols    = cols;
+            m_rows    = rows;
+            m_planes  = planes;
+            m_origin  = m_data.get();
+            m_rstride = rstride;
+            m_pstride = rows*rstride;
+
+            return outcome::ok();
+        }
+
         /// Pixel Data
         std::shared_ptr<PixelT[]> m_data;
 
@@ -391,6 +524,9 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
         size_t m_rstride { 0 };
         size_t m_pstride { 0 };
 
+        /// Memory Layout Policy.  Empty until set or first allocated.
+        std::optional<Image_Memory_Policy> m_policy;
+
 }; // End of Image_Memory Class
 
 template <typename PixelT>
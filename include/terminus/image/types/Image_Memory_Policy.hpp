@@ -0,0 +1,222 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Image_Memory_Policy.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "Image_Allocator.hpp"
+
+// C++ Libraries
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <type_traits>
+
+namespace tmns::image {
+
+/**
+ * Controls how `Image_Memory` lays out its pixels.  Every buffer starts on an
+ * `alignment` boundary.  With `pad_rows` set, the row stride is also rounded up so
+ * every row starts on that boundary, at the cost of a few unused pixels per row.
+ * Padded images are no longer one contiguous run, so anything walking the raw data
+ * must go through the strides in `buffer()` or the pixel accessor.
+*/
+struct Image_Memory_Policy
+{
+    /// Byte alignment of the buffer (and of each row when padding).  Must be a power of 2.
+    size_t alignment { 64 };
+
+    /// Pad the row stride so every row starts aligned
+    bool pad_rows { false };
+
+    /// Where the memory comes from.  Null uses the heap directly.
+    Image_Allocator::ptr_t allocator { nullptr };
+
+    /**
+     * Check if the alignment is usable
+    */
+    bool is_valid() const
+    {
+        return alignment > 0 && ( alignment & ( alignment - 1 ) ) == 0;
+    }
+
+    /**
+     * Get the row stride, in pixels, for a row of the given width
+    */
+    template <typename PixelT>
+    size_t row_stride( size_t cols ) const
+    {
+        if( !pad_rows || cols == 0 )
+        {
+            return cols;
+        }
+
+        // Smallest pixel count whose byte size is a multiple of the alignment
+        size_t step = alignment / std::gcd( alignment, sizeof(PixelT) );
+        return ( cols + step - 1 ) / step * step;
+    }
+
+}; // End of Image_Memory_Policy struct
+
+namespace detail {
+
+/**
+ * Multiply two sizes, reporting whether the product wrapped
+ * @return True on overflow, in which case `result` is unspecified
+*/
+inline bool multiply_overflows( size_t  a,
+                                size_t  b,
+                                size_t& result )
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_mul_overflow( a, b, &result );
+#else
+    if( a != 0 && b > std::numeric_limits<size_t>::max() / a )
+    {
+        return true;
+    }
+    result = a * b;
+    return false;
+#endif
+}
+
+/// Guards the default memory policy
+inline std::mutex g_image_memory_policy_mtx;
+
+/// Default memory policy
+inline Image_Memory_Policy g_image_memory_policy;
+
+/**
+ * Pixels which can live in raw memory without running a constructor, since they
+ * are trivially copyable and destructible.
+*/
+template <typename PixelT>
+inline constexpr bool Is_Implicit_Lifetime_Pixel = std::is_trivially_copyable_v<PixelT> &&
+                                                   std::is_trivially_destructible_v<PixelT>;
+
+/**
+ * Allocate an aligned pixel array.
+ *
+ * @param count      Number of pixels
+ * @param alignment  Byte alignment, a power of 2
+ * @param initialize Default-construct the pixels.  If false, trivial pixel types are
+ *                   left as raw memory for the caller to overwrite.
+ * @param allocator  Memory source, or null for the heap
+ * @return Null if the allocation failed or the byte size overflows
+*/
+template <typename PixelT>
+std::shared_ptr<PixelT[]> allocate_pixels( size_t                        count,
+                                           size_t                        alignment,
+                                           bool                          initialize,
+                                           const Image_Allocator::ptr_t& allocator = nullptr )
+{
+    size_t bytes = 0;
+    if( multiply_overflows( count, sizeof(PixelT), bytes ) )
+    {
+        return {};
+    }
+
+    std::align_val_t align { std::max( alignment, alignof(PixelT) ) };
+    PixelT* data = nullptr;
+    std::shared_ptr<void> block;
+    if( allocator )
+    {
+        block = allocator->allocate( bytes, size_t( align ) );
+        data  = static_cast<PixelT*>( block.get() );
+    }
+    else
+    {
+        data = static_cast<PixelT*>( ::operator new( bytes, align, std::nothrow ) );
+    }
+    if( !data )
+    {
+        return {};
+    }
+
+    // Zero-filled memory already holds default pixels, and touching it all would fault
+    // in every page of a file-backed image
+    if( allocator && allocator->zero_filled() && Is_Implicit_Lifetime_Pixel<PixelT> )
+    {
+        initialize = false;
+    }
+
+    if( initialize || !Is_Implicit_Lifetime_Pixel<PixelT> )
+    {
+        try
+        {
+            std::uninitialized_default_construct_n( data, count );
+        }
+        catch( ... )
+        {
+            if( !block )
+            {
+                ::operator delete( data, align );
+            }
+            throw;
+        }
+    }
+
+    // Allocator blocks go back through their own deleter
+    if( block )
+    {
+        return std::shared_ptr<PixelT[]>( data, [count,block]( PixelT* ptr ){
+            std::destroy_n( ptr, count );
+        });
+    }
+    return std::shared_ptr<PixelT[]>( data, [count,align]( PixelT* ptr ){
+        std::destroy_n( ptr, count );
+        ::operator delete( ptr, align );
+    });
+}
+
+} // End of detail namespace
+
+/**
+ * Get the policy used by new `Image_Memory` instances.  An image takes it when it is
+ * first allocated, unless it was given a policy of its own.
+*/
+inline Image_Memory_Policy image_memory_policy()
+{
+    std::unique_lock<std::mutex> lck( detail::g_image_memory_policy_mtx );
+    return detail::g_image_memory_policy;
+}
+
+/**
+ * Set the policy used by new `Image_Memory` instances.  Existing images keep theirs.
+*/
+inline void set_image_memory_policy( const Image_Memory_Policy& policy )
+{
+    std::unique_lock<std::mutex> lck( detail::g_image_memory_policy_mtx );
+    detail::g_image_memory_policy = policy;
+}
+
+/**
+ * Get the policy for short-lived tiles, which are allocated over and over.  Same as
+ * the default policy, but draws from the shared pool unless it names an allocator.
+*/
+inline Image_Memory_Policy tile_memory_policy()
+{
+    auto policy = image_memory_policy();
+    if( !policy.allocator )
+    {
+        policy.allocator = Pooled_Image_Allocator::instance();
+    }
+    return policy;
+}
+
+} // End of tmns::image namespace
@@ -0,0 +1,109 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Mapped_Image_Allocator.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "Image_Allocator.hpp"
+
+// C++ Libraries
+#include <filesystem>
+#include <string>
+
+namespace tmns::image {
+
+/**
+ * How pixels in a mapped image will be visited, so the OS can read ahead or not
+*/
+enum class Mapped_Access_Pattern
+{
+    NORMAL     = 0 /**< No hint */,
+    SEQUENTIAL = 1 /**< Rows in order, such as rasterizing or writing out */,
+    RANDOM     = 2 /**< Scattered, such as warping or feature lookups */,
+}; // End of Mapped_Access_Pattern enum
+
+/**
+ * Convert the access pattern to a string
+*/
+std::string enum_to_string( Mapped_Access_Pattern pattern );
+
+/**
+ * Allocator which puts every block in its own memory-mapped scratch file, so images
+ * can be much larger than RAM and the OS pages them in and out as needed.  The files
+ * are unlinked as soon as they are mapped, so nothing is left behind on exit.
+ *
+ * Use it through `Image_Memory_Policy::allocator`; images, views and accessors work
+ * exactly as they do with heap memory.
+*/
+class Mapped_Image_Allocator : public Image_Allocator
+{
+    public:
+
+        typedef std::shared_ptr<Mapped_Image_Allocator> ptr_t;
+
+        /**
+         * Constructor
+         * @param scratch_dir Directory for the scratch files.  Needs room for the images.
+         * @param pattern     Expected access pattern
+        */
+        explicit Mapped_Image_Allocator( const std::filesystem::path& scratch_dir = std::filesystem::temp_directory_path(),
+                                         Mapped_Access_Pattern        pattern     = Mapped_Access_Pattern::SEQUENTIAL );
+
+        /**
+         * Map a new zero-filled scratch file.  Mappings are page aligned, which covers
+         * any alignment up to the page size.
+        */
+        std::shared_ptr<void> allocate( size_t bytes,
+                                        size_t alignment ) override;
+
+        /**
+         * New files read as zeros
+        */
+        bool zero_filled() const override { return true; }
+
+        /**
+         * Blocks live in files
+        */
+        bool is_file_backed() const override { return true; }
+
+        /**
+         * Get the scratch directory
+        */
+        const std::filesystem::path& scratch_dir() const { return m_scratch_dir; }
+
+        /**
+         * Get the access pattern
+        */
+        Mapped_Access_Pattern access_pattern() const { return m_pattern; }
+
+        /**
+         * Change the access hint for part of a mapped block, such as before switching
+         * from writing rows to random lookups.
+         * @return False if the hint was refused
+        */
+        static bool advise( void*                 data,
+                            size_t                bytes,
+                            Mapped_Access_Pattern pattern );
+
+    private:
+
+        /// Directory for scratch files
+        std::filesystem::path m_scratch_dir;
+
+        /// Access hint for new mappings
+        Mapped_Access_Pattern m_pattern;
+
+}; // End of Mapped_Image_Allocator Class
+
+} // End of tmns::image namespace
@@ -0,0 +1,309 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Packed_Image_Memory.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include "../operations/crop_image.hpp"
+#include "../pixel/Packed_Channel_Utilities.hpp"
+#include "../pixel/Pixel_Accessor_Loose.hpp"
+#include "Image_Base.hpp"
+#include "Image_Memory.hpp"
+
+// C++ Libraries
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace tmns::image {
+
+/**
+ * In-memory image which keeps 12/14-bit data bit-packed.  Pixels stay 16-bit in the
+ * API; only the storage shrinks.  Images whose pixels don't have uint16_t channels,
+ * or whose values don't fit the storage type, are simply kept as an Image_Memory.
+ *
+ * Fill the image through `image()`, then call `pack()`.
+*/
+template <typename PixelT>
+class Packed_Image_Memory : public Image_Base<Packed_Image_Memory<PixelT>>
+{
+    public:
+
+        /// Pixel Type
+        typedef PixelT pixel_type;
+
+        /// Pixels are unpacked on access, so return by value
+        typedef PixelT result_type;
+
+        /// Pixel Access Type
+        typedef Pixel_Accessor_Loose<Packed_Image_Memory> pixel_accessor;
+
+        /// Prerasterize Type
+        typedef ops::Crop_View<Image_Memory<PixelT>> prerasterize_type;
+
+        /// Number of channels per pixel
+        static constexpr size_t NUM_CHANNELS = math::Compound_Channel_Count<PixelT>::value;
+
+        /**
+         * Check if pixels of this type can ever be packed
+        */
+        static constexpr bool pixel_is_packable()
+        {
+            return std::is_same_v<typename math::Compound_Channel_Type<PixelT>::type,uint16_t> &&
+                   sizeof(PixelT) == NUM_CHANNELS * sizeof(uint16_t);
+        }
+
+        /**
+         * Check if an image of this pixel type would be packed for the storage type
+        */
+        static bool can_pack( Channel_Type_Enum storage_type )
+        {
+            return pixel_is_packable() && is_packable_type( storage_type );
+        }
+
+        /**
+         * Default Constructor
+        */
+        Packed_Image_Memory() = default;
+
+        /**
+         * Allocate an unpacked image
+         * @param storage_type Channel type to pack into.  Anything other than UINT12/UINT14
+         *                     leaves the image unpacked.
+         * @param policy       Memory policy for the unpacked image
+        */
+        Packed_Image_Memory( size_t                     cols,
+                             size_t                     rows,
+                             size_t                     planes,
+                             Channel_Type_Enum          storage_type,
+                             const Image_Memory_Policy& policy = image_memory_policy() )
+          : m_image( cols, rows, planes, policy ),
+            m_cols( cols ),
+            m_rows( rows ),
+            m_planes( planes ),
+            m_storage_type( storage_type )
+        {}
+
+        /**
+         * Number of image columns
+        */
+        size_t cols() const { return m_cols; }
+
+        /**
+         * Number of image rows
+        */
+        size_t rows() const { return m_rows; }
+
+        /**
+         * Number of image planes
+        */
+        size_t planes() const { return m_planes; }
+
+        /**
+         * Check if the data is currently packed
+        */
+        bool is_packed() const { return m_packed != nullptr; }
+
+        /**
+         * Get the unpacked image.  Only valid before packing.
+        */
+        const Image_Memory<PixelT>& image() const { return m_image; }
+
+        /**
+         * Bytes used to store the pixels
+        */
+        size_t size_bytes() const
+        {
+            if( is_packed() )
+            {
+                return m_packed->size();
+            }
+            return m_cols * m_rows * m_planes * sizeof(PixelT);
+        }
+
+        /**
+         * Pack the image, releasing the unpacked copy.  If any value doesn't fit the storage
+         * type the image stays unpacked, so data is never lost.
+         * @return True if the image is now packed
+        */
+        bool pack()
+        {
+            if constexpr( pixel_is_packable() )
+            {
+                if( is_packed() || !can_pack( m_storage_type ) || !m_image.is_valid_image() )
+                {
+                    return is_packed();
+                }
+
+                m_bits    = channel_size_bits( m_storage_type ).value();
+                m_rstride = packed_size_bytes( m_bits, m_cols * NUM_CHANNELS );
+                auto packed = std::make_shared<std::vector<uint8_t>>( m_rstride * m_rows * m_planes );
+                for( size_t p = 0; p < m_planes; ++p )
+                for( size_t r = 0; r < m_rows; ++r )
+                {
+                    auto fits = pack_channels( m_storage_type,
+                                               (const uint16_t*)&m_image( 0, r, p ),
+                                               packed->data() + ( p * m_rows + r ) * m_rstride,
+                                               m_cols * NUM_CHANNELS );
+                    if( fits.has_error() || !fits.value() )
+                    {
+                        return false;
+                    }
+                }
+                m_packed = packed;
+                m_image.reset();
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * Get the pixel origin
+        */
+        pixel_accessor origin() const
+        {
+            return pixel_accessor( *this, 0, 0, 0 );
+        }
+
+        /**
+         * Fetch a single pixel.  Prefer rasterize() for more than a few pixels.
+        */
+        result_type operator()( size_t col,
+                                size_t row,
+                                size_t plane = 0 ) const
+        {
+            if constexpr( pixel_is_packable() )
+            {
+                if( is_packed() )
+                {
+                    const uint8_t* row_ptr = m_packed->data() + ( plane * m_rows + row ) * m_rstride;
+                    uint16_t values[NUM_CHANNELS];
+                    for( size_t ch = 0; ch < NUM_CHANNELS; ++ch )
+                    {
+                        values[ch] = packed_value( row_ptr, col * NUM_CHANNELS + ch, m_bits );
+                    }
+                    PixelT result;
+                    std::memcpy( (void*)&result, values, sizeof(PixelT) );
+                    return result;
+                }
+            }
+            return m_image( col, row, plane );
+        }
+
+        /**
+         * Get an unpacked copy of the region, addressed in this image's coordinates
+        */
+        prerasterize_type prerasterize( const math::Rect2i& bbox ) const
+        {
+            if( !is_packed() )
+            {
+                return prerasterize_type( m_image, math::Rect2i( 0, 0, m_cols, m_rows ) );
+            }
+
+            // "Fake" the bbox image so it looks like a full size image.
+            return prerasterize_type( unpack( bbox ),
+                                      math::Rect2i( -bbox.min().x(),
+                                                    -bbox.min().y(),
+                                                    m_cols,
+                                                    m_rows ) );
+        }
+
+        /**
+         * Rasterize the region, unpacking only the rows it touches
+        */
+        template <class DestT>
+        void rasterize( const DestT&        dest,
+                        const math::Rect2i& bbox ) const
+        {
+            if( !is_packed() )
+            {
+                m_image.rasterize( dest, bbox );
+                return;
+            }
+            auto region = unpack( bbox );
+            region.rasterize( dest, math::Rect2i( 0, 0, bbox.width(), bbox.height() ) );
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Packed_Image_Memory";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + math::Compound_Name<pixel_type>::name() + ">";
+        }
+
+    private:
+
+        /**
+         * Unpack a region into a new image, decoding only the values inside it
+        */
+        Image_Memory<PixelT> unpack( const math::Rect2i& bbox ) const
+        {
+            Image_Memory<PixelT> result( bbox.width(), bbox.height(), m_planes );
+            if constexpr( pixel_is_packable() )
+            {
+                // Values land on a byte boundary once every `group`, so decode from the
+                // last boundary at or before the first column
+                const size_t group   = 8 / std::gcd( m_bits, size_t( 8 ) );
+                const size_t first   = bbox.min().x() * NUM_CHANNELS;
+                const size_t aligned = first - first % group;
+                const size_t count   = ( bbox.min().x() + bbox.width() ) * NUM_CHANNELS - aligned;
+
+                std::vector<uint16_t> row_values( count );
+                for( size_t p = 0; p < m_planes; ++p )
+                for( int r = 0; r < bbox.height(); ++r )
+                {
+                    const uint8_t* row_ptr = m_packed->data() + ( p * m_rows + bbox.min().y() + r ) * m_rstride;
+                    unpack_channels( m_storage_type,
+                                     row_ptr + aligned * m_bits / 8,
+                                     row_values.data(),
+                                     count );
+                    std::memcpy( (void*)&result( 0, r, p ),
+                                 row_values.data() + ( first - aligned ),
+                                 bbox.width() * sizeof(PixelT) );
+                }
+            }
+            return result;
+        }
+
+        /// Unpacked pixels, empty once packed
+        Image_Memory<PixelT> m_image;
+
+        /// Packed bytes, one bit stream per row
+        std::shared_ptr<std::vector<uint8_t>> m_packed;
+
+        /// Image Dimensions
+        size_t m_cols { 0 };
+        size_t m_rows { 0 };
+        size_t m_planes { 0 };
+
+        /// Storage Channel Type
+        Channel_Type_Enum m_storage_type { Channel_Type_Enum::UNKNOWN };
+
+        /// Bits per packed value
+        size_t m_bits { 0 };
+
+        /// Bytes per packed row
+        size_t m_rstride { 0 };
+
+}; // End of Packed_Image_Memory Class
+
+} // End of tmns::image namespace
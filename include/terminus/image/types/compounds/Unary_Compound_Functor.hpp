@@ -15,6 +15,8 @@
 #pragma once
 
 // C++ Libraries
+#include <cstddef>
+#include <span>
 #include <type_traits>
 
 namespace tmns::image::cmp {
@@ -72,6 +74,41 @@ class Unary_Compound_Functor
                           ArgT>::construct( m_func, arg );
         }
 
+        /**
+         * Apply the functor to a whole row.  When both pixel types are plain arrays of
+         * channels, the row is treated as one flat run of channels, which the compiler
+         * can vectorize.
+        */
+        template <typename ArgT,
+                  typename ResultT>
+        void operator()( std::span<const ArgT> input,
+                         std::span<ResultT>    output ) const
+        {
+            typedef typename math::Compound_Channel_Type<ArgT>::type    arg_channel_type;
+            typedef typename math::Compound_Channel_Type<ResultT>::type result_channel_type;
+            constexpr size_t channels = math::Compound_Channel_Count<ArgT>::value;
+
+            if constexpr( channels == math::Compound_Channel_Count<ResultT>::value &&
+                          sizeof(ArgT)    == channels * sizeof(arg_channel_type) &&
+                          sizeof(ResultT) == channels * sizeof(result_channel_type) )
+            {
+                const arg_channel_type* src = reinterpret_cast<const arg_channel_type*>( input.data() );
+                result_channel_type*    dst = reinterpret_cast<result_channel_type*>( output.data() );
+                const size_t count = input.size() * channels;
+                for( size_t i = 0; i < count; ++i )
+                {
+                    dst[i] = result_channel_type( m_func( src[i] ) );
+                }
+            }
+            else
+            {
+                for( size_t i = 0; i < input.size(); ++i )
+                {
+                    output[i] = ( *this )( input[i] );
+                }
+            }
+        }
+
     private:
 
         /**
@@ -19,27 +19,275 @@
 
 // Terminus Libraries
 #include <terminus/core/utility/Progress_Callback.hpp>
+#include <terminus/core/work/Thread.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace tmns::image {
 
+/**
+ * Controls when `for_each_pixel()` splits the rows into bands and visits them on
+ * separate threads.  Only functors that can be merged are ever split; see
+ * Is_Mergeable_Functor.  Off by default, since the images must then be safe to read
+ * from several threads at once.
+*/
+struct For_Each_Pixel_Settings
+{
+    /// Max threads to use.  0 uses the hardware concurrency, 1 disables threading.
+    size_t num_threads { 1 };
 
-/// Function to apply a functor to each pixel of an input image.
+    /// Images with fewer pixels (cols x rows x planes) than this are visited serially
+    size_t min_pixels { 1024 * 1024 };
+
+    /// Each thread gets at least this many rows
+    size_t min_rows_per_thread { 16 };
+
+    /**
+     * Get the number of threads to use for an image of this size
+    */
+    size_t thread_count( size_t cols,
+                         size_t rows,
+                         size_t planes ) const
+    {
+        if( num_threads == 1 || cols * rows * planes < min_pixels || rows < 2 )
+        {
+            return 1;
+        }
+
+        size_t threads = ( num_threads == 0 ) ? std::max<size_t>( std::thread::hardware_concurrency(), 1 )
+                                              : num_threads;
+        size_t max_by_rows = rows / std::max<size_t>( min_rows_per_thread, 1 );
+        return std::max<size_t>( std::min( threads, max_by_rows ), 1 );
+    }
+
+}; // End of For_Each_Pixel_Settings struct
+
+/**
+ * Check if a functor has a `void reset()` method which clears its accumulated state
+*/
+template <typename FunctorT, typename = void>
+struct Is_Resettable_Functor : std::false_type {};
+
+template <typename FunctorT>
+struct Is_Resettable_Functor<FunctorT,
+                             std::void_t<decltype( std::declval<FunctorT&>().reset() )>>
+    : std::bool_constant<std::is_copy_constructible_v<FunctorT>> {};
+
+/**
+ * A functor can be split across threads if it has a `void merge( const FunctorT& other )`
+ * method which folds another copy's results into its own, and extra threads can start
+ * from an empty one.  Those are copies with `reset()` called, if the functor has it, and
+ * default-constructed functors otherwise.  The caller's functor keeps whatever it
+ * already held, and every pixel is counted once.
+*/
+template <typename FunctorT, typename = void>
+struct Is_Mergeable_Functor : std::false_type {};
+
+template <typename FunctorT>
+struct Is_Mergeable_Functor<FunctorT,
+                            std::void_t<decltype( std::declval<FunctorT&>().merge( std::declval<const FunctorT&>() ) )>>
+    : std::bool_constant<!std::is_const_v<FunctorT> &&
+                         ( Is_Resettable_Functor<FunctorT>::value ||
+                           std::is_default_constructible_v<FunctorT> )> {};
+
+namespace detail {
+
+/**
+ * Get an empty functor for an extra thread
+*/
+template <typename FunctorT>
+FunctorT fresh_functor( const FunctorT& func )
+{
+    if constexpr( Is_Resettable_Functor<FunctorT>::value )
+    {
+        FunctorT fresh( func );
+        fresh.reset();
+        return fresh;
+    }
+    else
+    {
+        return FunctorT();
+    }
+}
+
+/// Guards the default parallel settings
+inline std::mutex g_for_each_pixel_mtx;
+
+/// Default parallel settings
+inline For_Each_Pixel_Settings g_for_each_pixel_settings;
+
+/**
+ * Visits one row band with its own copy of the functor
+*/
+template <typename FunctorT, typename BandT>
+class For_Each_Pixel_Band_Task
+{
+    public:
+
+        For_Each_Pixel_Band_Task( FunctorT&&      func,
+                                  const BandT&    band,
+                                  int             start_row,
+                                  int             num_rows )
+          : m_func( std::move( func ) ),
+            m_band( band ),
+            m_start_row( start_row ),
+            m_num_rows( num_rows ) {}
+
+        void operator()()
+        {
+            try
+            {
+                m_band( m_func, m_start_row, m_num_rows, nullptr );
+            }
+            catch( ... )
+            {
+                m_error = std::current_exception();
+            }
+        }
+
+        const FunctorT& func() const
+        {
+            return m_func;
+        }
+
+        const std::exception_ptr& error() const
+        {
+            return m_error;
+        }
+
+    private:
+
+        FunctorT            m_func;
+        const BandT&        m_band;
+        int                 m_start_row;
+        int                 m_num_rows;
+        std::exception_ptr  m_error;
+
+}; // End of For_Each_Pixel_Band_Task class
+
+/**
+ * Visit every row, splitting into bands per the settings when the functor can be merged.
+ * The band callable is `band( func, start_row, num_rows, progress )`.  Only the
+ * caller's thread reports progress, for its own band.
+*/
+template <typename FunctorT, typename BandT>
+void for_each_pixel_bands( FunctorT&                          func,
+                           const BandT&                       band,
+                           size_t                             cols,
+                           size_t                             rows,
+                           size_t                             planes,
+                           core::utility::Progress_Callback*  progress,
+                           const For_Each_Pixel_Settings&     settings )
+{
+    size_t num_threads = 1;
+    if constexpr( Is_Mergeable_Functor<FunctorT>::value )
+    {
+        num_threads = settings.thread_count( cols, rows, planes );
+    }
+    if( num_threads <= 1 )
+    {
+        band( func, 0, rows, progress );
+        return;
+    }
+
+    if constexpr( Is_Mergeable_Functor<FunctorT>::value )
+    {
+        // Extra threads start empty, so the caller's state is only counted once
+        typedef For_Each_Pixel_Band_Task<FunctorT,BandT> Task_Type;
+        std::vector<std::shared_ptr<Task_Type>> tasks;
+        for( size_t i = 1; i < num_threads; ++i )
+        {
+            size_t start_row = ( rows * i ) / num_threads;
+            size_t end_row   = ( rows * ( i + 1 ) ) / num_threads;
+            tasks.push_back( std::make_shared<Task_Type>( fresh_functor( func ), band, start_row, end_row - start_row ) );
+        }
+
+        std::vector<std::shared_ptr<core::work::Thread>> threads;
+        for( auto& task : tasks )
+        {
+            threads.push_back( std::make_shared<core::work::Thread>( task ) );
+        }
+
+        std::exception_ptr error;
+        try
+        {
+            band( func, 0, rows / num_threads, progress );
+        }
+        catch( ... )
+        {
+            error = std::current_exception();
+        }
+
+        for( auto& thread : threads )
+        {
+            thread->join();
+        }
+
+        // Merge in row order, so the result doesn't depend on thread timing
+        for( const auto& task : tasks )
+        {
+            if( !error && task->error() )
+            {
+                error = task->error();
+            }
+            func.merge( task->func() );
+        }
+        if( error )
+        {
+            std::rethrow_exception( error );
+        }
+    }
+}
+
+} // End of detail namespace
+
+/**
+ * Get the default settings used by `for_each_pixel()`
+*/
+inline For_Each_Pixel_Settings for_each_pixel_settings()
+{
+    std::unique_lock<std::mutex> lck( detail::g_for_each_pixel_mtx );
+    return detail::g_for_each_pixel_settings;
+}
+
+/**
+ * Set the default settings used by `for_each_pixel()`
+*/
+inline void set_for_each_pixel_settings( const For_Each_Pixel_Settings& settings )
+{
+    std::unique_lock<std::mutex> lck( detail::g_for_each_pixel_mtx );
+    detail::g_for_each_pixel_settings = settings;
+}
+
+/// Apply a functor to each pixel in rows [start_row, start_row + num_rows) of every plane.
 template <typename ImageT,
           typename FunctorT>
-void for_each_pixel_( const Image_Base<ImageT>&         image_,
-                      FunctorT&                         func,
-                      core::utility::Progress_Callback& progress )
+void for_each_pixel_rows_( const ImageT&                      image,
+                           FunctorT&                          func,
+                           int                                start_row,
+                           int                                num_rows,
+                           core::utility::Progress_Callback*  progress )
 {
-    const ImageT& image = image_.impl();
     typedef typename ImageT::pixel_accessor pixel_accessor;
-    pixel_accessor plane_acc = image.origin();
+    pixel_accessor plane_acc = image.origin().advance( 0, start_row );
     for( int plane = image.planes(); plane; --plane )
     { 
         // Loop through planes
         pixel_accessor row_acc = plane_acc;
-        for( int row = 0; row < image.rows(); ++row ) // Loop through rows
+        for( int row = 0; row < num_rows; ++row ) // Loop through rows
         { 
-            progress.report_fractional_progress( row, image.rows() );
+            if( progress )
+            {
+                progress->report_fractional_progress( row, num_rows );
+            }
             pixel_accessor col_acc = row_acc;
             for( int col = image.cols(); col; --col ) // Loop through columns
             {
@@ -50,6 +298,25 @@ void for_each_pixel_( const Image_Base<ImageT>&         image_,
         }
         plane_acc.next_plane();
     }
+}
+
+/// Function to apply a functor to each pixel of an input image.
+template <typename ImageT,
+          typename FunctorT>
+void for_each_pixel_( const Image_Base<ImageT>&         image_,
+                      FunctorT&                         func,
+                      core::utility::Progress_Callback& progress,
+                      const For_Each_Pixel_Settings&    settings )
+{
+    const ImageT& image = image_.impl();
+    auto band = [&image]( FunctorT&                          band_func,
+                          int                                start_row,
+                          int                                num_rows,
+                          core::utility::Progress_Callback*  band_progress )
+    {
+        for_each_pixel_rows_( image, band_func, start_row, num_rows, band_progress );
+    };
+    detail::for_each_pixel_bands( func, band, image.cols(), image.rows(), image.planes(), &progress, settings );
     progress.report_finished();
 }
 
@@ -60,7 +327,28 @@ void for_each_pixel( const Image_Base<ImageT>&         image,
                      FunctorT&                         func,
                      core::utility::Progress_Callback& progress )
 {
-    for_each_pixel_<ImageT,FunctorT>( image, func, progress );
+    for_each_pixel_<ImageT,FunctorT>( image, func, progress, for_each_pixel_settings() );
+}
+
+/// Overload with explicit parallel settings
+template <typename ImageT,
+          typename FunctorT>
+void for_each_pixel( const Image_Base<ImageT>&         image,
+                     FunctorT&                         func,
+                     core::utility::Progress_Callback& progress,
+                     const For_Each_Pixel_Settings&    settings )
+{
+    for_each_pixel_<ImageT,FunctorT>( image, func, progress, settings );
+}
+
+/// Overload without a progress callback
+template <typename ImageT,
+          typename FunctorT>
+void for_each_pixel( const Image_Base<ImageT>& image,
+                     FunctorT&                 func )
+{
+    core::utility::Progress_Callback_Null progress;
+    for_each_pixel_<ImageT,FunctorT>( image, func, progress, for_each_pixel_settings() );
 }
 
 /// Const functor overload
@@ -70,38 +358,28 @@ void for_each_pixel( const Image_Base<ImageT>&               image,
                      const FunctorT&                         func,
                      const core::utility::Progress_Callback& progress )
 {
-    for_each_pixel_<ImageT,const FunctorT>( image, func, progress );
+    for_each_pixel_<ImageT,const FunctorT>( image, func, progress, for_each_pixel_settings() );
 }
 
-/// Overload for applying a functor to two input images.
+/// Apply a functor to rows [start_row, start_row + num_rows) of two input images.
 template <typename Image1T,
           typename Image2T,
           typename FunctorT>
-void for_each_pixel_( const Image_Base<Image1T>& image1_,
-                      const Image_Base<Image2T>& image2_,
-                      FunctorT&                  func )
+void for_each_pixel_rows_( const Image1T& image1,
+                           const Image2T& image2,
+                           FunctorT&      func,
+                           int            start_row,
+                           int            num_rows )
 {
-    const Image1T& image1 = image1_.impl();
-    const Image2T& image2 = image2_.impl();
-
-    if( image1.cols()   != image2.cols() ||
-        image1.rows()   != image2.rows() ||
-        image1.planes() != image2.planes() )
-    {
-        std::stringstream sout;
-        sout << "for_each_pixel_: Image arguments must have the same dimensions.";
-        tmns::log::error( sout.str() );
-        throw std::runtime_error( sout.str() );
-    }
     typedef typename Image1T::pixel_accessor pixel_accessor_1;
     typedef typename Image2T::pixel_accessor pixel_accessor_2;
-    pixel_accessor_1 plane_acc_1 = image1.origin();
-    pixel_accessor_2 plane_acc_2 = image2.origin();
+    pixel_accessor_1 plane_acc_1 = image1.origin().advance( 0, start_row );
+    pixel_accessor_2 plane_acc_2 = image2.origin().advance( 0, start_row );
     for( int plane = image1.planes(); plane; --plane )
     {
         pixel_accessor_1 row_acc_1 = plane_acc_1;
         pixel_accessor_2 row_acc_2 = plane_acc_2;
-        for( int row = image1.rows(); row; --row )
+        for( int row = num_rows; row; --row )
         {
             pixel_accessor_1 col_acc_1 = row_acc_1;
             pixel_accessor_2 col_acc_2 = row_acc_2;
@@ -119,6 +397,38 @@ void for_each_pixel_( const Image_Base<Image1T>& image1_,
     }
 }
 
+/// Overload for applying a functor to two input images.
+template <typename Image1T,
+          typename Image2T,
+          typename FunctorT>
+void for_each_pixel_( const Image_Base<Image1T>&      image1_,
+                      const Image_Base<Image2T>&      image2_,
+                      FunctorT&                       func,
+                      const For_Each_Pixel_Settings&  settings )
+{
+    const Image1T& image1 = image1_.impl();
+    const Image2T& image2 = image2_.impl();
+
+    if( image1.cols()   != image2.cols() ||
+        image1.rows()   != image2.rows() ||
+        image1.planes() != image2.planes() )
+    {
+        std::stringstream sout;
+        sout << "for_each_pixel_: Image arguments must have the same dimensions.";
+        tmns::log::error( sout.str() );
+        throw std::runtime_error( sout.str() );
+    }
+
+    auto band = [&image1,&image2]( FunctorT&                          band_func,
+                                   int                                start_row,
+                                   int                                num_rows,
+                                   core::utility::Progress_Callback*  )
+    {
+        for_each_pixel_rows_( image1, image2, band_func, start_row, num_rows );
+    };
+    detail::for_each_pixel_bands( func, band, image1.cols(), image1.rows(), image1.planes(), nullptr, settings );
+}
+
 template <typename Image1T,
           typename Image2T,
           typename FunctorT>
@@ -126,7 +436,7 @@ void for_each_pixel( const Image_Base<Image1T>& image1,
                      const Image_Base<Image2T>& image2,
                      FunctorT&                  func )
 { 
-    for_each_pixel_<Image1T,Image2T,FunctorT>( image1, image2, func );
+    for_each_pixel_<Image1T,Image2T,FunctorT>( image1, image2, func, for_each_pixel_settings() );
 }
 
 template <typename Image1T,
@@ -136,48 +446,44 @@ void for_each_pixel( const Image_Base<Image1T>& image1,
                      const Image_Base<Image2T>& image2,
                      const FunctorT&            func )
 {
-    for_each_pixel_<Image1T,Image2T,const FunctorT>( image1, image2, func );
+    for_each_pixel_<Image1T,Image2T,const FunctorT>( image1, image2, func, for_each_pixel_settings() );
 }
 
-/// Overload for applying a functor to three input images.
 template <typename Image1T,
           typename Image2T,
-          typename Image3T,
           typename FunctorT>
-void for_each_pixel_( const Image_Base<Image1T>&  image1_,
-                      const Image_Base<Image2T>&  image2_,
-                      const Image_Base<Image3T>&  image3_,
-                      FunctorT&                   func )
+void for_each_pixel( const Image_Base<Image1T>&      image1,
+                     const Image_Base<Image2T>&      image2,
+                     FunctorT&                       func,
+                     const For_Each_Pixel_Settings&  settings )
 {
-    const Image1T& image1 = image1_.impl();
-    const Image2T& image2 = image2_.impl();
-    const Image3T& image3 = image3_.impl();
+    for_each_pixel_<Image1T,Image2T,FunctorT>( image1, image2, func, settings );
+}
 
-    if( image1.cols()   != image2.cols() ||
-        image1.cols()   != image3.cols() ||
-        image1.rows()   != image2.rows() ||
-        image1.rows()   != image3.rows() ||
-        image1.planes() != image2.planes() ||
-        image1.planes() != image3.planes() )
-    {
-        std::stringstream sout;
-        sout << "for_each_pixel_: Images must all have same dimensions";
-        tmns::log::error( sout.str() );
-        throw std::runtime_error( sout.str() );
-    }
-    
+/// Apply a functor to rows [start_row, start_row + num_rows) of three input images.
+template <typename Image1T,
+          typename Image2T,
+          typename Image3T,
+          typename FunctorT>
+void for_each_pixel_rows_( const Image1T& image1,
+                           const Image2T& image2,
+                           const Image3T& image3,
+                           FunctorT&      func,
+                           int            start_row,
+                           int            num_rows )
+{
     typedef typename Image1T::pixel_accessor pixel_accessor_1;
     typedef typename Image2T::pixel_accessor pixel_accessor_2;
     typedef typename Image3T::pixel_accessor pixel_accessor_3;
-    pixel_accessor_1 plane_acc_1 = image1.origin();
-    pixel_accessor_2 plane_acc_2 = image2.origin();
-    pixel_accessor_3 plane_acc_3 = image3.origin();
+    pixel_accessor_1 plane_acc_1 = image1.origin().advance( 0, start_row );
+    pixel_accessor_2 plane_acc_2 = image2.origin().advance( 0, start_row );
+    pixel_accessor_3 plane_acc_3 = image3.origin().advance( 0, start_row );
     for( int plane = image1.planes(); plane; --plane )
     {
         pixel_accessor_1 row_acc_1 = plane_acc_1;
         pixel_accessor_2 row_acc_2 = plane_acc_2;
         pixel_accessor_3 row_acc_3 = plane_acc_3;
-        for( int row = image1.rows(); row; --row )
+        for( int row = num_rows; row; --row )
         {
             pixel_accessor_1 col_acc_1 = row_acc_1;
             pixel_accessor_2 col_acc_2 = row_acc_2;
@@ -199,6 +505,44 @@ void for_each_pixel_( const Image_Base<Image1T>&  image1_,
     }
 }
 
+/// Overload for applying a functor to three input images.
+template <typename Image1T,
+          typename Image2T,
+          typename Image3T,
+          typename FunctorT>
+void for_each_pixel_( const Image_Base<Image1T>&      image1_,
+                      const Image_Base<Image2T>&      image2_,
+                      const Image_Base<Image3T>&      image3_,
+                      FunctorT&                       func,
+                      const For_Each_Pixel_Settings&  settings )
+{
+    const Image1T& image1 = image1_.impl();
+    const Image2T& image2 = image2_.impl();
+    const Image3T& image3 = image3_.impl();
+
+    if( image1.cols()   != image2.cols() ||
+        image1.cols()   != image3.cols() ||
+        image1.rows()   != image2.rows() ||
+        image1.rows()   != image3.rows() ||
+        image1.planes() != image2.planes() ||
+        image1.planes() != image3.planes() )
+    {
+        std::stringstream sout;
+        sout << "for_each_pixel_: Images must all have same dimensions";
+        tmns::log::error( sout.str() );
+        throw std::runtime_error( sout.str() );
+    }
+
+    auto band = [&image1,&image2,&image3]( FunctorT&                          band_func,
+                                           int                                start_row,
+                                           int                                num_rows,
+                                           core::utility::Progress_Callback*  )
+    {
+        for_each_pixel_rows_( image1, image2, image3, band_func, start_row, num_rows );
+    };
+    detail::for_each_pixel_bands( func, band, image1.cols(), image1.rows(), image1.planes(), nullptr, settings );
+}
+
 template <typename Image1T,
           typename Image2T,
           typename Image3T,
@@ -208,7 +552,7 @@ void for_each_pixel( const Image_Base<Image1T>& image1,
                      const Image_Base<Image3T>& image3,
                      FunctorT&                  func )
 {
-    for_each_pixel_<Image1T,Image2T,Image3T,FunctorT>( image1, image2, image3, func );
+    for_each_pixel_<Image1T,Image2T,Image3T,FunctorT>( image1, image2, image3, func, for_each_pixel_settings() );
 }
 
 
@@ -221,7 +565,20 @@ void for_each_pixel( const Image_Base<Image1T>& image1,
                      const Image_Base<Image3T>& image3,
                      const FunctorT&            func )
 {
-    for_each_pixel_<Image1T,Image2T,Image3T,const FunctorT>( image1, image2, image3, func );
+    for_each_pixel_<Image1T,Image2T,Image3T,const FunctorT>( image1, image2, image3, func, for_each_pixel_settings() );
+}
+
+template <typename Image1T,
+          typename Image2T,
+          typename Image3T,
+          typename FunctorT>
+void for_each_pixel( const Image_Base<Image1T>&      image1,
+                     const Image_Base<Image2T>&      image2,
+                     const Image_Base<Image3T>&      image3,
+                     FunctorT&                       func,
+                     const For_Each_Pixel_Settings&  settings )
+{
+    for_each_pixel_<Image1T,Image2T,Image3T,FunctorT>( image1, image2, image3, func, settings );
 }
 
 
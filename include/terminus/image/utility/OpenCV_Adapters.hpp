@@ -0,0 +1,117 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    OpenCV_Adapters.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// OpenCV Libraries
+#include <opencv2/core.hpp>
+
+// Terminus Image Libraries
+#include "../operations/crop_image.hpp"
+#include "../types/Image_Buffer.hpp"
+#include "../types/Image_Memory.hpp"
+
+// Terminus Libraries
+#include <terminus/core/error/ErrorCategory.hpp>
+
+namespace tmns::image::utility::ocv {
+
+/**
+ * Wrap a buffer as a `cv::Mat` header, without copying.  The Mat uses the buffer's
+ * row stride, so padded rows and cropped regions work.  Only single-plane buffers
+ * with packed pixels can be wrapped.
+ *
+ * The Mat does not own the pixels; the buffer's memory must outlive it.
+*/
+Result<cv::Mat> to_cv_mat( const Image_Buffer& buffer );
+
+/**
+ * Wrap a `cv::Mat` as a buffer, without copying.  The buffer does not own the pixels.
+ * One to four channels become GRAY, GRAYA, RGB and RGBA.  Channels are not reordered,
+ * so a BGR Mat gives an "RGB" buffer holding BGR values.
+*/
+Result<Image_Buffer> to_image_buffer( const cv::Mat& mat );
+
+/**
+ * Wrap an in-memory image as a `cv::Mat` header sharing its pixels.  The image (or a
+ * copy of it) must outlive the Mat.
+*/
+template <typename PixelT>
+Result<cv::Mat> to_cv_mat( const Image_Memory<PixelT>& image )
+{
+    return to_cv_mat( image.buffer() );
+}
+
+/**
+ * Wrap a crop of an in-memory image as a `cv::Mat` header over the cropped region
+*/
+template <typename PixelT>
+Result<cv::Mat> to_cv_mat( const ops::Crop_View<Image_Memory<PixelT>>& view )
+{
+    auto origin = view.origin();
+    Image_Buffer buffer( &( *origin ),
+                         view.format(),
+                         sizeof(PixelT),
+                         sizeof(PixelT) * origin.row_stride(),
+                         sizeof(PixelT) * origin.plane_stride() );
+    return to_cv_mat( buffer );
+}
+
+/**
+ * Wrap a `cv::Mat` as an in-memory image sharing its pixels.  The image keeps a
+ * reference to the Mat's data, so it stays valid after the Mat goes away.  The Mat's
+ * channel count and channel type must match the pixel type, and each row must hold
+ * whole pixels.  Channels are not reordered.
+*/
+template <typename PixelT>
+Result<Image_Memory<PixelT>> to_image_memory( const cv::Mat& mat )
+{
+    auto buffer_res = to_image_buffer( mat );
+    if( buffer_res.has_error() )
+    {
+        return buffer_res.error();
+    }
+    const auto& buffer = buffer_res.value();
+
+    Image_Memory<PixelT> reference;
+    if( size_t( mat.channels() ) != math::Compound_Channel_Count<PixelT>::value ||
+        buffer.channel_type()    != reference.channel_type() ||
+        mat.elemSize()           != sizeof(PixelT) )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_PIXEL_TYPE,
+                              "cv::Mat type does not match the image.  Mat: ",
+                              mat.channels(), " x ", enum_to_string( buffer.channel_type() ),
+                              ", Image: ", math::Compound_Channel_Count<PixelT>::value,
+                              " x ", enum_to_string( reference.channel_type() ) );
+    }
+    if( buffer.rstride() % sizeof(PixelT) != 0 )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "cv::Mat row step of ", buffer.rstride(),
+                              " bytes is not a whole number of pixels." );
+    }
+
+    // The deleter holds a copy of the Mat, which keeps its refcounted data alive
+    std::shared_ptr<PixelT[]> data( reinterpret_cast<PixelT*>( mat.data ),
+                                    [mat]( PixelT* ){} );
+    size_t rstride = buffer.rstride() / sizeof(PixelT);
+    return outcome::ok<Image_Memory<PixelT>>( Image_Memory<PixelT>( data,
+                                                                    mat.cols,
+                                                                    mat.rows,
+                                                                    1,
+                                                                    rstride,
+                                                                    rstride * mat.rows ) );
+}
+
+} // End of tmns::image::utility::ocv namespace
@@ -24,4 +24,12 @@ bool Detector_Config_Base::supports_feature_descriptors() const
     return false;
 }
 
+/**********************************************************/
+/*          Get the Tile Overlap in Pixels                */
+/**********************************************************/
+int Detector_Config_Base::tile_halo_pixels() const
+{
+    return 0;
+}
+
 } // End of tmns::feature namespace
\ No newline at end of file
@@ -20,6 +20,7 @@
 // Terminus Image Libraries
 #include "../../../image/pixel/convert.hpp"
 #include "../../../image/utility/OpenCV_Utilities.hpp"
+#include <terminus/image/utility/OpenCV_Adapters.hpp>
 
 // OpenCV Libraries
 #include <opencv2/features2d.hpp>
@@ -123,20 +124,17 @@ Result<Interest_Point_List> Detector_OCV_GFTT::process_image( const image::Image
     }
 
     // Create the opencv image to run detection on
-    auto type_code = image::utility::ocv::get_pixel_type_code( detect_buffer.pixel_type(),
-                                                               detect_buffer.channel_type() );
-    if( type_code.has_error() )
+    auto mat_res = image::utility::ocv::to_cv_mat( detect_buffer );
+    if( mat_res.has_error() )
     {
         return outcome::fail( core::error::ErrorCode::INVALID_CONFIGURATION,
                               "Unsupported conversion. ",
-                              type_code.error().message() );
+                              mat_res.error().message() );
     }
 
-    cv::Mat image( detect_buffer.rows(),
-                   detect_buffer.cols(),
-                   type_code.value(),
-                   detect_buffer.data() );
-    tmns::log::info( ADD_CURRENT_LOC(), image::utility::ocv::opencv_type_to_string( type_code.value() ) );
+    // Shares the buffer's pixels and row stride
+    cv::Mat image = mat_res.value();
+    tmns::log::info( ADD_CURRENT_LOC(), image::utility::ocv::opencv_type_to_string( image.type() ) );
 
     // Build the feature detector
     int max_points = ( max_points_override > 0 ) ? max_points_override : m_config->max_features();
@@ -20,6 +20,7 @@
 // Terminus Image Libraries
 #include "../../utility/Detector_Image_Utilities.hpp"
 #include "../../../image/utility/OpenCV_Utilities.hpp"
+#include <terminus/image/utility/OpenCV_Adapters.hpp>
 
 // OpenCV Libraries
 #include <opencv2/core/types.hpp>
@@ -70,20 +71,17 @@ Result<Interest_Point_List> Detector_OCV_ORB::process_image( const image::Image_
     auto detect_buffer = proc_res.value();
 
     // Create the opencv image to run detection on
-    auto type_code = image::utility::ocv::get_pixel_type_code( detect_buffer.pixel_type(),
-                                                               detect_buffer.channel_type() );
-    if( type_code.has_error() )
+    auto mat_res = image::utility::ocv::to_cv_mat( detect_buffer );
+    if( mat_res.has_error() )
     {
         return outcome::fail( core::error::ErrorCode::INVALID_CONFIGURATION,
                               "Unsupported conversion. ",
-                              type_code.error().message() );
+                              mat_res.error().message() );
     }
 
-    cv::Mat image( detect_buffer.rows(),
-                   detect_buffer.cols(),
-                   type_code.value(),
-                   detect_buffer.data() );
-    tmns::log::info( ADD_CURRENT_LOC(), image::utility::ocv::opencv_type_to_string( type_code.value() ) );
+    // Shares the buffer's pixels and row stride
+    cv::Mat image = mat_res.value();
+    tmns::log::info( ADD_CURRENT_LOC(), image::utility::ocv::opencv_type_to_string( image.type() ) );
 
     auto score_type = cv::ORB::HARRIS_SCORE;
     if( m_config->score_type() == "FAST" )
@@ -157,21 +155,18 @@ Result<void> Detector_OCV_ORB::perform_feature_extraction( const image::Image_Bu
     auto detect_buffer = proc_res.value();
 
     // Create the opencv image to run detection on
-    auto type_code = image::utility::ocv::get_pixel_type_code( detect_buffer.pixel_type(),
-                                                               detect_buffer.channel_type() );
-    if( type_code.has_error() )
+    auto mat_res = image::utility::ocv::to_cv_mat( detect_buffer );
+    if( mat_res.has_error() )
     {
         return outcome::fail( core::error::ErrorCode::INVALID_CONFIGURATION,
                               "Unsupported conversion. ",
-                              type_code.error().message() );
+                              mat_res.error().message() );
     }
 
-    cv::Mat image( detect_buffer.rows(),
-                   detect_buffer.cols(),
-                   type_code.value(),
-                   detect_buffer.data() );
+    // Shares the buffer's pixels and row stride
+    cv::Mat image = mat_res.value();
     tmns::log::info( ADD_CURRENT_LOC(),
-                     image::utility::ocv::opencv_type_to_string( type_code.value() ) );
+                     image::utility::ocv::opencv_type_to_string( image.type() ) );
 
     auto score_type = cv::ORB::HARRIS_SCORE;
     if( m_config->score_type() == "FAST" )
@@ -70,6 +70,14 @@ math::Size2i  Detector_Config_OCV_ORB::tile_size_pixels() const
     return m_tile_size_pixels;
 }
 
+/*********************************/
+/*      Tile Halo in Pixels      */
+/*********************************/
+int Detector_Config_OCV_ORB::tile_halo_pixels() const
+{
+    return m_edge_threshold;
+}
+
 /*****************************/
 /*      Get Max Features     */
 /*****************************/
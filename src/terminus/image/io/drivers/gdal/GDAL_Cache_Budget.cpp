@@ -0,0 +1,236 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    GDAL_Cache_Budget.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "GDAL_Cache_Budget.hpp"
+
+// Terminus Libraries
+#include "GDAL_Utilities.hpp"
+
+// GDAL Libraries
+#include <cpl_conv.h>
+#include <gdal.h>
+
+// C++ Libraries
+#include <atomic>
+#include <sstream>
+
+namespace tmns::image::io::gdal {
+
+/// Set once the global budget is destroyed, so tile caches outliving it don't touch it
+static std::atomic<bool> g_budget_destroyed { false };
+
+/************************************************/
+/*          Get the global budget instance      */
+/************************************************/
+GDAL_Cache_Budget& GDAL_Cache_Budget::instance()
+{
+    static GDAL_Cache_Budget s_instance;
+    return s_instance;
+}
+
+/********************************/
+/*          Destructor          */
+/********************************/
+GDAL_Cache_Budget::~GDAL_Cache_Budget()
+{
+    g_budget_destroyed = true;
+}
+
+/****************************************/
+/*          Set the total budget        */
+/****************************************/
+Result<void> GDAL_Cache_Budget::set_total_bytes( size_t total_bytes )
+{
+    if( total_bytes == 0 )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_SIZE,
+                              "GDAL_Cache_Budget: Total budget must be non-zero." );
+    }
+
+    {
+        std::unique_lock<std::mutex> lck( m_mtx );
+        m_total_bytes     = total_bytes;
+        m_total_bytes_set = true;
+    }
+    apply();
+    return outcome::ok();
+}
+
+/****************************************/
+/*          Get the total budget        */
+/****************************************/
+size_t GDAL_Cache_Budget::total_bytes() const
+{
+    std::unique_lock<std::mutex> lck( m_mtx );
+    return m_total_bytes;
+}
+
+/************************************************/
+/*          Set the GDAL reserve fraction       */
+/************************************************/
+Result<void> GDAL_Cache_Budget::set_gdal_reserve_fraction( double fraction )
+{
+    if( fraction < 0 || fraction > 1 )
+    {
+        return outcome::fail( core::error::ErrorCode::OUT_OF_BOUNDS,
+                              "GDAL_Cache_Budget: Reserve fraction must be in range [0,1]. Actual: ",
+                              fraction );
+    }
+
+    {
+        std::unique_lock<std::mutex> lck( m_mtx );
+        m_gdal_reserve_fraction = fraction;
+    }
+    apply();
+    return outcome::ok();
+}
+
+/************************************************/
+/*          Get the GDAL reserve fraction       */
+/************************************************/
+double GDAL_Cache_Budget::gdal_reserve_fraction() const
+{
+    std::unique_lock<std::mutex> lck( m_mtx );
+    return m_gdal_reserve_fraction;
+}
+
+/************************************************/
+/*          Get the GDAL cache allotment        */
+/************************************************/
+size_t GDAL_Cache_Budget::gdal_cache_bytes() const
+{
+    std::unique_lock<std::mutex> lck( m_mtx );
+    return gdal_cache_bytes_locked();
+}
+
+/************************************************/
+/*          Get the tile cache allotment        */
+/************************************************/
+size_t GDAL_Cache_Budget::tile_cache_bytes() const
+{
+    std::unique_lock<std::mutex> lck( m_mtx );
+    return m_total_bytes - static_cast<size_t>( m_total_bytes * m_gdal_reserve_fraction );
+}
+
+/********************************************/
+/*          Get the shared tile cache       */
+/********************************************/
+core::cache::Cache_Local::ptr_t GDAL_Cache_Budget::tile_cache()
+{
+    core::cache::Cache_Local::ptr_t cache;
+    {
+        std::unique_lock<std::mutex> lck( m_mtx );
+        cache = m_tile_cache.lock();
+        if( cache )
+        {
+            return cache;
+        }
+
+        // Hand the budget back to GDAL once the last user drops the cache
+        size_t cache_bytes = m_total_bytes - static_cast<size_t>( m_total_bytes * m_gdal_reserve_fraction );
+        cache = core::cache::Cache_Local::ptr_t( new core::cache::Cache_Local( cache_bytes ),
+                                                 []( core::cache::Cache_Local* released )
+                                                 {
+                                                     delete released;
+                                                     if( !g_budget_destroyed )
+                                                     {
+                                                         GDAL_Cache_Budget::instance().apply();
+                                                     }
+                                                 } );
+        m_tile_cache = cache;
+    }
+
+    // Shrink GDAL now that we own most of the budget
+    apply();
+    return cache;
+}
+
+/****************************************************/
+/*          Check if the tile cache is alive        */
+/****************************************************/
+bool GDAL_Cache_Budget::tile_cache_active() const
+{
+    std::unique_lock<std::mutex> lck( m_mtx );
+    return !m_tile_cache.expired();
+}
+
+/********************************************/
+/*          Set streaming reads flag        */
+/********************************************/
+void GDAL_Cache_Budget::set_streaming_reads( bool value )
+{
+    std::unique_lock<std::mutex> lck( m_mtx );
+    m_streaming_reads = value;
+}
+
+/********************************************/
+/*          Get streaming reads flag        */
+/********************************************/
+bool GDAL_Cache_Budget::streaming_reads() const
+{
+    std::unique_lock<std::mutex> lck( m_mtx );
+    return m_streaming_reads;
+}
+
+/********************************************/
+/*          Apply the budget to GDAL        */
+/********************************************/
+void GDAL_Cache_Budget::apply() const
+{
+    // Held across the set, so concurrent calls can't leave GDAL with a stale allotment
+    std::unique_lock<std::mutex> lck( m_mtx );
+
+    // A GDAL_CACHEMAX from the config or environment wins over the default budget
+    if( !m_total_bytes_set && CPLGetConfigOption( "GDAL_CACHEMAX", nullptr ) != nullptr )
+    {
+        return;
+    }
+
+    size_t gdal_bytes = gdal_cache_bytes_locked();
+    get_master_gdal_logger().debug( "Setting GDAL_CACHEMAX to ", gdal_bytes, " bytes" );
+    GDALSetCacheMax64( static_cast<GIntBig>( gdal_bytes ) );
+}
+
+/************************************************/
+/*          Print to log-friendly string        */
+/************************************************/
+std::string GDAL_Cache_Budget::to_log_string( size_t offset ) const
+{
+    std::unique_lock<std::mutex> lck( m_mtx );
+
+    std::string gap( offset, ' ' );
+    std::stringstream sout;
+    sout << gap << " - GDAL_Cache_Budget" << std::endl;
+    sout << gap << "   - Total Bytes: " << m_total_bytes << std::endl;
+    sout << gap << "   - GDAL Reserve Fraction: " << m_gdal_reserve_fraction << std::endl;
+    sout << gap << "   - GDAL Cache Bytes: " << gdal_cache_bytes_locked() << std::endl;
+    sout << gap << "   - Tile Cache Active: " << std::boolalpha << !m_tile_cache.expired() << std::endl;
+    sout << gap << "   - Streaming Reads: " << std::boolalpha << m_streaming_reads << std::endl;
+    return sout.str();
+}
+
+/************************************************/
+/*          Compute the GDAL allotment          */
+/************************************************/
+size_t GDAL_Cache_Budget::gdal_cache_bytes_locked() const
+{
+    // GDAL gets everything until we start caching tiles ourselves
+    if( m_tile_cache.expired() )
+    {
+        return m_total_bytes;
+    }
+    return static_cast<size_t>( m_total_bytes * m_gdal_reserve_fraction );
+}
+
+} // End of tmns::image::io::gdal namespace
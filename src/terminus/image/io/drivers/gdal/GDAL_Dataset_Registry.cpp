@@ -0,0 +1,154 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    GDAL_Dataset_Registry.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "GDAL_Dataset_Registry.hpp"
+
+// Terminus Libraries
+#include "GDAL_Utilities.hpp"
+
+// GDAL Libraries
+#include <gdal.h>
+#include <gdal_priv.h>
+
+// C++ Libraries
+#include <sstream>
+
+namespace tmns::image::io::gdal {
+
+/************************************************/
+/*          Get the global registry instance    */
+/************************************************/
+GDAL_Dataset_Registry& GDAL_Dataset_Registry::instance()
+{
+    static GDAL_Dataset_Registry s_instance;
+    return s_instance;
+}
+
+/****************************************/
+/*          Create a unique key         */
+/****************************************/
+uint64_t GDAL_Dataset_Registry::next_key()
+{
+    return ++m_key_counter;
+}
+
+/************************************************/
+/*          Set the max open dataset count      */
+/************************************************/
+Result<void> GDAL_Dataset_Registry::set_max_open_datasets( size_t max_open )
+{
+    if( max_open == 0 )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_SIZE,
+                              "GDAL_Dataset_Registry: Must allow at least one open dataset." );
+    }
+
+    std::unique_lock<std::mutex> lck( get_master_gdal_mutex() );
+    m_max_open_datasets = max_open;
+    evict_locked( m_max_open_datasets );
+    return outcome::ok();
+}
+
+/************************************************/
+/*          Get the max open dataset count      */
+/************************************************/
+size_t GDAL_Dataset_Registry::max_open_datasets() const
+{
+    std::unique_lock<std::mutex> lck( get_master_gdal_mutex() );
+    return m_max_open_datasets;
+}
+
+/************************************************/
+/*          Get the open dataset count          */
+/************************************************/
+size_t GDAL_Dataset_Registry::num_open_datasets() const
+{
+    std::unique_lock<std::mutex> lck( get_master_gdal_mutex() );
+    return m_datasets.size();
+}
+
+/****************************************************/
+/*          Get the dataset, reopening if needed    */
+/****************************************************/
+Result<GDAL_Dataset_Registry::DatasetPtrT>
+    GDAL_Dataset_Registry::acquire_locked( uint64_t                     key,
+                                           const std::filesystem::path& pathname )
+{
+    // Already open, so just mark it as recently used
+    auto it = m_datasets.find( key );
+    if( it != m_datasets.end() )
+    {
+        m_lru.splice( m_lru.begin(), m_lru, it->second.lru_pos );
+        return outcome::ok<DatasetPtrT>( it->second.dataset );
+    }
+
+    // Make room before opening another file handle
+    evict_locked( m_max_open_datasets - 1 );
+
+    get_master_gdal_logger().trace( "Opening dataset for file: ", pathname.native() );
+    DatasetPtrT dataset( (GDALDataset*)GDALOpen( pathname.native().c_str(), GA_ReadOnly ),
+                         GDAL_Deleter_Null_Okay );
+    if( !dataset )
+    {
+        std::stringstream sout;
+        sout << "GDAL: Failed to open dataset " << pathname.native();
+        get_master_gdal_logger().warn( sout.str() );
+        return outcome::fail( core::error::ErrorCode::FILE_IO_ERROR,
+                              sout.str() );
+    }
+
+    m_lru.push_front( key );
+    m_datasets[key] = Entry{ dataset, m_lru.begin() };
+
+    return outcome::ok<DatasetPtrT>( dataset );
+}
+
+/************************************************/
+/*          Check if the dataset is open        */
+/************************************************/
+bool GDAL_Dataset_Registry::is_open_locked( uint64_t key ) const
+{
+    return m_datasets.find( key ) != m_datasets.end();
+}
+
+/************************************************/
+/*          Close and forget the dataset        */
+/************************************************/
+void GDAL_Dataset_Registry::release_locked( uint64_t key )
+{
+    auto it = m_datasets.find( key );
+    if( it != m_datasets.end() )
+    {
+        m_lru.erase( it->second.lru_pos );
+        m_datasets.erase( it );
+    }
+}
+
+/****************************************************/
+/*          Close least-recently-used datasets      */
+/****************************************************/
+void GDAL_Dataset_Registry::evict_locked( size_t max_open )
+{
+    while( m_datasets.size() > max_open && !m_lru.empty() )
+    {
+        auto key = m_lru.back();
+        m_lru.pop_back();
+
+        // Readers still holding the pointer keep it alive until they are done
+        get_master_gdal_logger().trace( "Closing least-recently-used dataset: ", key );
+        m_datasets.erase( key );
+    }
+}
+
+} // End of tmns::image::io::gdal namespace
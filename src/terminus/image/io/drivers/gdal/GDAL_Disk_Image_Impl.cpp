@@ -17,7 +17,11 @@
 /// Terminus Libraries
 #include "../../../pixel/convert.hpp"
 #include "../../../pixel/Channel_Type_Enum.hpp"
+#include "../../../pixel/Interleave_Utilities.hpp"
+#include "GDAL_Cache_Budget.hpp"
+#include "GDAL_Dataset_Registry.hpp"
 #include "GDAL_Utilities.hpp"
+#include "GDAL_Write_Profile.hpp"
 #include "ISIS_JSON_Parser.hpp"
 
 /// External Terminus Libraries
@@ -26,6 +30,7 @@
 
 /// C++ Libraries
 #include <mutex>
+#include <vector>
 
 // GDAL Libraries
 #include <gdal.h>
@@ -39,6 +44,7 @@ namespace tmns::image::io::gdal {
 GDAL_Disk_Image_Impl::GDAL_Disk_Image_Impl( const std::filesystem::path& pathname,
                                             const ColorCodeLookupT&      color_reference_lut )
   : m_pathname( pathname ),
+    m_dataset_key( GDAL_Dataset_Registry::instance().next_key() ),
     m_color_reference_lut( color_reference_lut )
 {
     open( m_pathname );
@@ -53,6 +59,7 @@ GDAL_Disk_Image_Impl::GDAL_Disk_Image_Impl( const std::filesystem::path&
                                             const math::Size2i&                      block_size,
                                             const ColorCodeLookupT&                  color_reference_lut )
   : m_pathname( pathname ),
+    m_dataset_key( GDAL_Dataset_Registry::instance().next_key() ),
     m_color_reference_lut( color_reference_lut )
 {
     configure_for_writing( output_format,
@@ -60,6 +67,15 @@ GDAL_Disk_Image_Impl::GDAL_Disk_Image_Impl( const std::filesystem::path&
                            block_size );
 }
 
+/********************************/
+/*          Destructor          */
+/********************************/
+GDAL_Disk_Image_Impl::~GDAL_Disk_Image_Impl()
+{
+    std::unique_lock<std::mutex> lck( get_master_gdal_mutex() );
+    GDAL_Dataset_Registry::instance().release_locked( m_dataset_key );
+}
+
 /************************************/
 /*          Open the Dataset        */
 /************************************/
@@ -68,28 +84,30 @@ Result<void> GDAL_Disk_Image_Impl::open( const std::filesystem::path& pathname )
     // Lock the global GDAL Context
     std::unique_lock<std::mutex> lck( get_master_gdal_mutex() );
     auto logger = get_master_gdal_logger();
-    logger.trace( "Opening dataset for file: ", pathname.native() );
 
-    /// Create the GDAL Dataset
-    m_read_dataset.reset( (GDALDataset*)GDALOpen( pathname.native().c_str(), GA_ReadOnly ), GDAL_Deleter_Null_Okay );
+    // Drop any dataset left over from a prior open
+    auto& registry = GDAL_Dataset_Registry::instance();
+    registry.release_locked( m_dataset_key );
+    m_read_enabled = false;
+    m_pathname = pathname;
+
+    // Domains deferred by a prior open would load from the old dataset
+    m_metadata->clear_deferred();
 
-    // Make sure it opens okay
-    if( !m_read_dataset )
+    /// Create the GDAL Dataset.  The registry reports and logs any failure.
+    auto dataset_res = registry.acquire_locked( m_dataset_key, m_pathname );
+    if( dataset_res.has_error() )
     {
-        std::stringstream sout;
-        sout << "GDAL: Failed to open dataset " << m_pathname.native();
-        logger.warn( sout.str() );
-        return outcome::fail( core::error::ErrorCode::FILE_IO_ERROR,
-                               sout.str() );
+        return outcome::fail( dataset_res.error() );
     }
+    m_read_enabled = true;
 
     m_metadata->insert( "pathname", m_pathname.native() );
     m_metadata->insert( "image_read_driver", "GDAL" );
 
     // Given dataset, get some information
-    std::shared_ptr<GDALDataset> dataset( get_dataset_ptr().value() );
+    std::shared_ptr<GDALDataset> dataset( dataset_res.value() );
 
-    m_pathname = pathname;
     m_format.set_cols( dataset->GetRasterXSize() );
     m_format.set_rows( dataset->GetRasterYSize() );
 
@@ -171,7 +189,10 @@ Result<void> GDAL_Disk_Image_Impl::open( const std::filesystem::path& pathname )
         get_master_gdal_logger().error( "Unable to parse channel-type. ", ctype.error().message() );
         return outcome::fail( ctype.error() );
     }
-    m_format.set_channel_type( ctype.value() );
+    // 12/14-bit data comes back as UINT16, with the real depth in NBITS.  The unpacked
+    // values are still 16-bit words, but the tile cache can keep them bit-packed.
+    const char* nbits = dataset->GetRasterBand(1)->GetMetadataItem( "NBITS", "IMAGE_STRUCTURE" );
+    m_format.set_channel_type( gdal_nbits_channel_type( ctype.value(), nbits ) );
 
     // Color Palette (if supported)
     if( dataset->GetRasterCount() == 1 &&
@@ -233,31 +254,40 @@ Result<void> GDAL_Disk_Image_Impl::read( const Image_Buffer&  dest,
         auto ch_size = channel_size_bytes( src.format().channel_type() ).value();
         if( m_color_table.empty() )
         {
-            auto nchannels = num_channels( format().pixel_type() ).value();
-            for( size_t p = 0; p < format().planes();   ++p ) {
-            for( size_t c = 0; c < nchannels; ++c )
+            // All bands of a plane go straight into the interleaved buffer in one call,
+            // with GDAL doing the interleave through the pixel and band spacing.  No
+            // planar copy of the region is ever held.
+            auto nchannels    = num_channels( format().pixel_type() ).value();
+            auto gdal_pix_fmt = channel_type_to_gdal_pixel_format( format().channel_type() ).value();
+            for( size_t p = 0; p < format().planes(); ++p )
             {
-                // Only one of channels() or planes() will be nonzero.
-                auto* band = dataset->GetRasterBand( c + p + 1 );
-
-                auto gdal_pix_fmt = channel_type_to_gdal_pixel_format( format().channel_type() ).value();
-                CPLErr result = band->RasterIO( GF_Read,
-                                                bbox.min().x(),
-                                                bbox.min().y(),
-                                                bbox.width(),
-                                                bbox.height(),
-                                                ( uint8_t* ) src( 0, 0, p ) + ch_size * c,
-                                                src.format().cols(),
-                                                src.format().rows(),
-                                                gdal_pix_fmt,
-                                                src.cstride(),
-                                                src.rstride() );
+                // Only one of channels() or planes() will be greater than one.
+                std::vector<int> band_map( nchannels );
+                for( size_t c = 0; c < nchannels; ++c )
+                {
+                    band_map[c] = int( c + p + 1 );
+                }
+
+                CPLErr result = dataset->RasterIO( GF_Read,
+                                                   bbox.min().x(),
+                                                   bbox.min().y(),
+                                                   bbox.width(),
+                                                   bbox.height(),
+                                                   (uint8_t*) src( 0, 0, p ),
+                                                   src.format().cols(),
+                                                   src.format().rows(),
+                                                   gdal_pix_fmt,
+                                                   int( nchannels ),
+                                                   band_map.data(),
+                                                   src.cstride(),
+                                                   src.rstride(),
+                                                   ch_size );
                 if( result != CE_None )
                 {
                     logger.warn( "RasterIO problem: ",
                                  CPLGetLastErrorMsg() );
                 }
-            }}
+            }
         }
 
         // Convert the color table
@@ -282,6 +312,12 @@ Result<void> GDAL_Disk_Image_Impl::read( const Image_Buffer&  dest,
 
             delete [] index_data;
         }
+
+        // Streaming reads don't revisit blocks, so drop them rather than double-cache them
+        if( GDAL_Cache_Budget::instance().streaming_reads() )
+        {
+            dataset->FlushCache();
+        }
     }
 
     return convert( dest, src, rescale );
@@ -311,6 +347,24 @@ Result<void> GDAL_Disk_Image_Impl::write( const Image_Buffer& source_buffer,
         return outcome::fail( res.error() );
     }
 
+    // GDAL writes band by band, so split multi-channel pixels into contiguous planes
+    // before taking the lock.
+    std::vector<uint8_t> band_data;
+    if( dest_format.channels() > 1 )
+    {
+        auto ch_size = channel_size_bytes( dest_format.channel_type() ).value();
+        band_data.resize( dest_format.raster_size_bytes() );
+        interleaved_to_planar( dest_data.data(),
+                               dest_buffer.rstride(),
+                               band_data.data(),
+                               ch_size * dest_format.cols() * dest_format.rows(),
+                               ch_size * dest_format.cols(),
+                               dest_format.cols(),
+                               dest_format.rows(),
+                               dest_format.channels(),
+                               ch_size );
+    }
+
     {
         std::unique_lock<std::mutex> lock( get_master_gdal_mutex() );
 
@@ -325,6 +379,8 @@ Result<void> GDAL_Disk_Image_Impl::write( const Image_Buffer& source_buffer,
         // Make sure we have valid channel count
         auto channels = num_channels( dest_buffer.format().pixel_type() ).value();
         auto ch_size_bytes = channel_size_bytes( dest_buffer.format().channel_type() ).value();
+        ssize_t band_rstride = ch_size_bytes * dest_buffer.format().cols();
+        ssize_t band_pstride = band_rstride * dest_buffer.format().rows();
 
         // Iterate over the pixel bands
         for( size_t p = 0; p < dest_buffer.format().planes(); p++ ){
@@ -332,17 +388,19 @@ Result<void> GDAL_Disk_Image_Impl::write( const Image_Buffer& source_buffer,
 
             GDALRasterBand *band = get_dataset_ptr().value()->GetRasterBand(c+p+1);
 
+            uint8_t* band_ptr = ( channels > 1 ) ? band_data.data() + band_pstride * c
+                                                 : (uint8_t*)dest_buffer(0,0,p);
             CPLErr result = band->RasterIO( GF_Write,
                                             bbox.min().x(),
                                             bbox.min().y(),
                                             bbox.width(),
                                             bbox.height(),
-                                            (uint8_t*)dest_buffer(0,0,p) + ch_size_bytes * c,
+                                            band_ptr,
                                             dest_buffer.format().cols(),
                                             dest_buffer.format().rows(),
                                             gdal_pix_fmt,
-                                            dest_buffer.cstride(),
-                                            dest_buffer.rstride() );
+                                            ch_size_bytes,
+                                            band_rstride );
             if (result != CE_None)
             {
                 std::stringstream sout;
@@ -365,7 +423,7 @@ std::string GDAL_Disk_Image_Impl::To_Log_String( size_t offset ) const
     std::string gap( offset, ' ' );
     std::stringstream sout;
     sout << gap << "   - pathname: " << m_pathname << std::endl;
-    sout << gap << "   - read dataset set : " << std::boolalpha << (m_read_dataset != 0) << std::endl;
+    sout << gap << "   - read dataset set : " << std::boolalpha << m_read_enabled << std::endl;
     sout << gap << "   - write dataset set: " << std::boolalpha << (m_write_dataset != 0) << std::endl;
     sout << m_format.to_string( offset + 2 );
     sout << gap << "   - Block Size: " << m_blocksize.to_string() << std::endl;
@@ -390,9 +448,10 @@ Result<GDAL_Disk_Image_Impl::DatasetPtrT> GDAL_Disk_Image_Impl::get_dataset_ptr(
     {
         return outcome::ok<DatasetPtrT>( m_write_dataset );
     }
-    else if( m_read_dataset )
+    else if( m_read_enabled )
     {
-        return outcome::ok<DatasetPtrT>( m_read_dataset );
+        // Transparently reopen if the registry closed it to stay under its cap
+        return GDAL_Dataset_Registry::instance().acquire_locked( m_dataset_key, m_pathname );
     }
     else
     {
@@ -690,109 +749,191 @@ void GDAL_Disk_Image_Impl::configure_for_writing( const Image_Format&
     // structure for this DiskImageResource
     m_format    = output_format;
     m_blocksize = block_size;
+    m_format.set_channel_type( gdal_storage_channel_type( output_format.channel_type() ) );
 
     m_driver_options = write_options;
 
-    if( m_driver_options["PREDICTOR"].empty() )
+    // The write profile is ours, not GDAL's, so pull it out of the driver options
+    auto profile = GDAL_Write_Profile::NONE;
+    auto profile_it = m_driver_options.find( WRITE_PROFILE_OPTION );
+    if( profile_it != m_driver_options.end() )
     {
-        // Unless predictor was explicitly set, use predictor 3 for
-        // compression of float/double, and predictor 2 for integers,
-        // except whose size is one byte, as for those compression makes
-        // things worse.
-        if( format().channel_type() == Channel_Type_Enum::FLOAT32 ||
-            format().channel_type() == Channel_Type_Enum::FLOAT64 )
-        {
-            m_driver_options["PREDICTOR"] = "3";
-        }
-        else if( is_integer_type( format().channel_type() ) )
-        {
-            m_driver_options["PREDICTOR"] = "2";
-        }
-        else
+        auto profile_res = parse_write_profile( profile_it->second );
+        if( profile_res.has_error() )
         {
-            m_driver_options["PREDICTOR"] = "1"; // Must not leave unset
+            tmns::log::error( profile_res.error().message() );
+            throw std::runtime_error( profile_res.error().message() );
         }
+        profile = profile_res.value();
+        m_driver_options.erase( profile_it );
     }
-    else
+
+    std::unique_lock<std::mutex> lck( get_master_gdal_mutex() );
+    apply_write_profile_locked( profile );
+
+    // Unless predictor was explicitly set (by the user or the profile), pick one
+    // from the channel type.
+    if( m_driver_options["PREDICTOR"].empty() )
     {
-        m_driver_options["PREDICTOR"] = "1"; // Must not leave unset
+        m_driver_options["PREDICTOR"] = default_predictor( format().channel_type() );
     }
 
-    std::unique_lock<std::mutex> lck( get_master_gdal_mutex() );
     initialize_write_resource_locked();
 }
 
-/****************************************/
-/*          Process Metadata            */
-/****************************************/
-void GDAL_Disk_Image_Impl::process_metadata( log::Logger&                 logger, 
-                                             std::shared_ptr<GDALDataset> dataset )
+/************************************************/
+/*          Apply the write profile             */
+/************************************************/
+void GDAL_Disk_Image_Impl::apply_write_profile_locked( GDAL_Write_Profile profile )
 {
-    const bool DO_NOT_OVERWRITE { false };
-    
-    logger.trace( "Metadata Description: ", dataset->GetDescription() );
-    m_metadata->insert( "gdal.description", dataset->GetDescription() );
+    if( profile == GDAL_Write_Profile::NONE )
+    {
+        return;
+    }
+
+    auto& logger = get_master_gdal_logger();
 
-    // Get a list of metadata domains
-    auto metadata_domains = dataset->GetMetadataDomainList();
-    logger.trace( "Domains: ", CSLCount( metadata_domains ) );
-    std::vector<std::string> domain_list;
-    if( CSLCount( metadata_domains ) > 0 )
+    // Compression options are GeoTIFF specific
+    auto ret = gdal_get_driver_locked( m_pathname, true );
+    if( ret.first == nullptr ||
+        std::string( ret.first->GetDescription() ) != "GTiff" )
     {
-        std::stringstream sout;
-        sout << "Domain Items, Count: " << CSLCount( metadata_domains ) << std::endl;
-        for( int i = 0; i < CSLCount( metadata_domains ); i++ )
-        {
-            domain_list.push_back( CSLGetField( metadata_domains, i ) );
-            sout << "\t\t[" << domain_list.back() << "]" << std::endl;
-        }
-        logger.trace( sout.str() );
+        logger.debug( "Write profile ", enum_to_string( profile ), " ignored for non-GeoTIFF output: ", m_pathname.native() );
+        return;
     }
+    GDALDriver* driver = ret.first;
 
-    char** metadata = dataset->GetMetadata();
-    logger.trace( "Count: ", CSLCount(metadata) );
+    const size_t LARGE_IMAGE_PIXELS { 4096 * 4096 };
+    size_t num_pixels = format().cols() * format().rows();
 
-    if( CSLCount(metadata) > 0 )
+    // Bigger tiles give the compressor more to work with, but small images don't need them
+    if( m_blocksize.width() < 0 || m_blocksize.height() < 0 )
     {
-        std::stringstream sout;
-        sout << "Metadata Items, Count: " << CSLCount( metadata ) << std::endl;
-        for( int i = 0; i < CSLCount( metadata ); i++ )
-        {
-            sout << "\t\t" << CSLGetField( metadata, i ) << std::endl;
-        }
-        logger.trace( sout.str() );
+        int tile_size = ( profile == GDAL_Write_Profile::FAST || num_pixels >= LARGE_IMAGE_PIXELS ) ? 512 : 256;
+        m_blocksize = math::Size2i( { tile_size, tile_size } );
     }
 
-    for( const auto& domain : domain_list )
+    // ZSTD is optional in GDAL builds
+    const char* creation_options = driver->GetMetadataItem( GDAL_DMD_CREATIONOPTIONLIST );
+    bool has_zstd = creation_options != nullptr &&
+                    std::string( creation_options ).find( "ZSTD" ) != std::string::npos;
+
+    // Byte imagery compresses worse with the horizontal predictor
+    std::string predictor = default_predictor( format().channel_type() );
+    if( channel_size_bytes( format().channel_type() ).value() == 1 )
     {
-        char** dmetadata = dataset->GetMetadata( domain.c_str() );
-        logger.trace( "Count: ", CSLCount( dmetadata ) );
+        predictor = "1";
+    }
 
-        if( CSLCount( dmetadata ) > 0 && domain != "json:ISIS3" )
-        {
-            std::stringstream sout;
-            sout << "Domain [" << domain << "] Metadata Items, Count: " << CSLCount( dmetadata ) << std::endl;
-            for( int i = 0; i < CSLCount( dmetadata ); i++ )
+    Options profile_options;
+    switch( profile )
+    {
+        case GDAL_Write_Profile::FAST:
+            profile_options["COMPRESS"]  = has_zstd ? "ZSTD" : "LZW";
+            profile_options["PREDICTOR"] = "1";
+            if( has_zstd )
             {
-                sout << "\t\t" << CSLGetField( dmetadata, i ) << std::endl;
+                profile_options["ZSTD_LEVEL"] = "1";
             }
-            logger.trace( sout.str() );
-        }
-        else if( domain == "json:ISIS3" )
-        {
-            logger.debug( "Parsing ISIS3 JSON Node" );
-            for( int i = 0; i < CSLCount( dmetadata ); i++ )
+            break;
+
+        case GDAL_Write_Profile::BALANCED:
+            profile_options["COMPRESS"]  = "DEFLATE";
+            profile_options["ZLEVEL"]    = "6";
+            profile_options["PREDICTOR"] = predictor;
+            break;
+
+        case GDAL_Write_Profile::ARCHIVE:
+            profile_options["COMPRESS"]  = has_zstd ? "ZSTD" : "DEFLATE";
+            profile_options["PREDICTOR"] = predictor;
+            if( has_zstd )
             {
-                auto result = ISIS_JSON_Parser::parse( CSLGetField( dmetadata, i ) );
-                if( result.has_error() )
-                {
-                    logger.error( "Trouble parsing ISIS JSON data.",
-                                  result.error().message() );
-                }
-                m_metadata->insert( result.value(), DO_NOT_OVERWRITE );
+                profile_options["ZSTD_LEVEL"] = "15";
+            }
+            else
+            {
+                profile_options["ZLEVEL"] = "9";
             }
+            break;
+
+        default:
+            break;
+    }
+
+    // Compression threads only help once there is more than one tile
+    size_t tiles_x = ( format().cols() + m_blocksize.width()  - 1 ) / m_blocksize.width();
+    size_t tiles_y = ( format().rows() + m_blocksize.height() - 1 ) / m_blocksize.height();
+    if( tiles_x * tiles_y > 1 )
+    {
+        profile_options["NUM_THREADS"] = "ALL_CPUS";
+    }
+
+    // Anything the caller set explicitly wins
+    for( const auto& option : profile_options )
+    {
+        m_driver_options.emplace( option.first, option.second );
+    }
+
+    logger.debug( "Applied write profile ", enum_to_string( profile ),
+                  " with block size ", m_blocksize.to_string() );
+}
+
+/****************************************************/
+/*          Pick the default TIFF predictor         */
+/****************************************************/
+std::string GDAL_Disk_Image_Impl::default_predictor( Channel_Type_Enum channel_type )
+{
+    // Predictor 3 for compression of float/double, and predictor 2 for integers.
+    if( channel_type == Channel_Type_Enum::FLOAT16 ||
+        channel_type == Channel_Type_Enum::FLOAT32 ||
+        channel_type == Channel_Type_Enum::FLOAT64 )
+    {
+        return "3";
+    }
+    else if( is_integer_type( channel_type ) )
+    {
+        return "2";
+    }
+    return "1"; // Must not leave unset
+}
+
+/****************************************/
+/*          Process Metadata            */
+/****************************************/
+void GDAL_Disk_Image_Impl::process_metadata( log::Logger&                 logger, 
+                                             std::shared_ptr<GDALDataset> dataset )
+{
+    logger.trace( "Metadata Description: ", dataset->GetDescription() );
+    m_metadata->insert( "gdal.description", dataset->GetDescription() );
+
+    // Get a list of metadata domains.  The default domain is always present.
+    std::vector<std::string> domain_list { "" };
+    char** metadata_domains = dataset->GetMetadataDomainList();
+    for( int i = 0; i < CSLCount( metadata_domains ); i++ )
+    {
+        std::string domain = CSLGetField( metadata_domains, i );
+        if( !domain.empty() )
+        {
+            domain_list.push_back( domain );
         }
     }
+    CSLDestroy( metadata_domains );
+    logger.trace( "Domains: ", domain_list.size() );
+
+    // Defer the parsing of each domain until someone asks for metadata
+    for( const auto& domain : domain_list )
+    {
+        m_metadata->insert_deferred( domain,
+                                     [key = m_dataset_key,
+                                      pathname = m_pathname,
+                                      domain]( meta::Metadata_Container_Base& container )
+                                     {
+                                         return load_metadata_domain( key,
+                                                                      pathname,
+                                                                      domain,
+                                                                      container );
+                                     });
+    }
 
     logger.trace( "Driver: ", dataset->GetDriver()->GetDescription(),
                   ", ", dataset->GetDriver()->GetMetadataItem( GDAL_DMD_LONGNAME ) );
@@ -805,4 +946,65 @@ void GDAL_Disk_Image_Impl::process_metadata( log::Logger&                 logger
                   " channels" );
 }
 
+/********************************************/
+/*          Load a Metadata Domain          */
+/********************************************/
+Result<void> GDAL_Disk_Image_Impl::load_metadata_domain( uint64_t                       dataset_key,
+                                                         const std::filesystem::path&   pathname,
+                                                         const std::string&             domain,
+                                                         meta::Metadata_Container_Base& container )
+{
+    const bool DO_NOT_OVERWRITE { false };
+
+    std::unique_lock<std::mutex> lck( get_master_gdal_mutex() );
+    auto& logger = get_master_gdal_logger();
+    auto& registry = GDAL_Dataset_Registry::instance();
+
+    // Don't reopen under the owner's key, as the owner may no longer exist
+    bool borrowed = !registry.is_open_locked( dataset_key );
+    uint64_t load_key = borrowed ? registry.next_key() : dataset_key;
+
+    auto dataset_res = registry.acquire_locked( load_key, pathname );
+    if( dataset_res.has_error() )
+    {
+        return outcome::fail( dataset_res.error() );
+    }
+    auto dataset = dataset_res.value();
+
+    char** dmetadata = dataset->GetMetadata( domain.empty() ? nullptr : domain.c_str() );
+    logger.trace( "Count: ", CSLCount( dmetadata ) );
+
+    if( domain == "json:ISIS3" )
+    {
+        logger.debug( "Parsing ISIS3 JSON Node" );
+        for( int i = 0; i < CSLCount( dmetadata ); i++ )
+        {
+            auto result = ISIS_JSON_Parser::parse( CSLGetField( dmetadata, i ) );
+            if( result.has_error() )
+            {
+                logger.error( "Trouble parsing ISIS JSON data.",
+                              result.error().message() );
+                continue;
+            }
+            container.insert( result.value(), DO_NOT_OVERWRITE );
+        }
+    }
+    else if( CSLCount( dmetadata ) > 0 )
+    {
+        std::stringstream sout;
+        sout << "Domain [" << domain << "] Metadata Items, Count: " << CSLCount( dmetadata ) << std::endl;
+        for( int i = 0; i < CSLCount( dmetadata ); i++ )
+        {
+            sout << "\t\t" << CSLGetField( dmetadata, i ) << std::endl;
+        }
+        logger.trace( sout.str() );
+    }
+
+    if( borrowed )
+    {
+        registry.release_locked( load_key );
+    }
+    return outcome::ok();
+}
+
 } // End of tmns::image::io::gdal namespace
\ No newline at end of file
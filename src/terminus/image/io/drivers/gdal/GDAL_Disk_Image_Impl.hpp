@@ -33,10 +33,12 @@
 
 // Terminus Libraries
 #include "../../../metadata/Metadata_Container_Base.hpp"
+#include "../../../pixel/Channel_Type_Enum.hpp"
 #include "../../../pixel/Pixel_Format_Enum.hpp"
 #include "../../../pixel/Pixel_RGBA.hpp"
 #include "../../../types/Image_Buffer.hpp"
 #include "../../../types/Image_Format.hpp"
+#include "GDAL_Write_Profile.hpp"
 
 namespace tmns::image::io::gdal {
 
@@ -65,6 +67,15 @@ class GDAL_Disk_Image_Impl
                               const math::Size2i&                      block_size,
                               const ColorCodeLookupT&                  color_reference_lut );
 
+        /**
+         * Destructor.  Releases the read dataset from the registry.
+        */
+        ~GDAL_Disk_Image_Impl();
+
+        /// Copies would release the same registry key twice
+        GDAL_Disk_Image_Impl( const GDAL_Disk_Image_Impl& ) = delete;
+        GDAL_Disk_Image_Impl& operator = ( const GDAL_Disk_Image_Impl& ) = delete;
+
         /**
          * Open the dataset
         */
@@ -95,7 +106,10 @@ class GDAL_Disk_Image_Impl
         Image_Format format() const;
 
         /**
-         * Get the GDALDataset point for whatever dataset is active.
+         * Get the GDALDataset point for whatever dataset is active.  If the read dataset
+         * was closed by the registry, it is reopened here.
+         *
+         * @note Caller must hold the master GDAL mutex.
         */
         Result<DatasetPtrT> get_dataset_ptr() const;
 
@@ -140,7 +154,7 @@ class GDAL_Disk_Image_Impl
         void flush();
 
         /**
-         * Get the internal metadata container
+         * Get the internal metadata container.  Metadata domains are loaded on first query.
          */
         meta::Metadata_Container_Base::ptr_t metadata() const;
 
@@ -165,6 +179,17 @@ class GDAL_Disk_Image_Impl
         */
         Result<double> nodata_read_ok() const;
 
+        /**
+         * Fill in block size and creation options from the write profile.  Options
+         * already present in the driver options are left alone.
+        */
+        void apply_write_profile_locked( GDAL_Write_Profile profile );
+
+        /**
+         * Get the TIFF predictor to use for the channel type
+        */
+        static std::string default_predictor( Channel_Type_Enum channel_type );
+
         /**
          * Setup the GDAL structure for writing files
         */
@@ -173,16 +198,31 @@ class GDAL_Disk_Image_Impl
                                     const math::Size2i&                      block_size );
 
         /**
-         * Process Dataset Metadata
+         * Process Dataset Metadata.  Only cheap driver information is extracted here.  Each
+         * metadata domain is registered as a deferred domain and parsed on first query.
          */
         void process_metadata( log::Logger&                 logger, 
                                std::shared_ptr<GDALDataset> dataset );
 
+        /**
+         * Extract a single metadata domain.  Uses the owner's dataset if it is still open,
+         * otherwise opens a temporary one.
+         */
+        static Result<void> load_metadata_domain( uint64_t                      dataset_key,
+                                                  const std::filesystem::path&  pathname,
+                                                  const std::string&            domain,
+                                                  meta::Metadata_Container_Base& container );
+
         /// Pathname to image
         std::filesystem::path m_pathname;
 
-        /// GDAL Datasets
-        std::shared_ptr<GDALDataset> m_read_dataset;
+        /// Registry key for the read dataset
+        uint64_t m_dataset_key;
+
+        /// Set once the read dataset opened successfully
+        bool m_read_enabled { false };
+
+        /// GDAL Datasets.  Read datasets are owned by the GDAL_Dataset_Registry.
         std::shared_ptr<GDALDataset> m_write_dataset;
 
         /// Format Information
@@ -18,6 +18,7 @@
 #include <terminus/log/Logger.hpp>
 
 // Terminus Libraries
+#include "GDAL_Cache_Budget.hpp"
 #include "GDAL_Codes.hpp"
 
 // Boost Libraries
@@ -82,6 +83,10 @@ Result<void> Initialize_GDAL()
     CPLSetConfigOption("GDAL_MAX_DATASET_POOL_SIZE", "400");
     GDALAllRegister();
 
+    // GDAL's block cache is sized from the shared budget rather than its 5%-of-RAM default,
+    // unless the user already set GDAL_CACHEMAX
+    GDAL_Cache_Budget::instance().apply();
+
     return outcome::ok();
 }
 
@@ -144,6 +149,9 @@ Result<Channel_Type_Enum> gdal_pixel_format_to_channel_type( GDALDataType gdal_t
         case GDT_UInt16:  return Channel_Type_Enum::UINT16;
         case GDT_Int32:   return Channel_Type_Enum::INT32;
         case GDT_UInt32:  return Channel_Type_Enum::UINT32;
+#ifdef TMNS_GDAL_HAS_FLOAT16
+        case GDT_Float16: return Channel_Type_Enum::FLOAT16;
+#endif
         case GDT_Float32: return Channel_Type_Enum::FLOAT32;
         case GDT_Float64: return Channel_Type_Enum::FLOAT64;
         default:
@@ -181,6 +189,11 @@ Result<GDALDataType> channel_type_to_gdal_pixel_format( Channel_Type_Enum channe
         case Channel_Type_Enum::INT32:
             return outcome::ok<GDALDataType>( GDT_Int32 );
 
+#ifdef TMNS_GDAL_HAS_FLOAT16
+        case Channel_Type_Enum::FLOAT16:
+            return outcome::ok<GDALDataType>( GDT_Float16 );
+#endif
+
         case Channel_Type_Enum::FLOAT32:
         case Channel_Type_Enum::FLOAT32Free:
             return outcome::ok<GDALDataType>( GDT_Float32 );
@@ -197,6 +210,43 @@ Result<GDALDataType> channel_type_to_gdal_pixel_format( Channel_Type_Enum channe
     }
 }
 
+/****************************************************/
+/*      Get the Channel-Type Stored on Disk         */
+/****************************************************/
+Channel_Type_Enum gdal_storage_channel_type( Channel_Type_Enum channel_type )
+{
+#ifndef TMNS_GDAL_HAS_FLOAT16
+    if( channel_type == Channel_Type_Enum::FLOAT16 )
+    {
+        return Channel_Type_Enum::FLOAT32;
+    }
+#endif
+    return channel_type;
+}
+
+/****************************************************/
+/*      Get the Channel-Type from NBITS             */
+/****************************************************/
+Channel_Type_Enum gdal_nbits_channel_type( Channel_Type_Enum channel_type,
+                                           const char*       nbits )
+{
+    if( channel_type != Channel_Type_Enum::UINT16 || nbits == nullptr )
+    {
+        return channel_type;
+    }
+
+    std::string bits( nbits );
+    if( bits == "12" )
+    {
+        return Channel_Type_Enum::UINT12;
+    }
+    if( bits == "14" )
+    {
+        return Channel_Type_Enum::UINT14;
+    }
+    return channel_type;
+}
+
 /********************************/
 /*          Get driver          */
 /********************************/
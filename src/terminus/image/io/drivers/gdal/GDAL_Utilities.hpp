@@ -35,6 +35,11 @@
 #include <tuple>
 #include <vector>
 
+/// GDAL 3.11 added a native half-precision data type
+#if defined(GDAL_COMPUTE_VERSION) && GDAL_VERSION_NUM >= GDAL_COMPUTE_VERSION(3,11,0)
+#define TMNS_GDAL_HAS_FLOAT16 1
+#endif
+
 namespace tmns::image::io::gdal {
 
 /**
@@ -74,6 +79,21 @@ Result<Channel_Type_Enum> gdal_pixel_format_to_channel_type( GDALDataType gdal_t
 */
 Result<GDALDataType> channel_type_to_gdal_pixel_format( Channel_Type_Enum channel_type );
 
+/**
+ * Channel type to store on disk for the requested type.  FLOAT16 is widened to FLOAT32
+ * when GDAL has no half-precision type.
+*/
+Channel_Type_Enum gdal_storage_channel_type( Channel_Type_Enum channel_type );
+
+/**
+ * Channel type for a band, given its GDAL type and its NBITS item from the IMAGE_STRUCTURE
+ * metadata domain.  GDAL hands 12/14-bit data back as GDT_UInt16, so NBITS of 12 or 14
+ * narrows UINT16 to UINT12/UINT14.  Anything else is returned as-is.
+ * @param nbits NBITS value, or null if the band has none
+*/
+Channel_Type_Enum gdal_nbits_channel_type( Channel_Type_Enum channel_type,
+                                           const char*       nbits );
+
 /**
  * Get the GDAL driver for the specified filename.  Will determine if you can read and write,
  * or just read.
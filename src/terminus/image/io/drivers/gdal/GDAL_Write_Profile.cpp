@@ -0,0 +1,61 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    GDAL_Write_Profile.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "GDAL_Write_Profile.hpp"
+
+// Boost Libraries
+#include <boost/algorithm/string.hpp>
+
+namespace tmns::image::io::gdal {
+
+/****************************************/
+/*          Convert to String           */
+/****************************************/
+std::string enum_to_string( GDAL_Write_Profile profile )
+{
+    switch( profile )
+    {
+        case GDAL_Write_Profile::NONE:
+            return "none";
+        case GDAL_Write_Profile::FAST:
+            return "fast";
+        case GDAL_Write_Profile::BALANCED:
+            return "balanced";
+        case GDAL_Write_Profile::ARCHIVE:
+            return "archive";
+    }
+    return "UNKNOWN";
+}
+
+/****************************************/
+/*          Parse Profile Name          */
+/****************************************/
+Result<GDAL_Write_Profile> parse_write_profile( const std::string& name )
+{
+    std::string lower = boost::to_lower_copy( name );
+    for( auto profile : { GDAL_Write_Profile::NONE,
+                          GDAL_Write_Profile::FAST,
+                          GDAL_Write_Profile::BALANCED,
+                          GDAL_Write_Profile::ARCHIVE } )
+    {
+        if( lower == enum_to_string( profile ) )
+        {
+            return outcome::ok<GDAL_Write_Profile>( profile );
+        }
+    }
+    return outcome::fail( core::error::ErrorCode::NOT_FOUND,
+                          "Unknown GDAL write profile: ", name );
+}
+
+} // End of tmns::image::io::gdal namespace
@@ -30,6 +30,10 @@ Image_Resource_Disk_GDAL::Image_Resource_Disk_GDAL( const std::filesystem::path&
 {
     m_impl = std::make_shared<GDAL_Disk_Image_Impl>( pathname,
                                                      color_reference_lut );
+
+    // Metadata domains stay deferred until queried
+    metadata()->insert( m_impl->metadata(),
+                        true );
 }
 
 /********************************/
@@ -48,6 +52,9 @@ Image_Resource_Disk_GDAL::Image_Resource_Disk_GDAL( const std::filesystem::path&
                                                      write_options,
                                                      block_size,
                                                      color_reference_lut );
+
+    metadata()->insert( m_impl->metadata(),
+                        true );
 }
 
 /********************************/
@@ -74,10 +81,6 @@ Result<Image_Resource_Disk_GDAL::ParentPtrT>
 {
     auto driver = std::make_shared<Image_Resource_Disk_GDAL>( pathname );
 
-    // Update Metadata
-    driver->metadata()->insert( driver->m_impl->metadata(),
-                                        true );
-
     return outcome::ok<ParentPtrT>( driver );
 }
 
@@ -96,10 +99,6 @@ Result<Image_Resource_Disk_GDAL::ParentPtrT>
                                                               write_options,
                                                               block_size,
                                                               color_reference_lut );
-    
-    // Update Metadata
-    driver->metadata()->insert( driver->m_impl->metadata(),
-                                        true );
 
     return outcome::ok<ParentPtrT>( driver );
 }
@@ -109,7 +108,16 @@ Result<Image_Resource_Disk_GDAL::ParentPtrT>
 /************************************/
 Result<void> Image_Resource_Disk_GDAL::open( const std::filesystem::path& pathname )
 {
-    return m_impl->open( pathname );
+    auto result = m_impl->open( pathname );
+    if( result.has_error() )
+    {
+        return result;
+    }
+
+    // The merge below brings the new dataset's domains along
+    metadata()->clear_deferred();
+    return metadata()->insert( m_impl->metadata(),
+                               true );
 }
 
 /****************************************************/
@@ -118,13 +126,7 @@ Result<void> Image_Resource_Disk_GDAL::open( const std::filesystem::path& pathna
 Result<void> Image_Resource_Disk_GDAL::read( const Image_Buffer& dest,
                                              const math::Rect2i& bbox ) const
 {
-    auto result = m_impl->read( dest, bbox, m_rescale );
-
-    // Process metadata
-    metadata()->insert( m_impl->metadata(),
-                        true );
-
-    return result;
+    return m_impl->read( dest, bbox, m_rescale );
 }
 
 /****************************************************/
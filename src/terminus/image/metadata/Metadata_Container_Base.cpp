@@ -8,6 +8,10 @@
 // Terminus Libraries
 #include <terminus/core/thirdparty/boost/ptree_utilities.hpp>
 
+// C++ Libraries
+#include <algorithm>
+#include <sstream>
+
 namespace tmns::image::meta {
 
 /****************************************************/
@@ -15,6 +19,8 @@ namespace tmns::image::meta {
 /****************************************************/
 size_t Metadata_Container_Base::number_child_nodes() const
 {
+    load_all();
+    std::unique_lock<std::mutex> lck( m_mtx );
     return core::thirdparty::boost::number_child_nodes( m_tree );
 }
 
@@ -30,17 +36,100 @@ Result<void> Metadata_Container_Base::insert( const Metadata_Container_Base::ptr
                               "Input container is null." );
     }
 
+    if( container.get() == this )
+    {
+        return outcome::ok();
+    }
+
+    std::scoped_lock lck( m_mtx, container->m_mtx );
+
+    // Carry the other container's deferred domains along without loading them
+    for( const auto& pending : container->m_pending )
+    {
+        bool known = false;
+        for( const auto& p : m_pending )
+        {
+            known = known || ( p.entry == pending.entry );
+        }
+        for( const auto& l : m_loaded )
+        {
+            known = known || ( l == pending.entry );
+        }
+        if( !known )
+        {
+            m_pending.push_back( { pending.entry, overwrite_matches } );
+        }
+    }
+
     return core::thirdparty::boost::merge_ptrees( m_tree, 
                                                   container->m_tree,
                                                   overwrite_matches );
     
 }
 
+/************************************************/
+/*          Register a deferred domain          */
+/************************************************/
+void Metadata_Container_Base::insert_deferred( const std::string& domain,
+                                               loader_type        loader,
+                                               bool               overwrite_matches )
+{
+    auto entry = std::make_shared<Deferred_Domain>();
+    entry->domain = domain;
+    entry->loader = std::move( loader );
+
+    std::unique_lock<std::mutex> lck( m_mtx );
+    m_pending.push_back( { entry, overwrite_matches } );
+}
+
+/****************************************/
+/*          Load a single domain        */
+/****************************************/
+Result<void> Metadata_Container_Base::load_domain( const std::string& domain ) const
+{
+    return load_pending( domain );
+}
+
+/****************************************/
+/*          Load all domains            */
+/****************************************/
+Result<void> Metadata_Container_Base::load_all() const
+{
+    return load_pending( std::nullopt );
+}
+
+/********************************************/
+/*          Get the unloaded domains        */
+/********************************************/
+std::vector<std::string> Metadata_Container_Base::deferred_domains() const
+{
+    std::unique_lock<std::mutex> lck( m_mtx );
+    std::vector<std::string> output;
+    for( const auto& pending : m_pending )
+    {
+        output.push_back( pending.entry->domain );
+    }
+    return output;
+}
+
+/********************************************/
+/*          Drop the unloaded domains       */
+/********************************************/
+void Metadata_Container_Base::clear_deferred()
+{
+    std::unique_lock<std::mutex> lck( m_mtx );
+    m_pending.clear();
+    m_loaded.clear();
+}
+
 /********************************************/
 /*          Print to Pretty String          */
 /********************************************/
 std::string Metadata_Container_Base::to_log_string( size_t offset ) const
 {
+    load_all();
+
+    std::unique_lock<std::mutex> lck( m_mtx );
     std::stringstream sout;
 
     sout << core::thirdparty::boost::print_ptree( m_tree, 
@@ -49,4 +138,71 @@ std::string Metadata_Container_Base::to_log_string( size_t offset ) const
     return sout.str();
 }
 
+/********************************************/
+/*          Load the pending domains        */
+/********************************************/
+Result<void> Metadata_Container_Base::load_pending( const std::optional<std::string>& domain ) const
+{
+    // Pull the matching entries off the list
+    std::vector<Pending_Domain> to_load;
+    {
+        std::unique_lock<std::mutex> lck( m_mtx );
+        if( m_pending.empty() )
+        {
+            return outcome::ok();
+        }
+        for( const auto& pending : m_pending )
+        {
+            if( !domain || pending.entry->domain == domain.value() )
+            {
+                to_load.push_back( pending );
+            }
+        }
+    }
+
+    /**
+     * Run the loaders without holding the container lock, since loaders may need other locks
+     * (e.g. the GDAL mutex) which are held while inserting into containers.
+     */
+    for( const auto& pending : to_load )
+    {
+        auto entry = pending.entry;
+        std::call_once( entry->flag, [&entry](){
+            entry->contents = std::make_shared<Metadata_Container_Base>();
+            entry->status   = entry->loader( *entry->contents );
+            entry->loader   = nullptr;
+        });
+    }
+
+    // Merge the results into this tree
+    std::unique_lock<std::mutex> lck( m_mtx );
+    for( const auto& pending : to_load )
+    {
+        auto it = std::find_if( m_pending.begin(),
+                                m_pending.end(),
+                                [&pending]( const Pending_Domain& p ){ return p.entry == pending.entry; } );
+        if( it == m_pending.end() )
+        {
+            // Another thread already merged it
+            continue;
+        }
+        m_pending.erase( it );
+        m_loaded.push_back( pending.entry );
+
+        if( pending.entry->status.value().has_error() )
+        {
+            return outcome::fail( pending.entry->status.value().error() );
+        }
+
+        auto res = core::thirdparty::boost::merge_ptrees( m_tree,
+                                                          pending.entry->contents->m_tree,
+                                                          pending.overwrite_matches );
+        if( res.has_error() )
+        {
+            return res;
+        }
+    }
+    return outcome::ok();
+}
+
 } // End of tmns::image::meta
\ No newline at end of file
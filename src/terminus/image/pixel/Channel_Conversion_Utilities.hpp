@@ -5,6 +5,12 @@
 */
 #pragma once
 
+// C++ Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
 namespace tmns::image {
 
 /**
@@ -24,5 +30,50 @@ template <> struct Accumulator_Type<int64_t>   { typedef int64_t  type; };
 template <> struct Accumulator_Type<float>     { typedef double   type; };
 template <> struct Accumulator_Type<double>    { typedef double   type; };
 
+/**
+ * Average the channels of a pixel
+*/
+template <class T>
+void channel_average( T* src, T* dest, int len )
+{
+    typename Accumulator_Type<T>::type accum = typename Accumulator_Type<T>::type();
+    for( int32_t i=0; i<len; ++i ) accum += src[i];
+    *dest = accum / len;
+}
+
+/**
+ * Multiply the color channels of an integer pixel by its alpha (last channel),
+ * rounded to nearest.  Exact for channels of 16 bits or fewer.
+*/
+template <class T>
+void channel_premultiply_int( T* src, T* dst, int32_t len )
+{
+    const double max = (double)std::numeric_limits<T>::max();
+    for( int i=0; i<len-1; ++i ) dst[i] = T( std::round( src[i] * (double)src[len-1] / max ) );
+    dst[len-1] = src[len-1];
+}
+
+/**
+ * Divide the color channels of an integer pixel by its alpha (last channel), rounded
+ * to nearest and saturated.  Fully transparent pixels come out black.  Exact for
+ * channels of 16 bits or fewer.
+*/
+template <class T>
+void channel_unpremultiply_int( T* src, T* dst, int len )
+{
+    const double max = (double)std::numeric_limits<T>::max();
+    for( int i=0; i<len-1; ++i )
+    {
+        if( src[len-1] == 0 )
+        {
+            dst[i] = T( 0 );
+            continue;
+        }
+        double value = std::round( src[i] * max / (double)src[len-1] );
+        dst[i] = T( std::clamp( value, (double)std::numeric_limits<T>::lowest(), max ) );
+    }
+    dst[len-1] = src[len-1];
+}
+
 
 } // End of tmns::image namespace
\ No newline at end of file
@@ -0,0 +1,123 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Channel_Lookup_Table.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "Channel_Lookup_Table.hpp"
+
+// C++ Libraries
+#include <tuple>
+
+namespace tmns::image::pix {
+
+/****************************************/
+/*          Key Ordering                */
+/****************************************/
+bool Lookup_Table_Key::operator < ( const Lookup_Table_Key& rhs ) const
+{
+    return std::tie( src_type, dst_type, name, params, table_type ) <
+           std::tie( rhs.src_type, rhs.dst_type, rhs.name, rhs.params, rhs.table_type );
+}
+
+/****************************************/
+/*          Key Equality                */
+/****************************************/
+bool Lookup_Table_Key::operator == ( const Lookup_Table_Key& rhs ) const
+{
+    return std::tie( src_type, dst_type, name, params, table_type ) ==
+           std::tie( rhs.src_type, rhs.dst_type, rhs.name, rhs.params, rhs.table_type );
+}
+
+/************************************************/
+/*          Get the global cache instance       */
+/************************************************/
+Lookup_Table_Cache& Lookup_Table_Cache::instance()
+{
+    static Lookup_Table_Cache s_instance;
+    return s_instance;
+}
+
+/****************************************************/
+/*          Get the table, building if needed       */
+/****************************************************/
+Lookup_Table_Cache::table_ptr_t Lookup_Table_Cache::get( const Lookup_Table_Key& key,
+                                                         const builder_type&     builder )
+{
+    {
+        std::unique_lock<std::mutex> lck( m_mtx );
+        auto it = m_tables.find( key );
+        if( it != m_tables.end() )
+        {
+            m_lru.splice( m_lru.begin(), m_lru, it->second.lru_pos );
+            return it->second.table;
+        }
+    }
+
+    // Building a 16-bit table takes a while, so don't block other lookups.  If two threads
+    // race on the same key, the first one in wins and both get the same table.
+    auto table = builder();
+
+    std::unique_lock<std::mutex> lck( m_mtx );
+    auto it = m_tables.find( key );
+    if( it != m_tables.end() )
+    {
+        return it->second.table;
+    }
+
+    m_lru.push_front( key );
+    m_tables[key] = Entry{ table, m_lru.begin() };
+    evict_locked();
+    return table;
+}
+
+/****************************************/
+/*          Set the max entries         */
+/****************************************/
+void Lookup_Table_Cache::set_max_entries( size_t max_entries )
+{
+    std::unique_lock<std::mutex> lck( m_mtx );
+    m_max_entries = max_entries;
+    evict_locked();
+}
+
+/****************************************/
+/*          Get the cache size          */
+/****************************************/
+size_t Lookup_Table_Cache::size() const
+{
+    std::unique_lock<std::mutex> lck( m_mtx );
+    return m_tables.size();
+}
+
+/****************************************/
+/*          Clear the cache             */
+/****************************************/
+void Lookup_Table_Cache::clear()
+{
+    std::unique_lock<std::mutex> lck( m_mtx );
+    m_tables.clear();
+    m_lru.clear();
+}
+
+/****************************************************/
+/*          Drop least-recently-used tables         */
+/****************************************************/
+void Lookup_Table_Cache::evict_locked()
+{
+    while( m_tables.size() > m_max_entries && !m_lru.empty() )
+    {
+        m_tables.erase( m_lru.back() );
+        m_lru.pop_back();
+    }
+}
+
+} // End of tmns::image::pix namespace
@@ -34,6 +34,8 @@ std::string enum_to_string( Channel_Type_Enum val )
             return "INT16";
         case Channel_Type_Enum::INT32:
             return "INT32";
+        case Channel_Type_Enum::FLOAT16:
+            return "FLOAT16";
         case Channel_Type_Enum::FLOAT32:
             return "FLOAT32";
         case Channel_Type_Enum::FLOAT32Free:
@@ -68,6 +70,7 @@ bool is_integer_type( Channel_Type_Enum val )
             return true;
 
 
+        case Channel_Type_Enum::FLOAT16:
         case Channel_Type_Enum::FLOAT32:
         case Channel_Type_Enum::FLOAT64:
         case Channel_Type_Enum::FLOAT32Free:
@@ -94,6 +97,7 @@ Result<size_t> channel_size_bytes( Channel_Type_Enum val )
         case Channel_Type_Enum::UINT14:
         case Channel_Type_Enum::UINT16:
         case Channel_Type_Enum::INT16:
+        case Channel_Type_Enum::FLOAT16:
             return outcome::ok<size_t>( 2 );
 
         // Four-byte entries
@@ -115,4 +119,36 @@ Result<size_t> channel_size_bytes( Channel_Type_Enum val )
     }
 }
 
+/********************************************************/
+/*          Get the size of the channel in bits         */
+/********************************************************/
+Result<size_t> channel_size_bits( Channel_Type_Enum val )
+{
+    switch( val )
+    {
+        case Channel_Type_Enum::UINT12:
+            return outcome::ok<size_t>( 12 );
+        case Channel_Type_Enum::UINT14:
+            return outcome::ok<size_t>( 14 );
+        default:
+            break;
+    }
+
+    auto bytes = channel_size_bytes( val );
+    if( bytes.has_error() )
+    {
+        return outcome::fail( bytes.error() );
+    }
+    return outcome::ok<size_t>( bytes.value() * 8 );
+}
+
+/****************************************************/
+/*          Check if the type can be bit-packed     */
+/****************************************************/
+bool is_packable_type( Channel_Type_Enum val )
+{
+    return val == Channel_Type_Enum::UINT12 ||
+           val == Channel_Type_Enum::UINT14;
+}
+
 } // end of tmns::image namespace
\ No newline at end of file
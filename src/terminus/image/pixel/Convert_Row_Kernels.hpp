@@ -0,0 +1,260 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Convert_Row_Kernels.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Terminus Libraries
+#include "Channel_Type_Enum.hpp"
+#include "Channel_Conversion_Utilities.hpp"
+
+namespace tmns::image::detail {
+
+/**
+ * Convert a single channel value.  This mirrors the per-channel functions registered in
+ * convert.cpp, but is resolved at compile time so the row loop can be inlined and vectorized.
+ */
+template <typename SrcT, typename DstT, bool RescaleV>
+inline DstT convert_channel( SrcT value )
+{
+    if constexpr ( std::is_same_v<SrcT,DstT> || !RescaleV )
+    {
+        return DstT( value );
+    }
+    else if constexpr ( std::is_same_v<SrcT,uint16_t> && std::is_same_v<DstT,uint8_t> )
+    {
+        return uint8_t( value / (65535/255) );
+    }
+    else if constexpr ( std::is_same_v<SrcT,uint8_t> && std::is_same_v<DstT,uint16_t> )
+    {
+        return uint16_t( value ) * (65535/255);
+    }
+    else if constexpr ( std::is_integral_v<SrcT> && std::is_floating_point_v<DstT> )
+    {
+        return DstT( value ) * ( DstT( 1.0 ) / static_cast<DstT>( std::numeric_limits<SrcT>::max() ) );
+    }
+    else if constexpr ( std::is_floating_point_v<SrcT> && std::is_integral_v<DstT> )
+    {
+        if( value > SrcT( 1.0 ) )      return std::numeric_limits<DstT>::max();
+        else if( !( value >= SrcT( 0.0 ) ) ) return DstT( 0 );
+        else                           return DstT( value * std::numeric_limits<DstT>::max() );
+    }
+    else
+    {
+        return DstT( value );
+    }
+}
+
+/**
+ * Maximum channel value, used when adding an alpha channel
+ */
+template <typename DstT>
+constexpr DstT channel_max_value()
+{
+    if constexpr ( std::is_floating_point_v<DstT> )
+    {
+        return DstT( 1.0 );
+    }
+    else
+    {
+        return std::numeric_limits<DstT>::max();
+    }
+}
+
+/**
+ * Row kernel for a fixed (channel type, channel count, rescale) combination.
+ *
+ * Applies the same channel-count rules as the generic loop in `convert()`:
+ * copy the shared channels, triplicate gray into color, average color into gray,
+ * then copy or add alpha.  Premultiplication is left to the generic loop.
+ */
+template <typename SrcT, typename DstT, bool RescaleV, int SrcChannelsV, int DstChannelsV>
+struct Convert_Row_Kernel
+{
+    static constexpr int COPY_LENGTH = ( SrcChannelsV == DstChannelsV ) ? SrcChannelsV :
+                                       ( SrcChannelsV < 3 ) ? 1 : ( DstChannelsV >= 3 ) ? 3 : 0;
+    static constexpr bool TRIPLICATE = SrcChannelsV < 3  && DstChannelsV >= 3;
+    static constexpr bool AVERAGE    = SrcChannelsV >= 3 && DstChannelsV < 3;
+    static constexpr bool ADD_ALPHA  = SrcChannelsV % 2 == 1 && DstChannelsV % 2 == 0;
+    static constexpr bool COPY_ALPHA = SrcChannelsV != DstChannelsV && SrcChannelsV % 2 == 0 && DstChannelsV % 2 == 0;
+
+    /**
+     * Convert a single pixel
+     */
+    static inline void pixel( const SrcT* src, DstT* dst )
+    {
+        for( int ch = 0; ch < COPY_LENGTH; ++ch )
+        {
+            dst[ch] = convert_channel<SrcT,DstT,RescaleV>( src[ch] );
+        }
+
+        if constexpr ( TRIPLICATE )
+        {
+            dst[1] = convert_channel<SrcT,DstT,RescaleV>( src[0] );
+            dst[2] = dst[1];
+        }
+        else if constexpr ( AVERAGE )
+        {
+            typename Accumulator_Type<DstT>::type accum = typename Accumulator_Type<DstT>::type();
+            accum += convert_channel<SrcT,DstT,RescaleV>( src[0] );
+            accum += convert_channel<SrcT,DstT,RescaleV>( src[1] );
+            accum += convert_channel<SrcT,DstT,RescaleV>( src[2] );
+            dst[0] = accum / 3;
+        }
+
+        if constexpr ( COPY_ALPHA )
+        {
+            dst[DstChannelsV-1] = convert_channel<SrcT,DstT,RescaleV>( src[SrcChannelsV-1] );
+        }
+        else if constexpr ( ADD_ALPHA )
+        {
+            dst[DstChannelsV-1] = channel_max_value<DstT>();
+        }
+    }
+
+    /**
+     * Convert a row of pixels.  Strides are in bytes.
+     */
+    static void run( const uint8_t* src,
+                     uint8_t*       dst,
+                     size_t         cols,
+                     std::ptrdiff_t src_cstride,
+                     std::ptrdiff_t dst_cstride )
+    {
+        // Packed pixels get a flat loop the compiler can vectorize
+        if( src_cstride == std::ptrdiff_t( SrcChannelsV * sizeof(SrcT) ) &&
+            dst_cstride == std::ptrdiff_t( DstChannelsV * sizeof(DstT) ) )
+        {
+            const SrcT* src_ptr = reinterpret_cast<const SrcT*>( src );
+            DstT*       dst_ptr = reinterpret_cast<DstT*>( dst );
+            for( size_t c = 0; c < cols; ++c )
+            {
+                pixel( src_ptr + c * SrcChannelsV,
+                       dst_ptr + c * DstChannelsV );
+            }
+        }
+        else
+        {
+            for( size_t c = 0; c < cols; ++c )
+            {
+                pixel( reinterpret_cast<const SrcT*>( src ),
+                       reinterpret_cast<DstT*>( dst ) );
+                src += src_cstride;
+                dst += dst_cstride;
+            }
+        }
+    }
+};
+
+/// Row kernel function type.  Strides are in bytes.
+typedef void (*row_kernel_func)( const uint8_t* src,
+                                 uint8_t*       dst,
+                                 size_t         cols,
+                                 std::ptrdiff_t src_cstride,
+                                 std::ptrdiff_t dst_cstride );
+
+/// Channel types with specialized row kernels.  Everything else takes the generic path.
+using Row_Kernel_Types = std::tuple<uint8_t, uint16_t, float, double>;
+
+/// Number of channel types with specialized kernels
+static constexpr size_t ROW_KERNEL_NUM_TYPES = std::tuple_size_v<Row_Kernel_Types>;
+
+/// Largest channel count with specialized kernels
+static constexpr size_t ROW_KERNEL_MAX_CHANNELS = 4;
+
+/// Size of the dispatch table
+static constexpr size_t ROW_KERNEL_TABLE_SIZE = ROW_KERNEL_NUM_TYPES * ROW_KERNEL_NUM_TYPES * 2 *
+                                                ROW_KERNEL_MAX_CHANNELS * ROW_KERNEL_MAX_CHANNELS;
+
+/**
+ * Get the row-kernel type index for a channel type, or -1 if not specialized
+ */
+constexpr int row_kernel_type_index( Channel_Type_Enum channel_type )
+{
+    switch( channel_type )
+    {
+        case Channel_Type_Enum::UINT8:   return 0;
+        case Channel_Type_Enum::UINT16:  return 1;
+        case Channel_Type_Enum::FLOAT32: return 2;
+        case Channel_Type_Enum::FLOAT64: return 3;
+        default:                         return -1;
+    }
+}
+
+/**
+ * Build the kernel for a flattened table index
+ */
+template <size_t IndexV>
+constexpr row_kernel_func make_row_kernel()
+{
+    constexpr size_t dst_ch = IndexV % ROW_KERNEL_MAX_CHANNELS;
+    constexpr size_t src_ch = ( IndexV / ROW_KERNEL_MAX_CHANNELS ) % ROW_KERNEL_MAX_CHANNELS;
+    constexpr size_t resc   = ( IndexV / ( ROW_KERNEL_MAX_CHANNELS * ROW_KERNEL_MAX_CHANNELS ) ) % 2;
+    constexpr size_t dst_t  = ( IndexV / ( ROW_KERNEL_MAX_CHANNELS * ROW_KERNEL_MAX_CHANNELS * 2 ) ) % ROW_KERNEL_NUM_TYPES;
+    constexpr size_t src_t  = IndexV / ( ROW_KERNEL_MAX_CHANNELS * ROW_KERNEL_MAX_CHANNELS * 2 * ROW_KERNEL_NUM_TYPES );
+
+    return &Convert_Row_Kernel<std::tuple_element_t<src_t,Row_Kernel_Types>,
+                               std::tuple_element_t<dst_t,Row_Kernel_Types>,
+                               resc == 1,
+                               src_ch + 1,
+                               dst_ch + 1>::run;
+}
+
+/**
+ * Build the whole dispatch table at compile time
+ */
+template <size_t... IndexV>
+constexpr std::array<row_kernel_func,sizeof...(IndexV)> make_row_kernel_table( std::index_sequence<IndexV...> )
+{
+    return {{ make_row_kernel<IndexV>()... }};
+}
+
+/// Dispatch table of row kernels
+inline constexpr std::array<row_kernel_func,ROW_KERNEL_TABLE_SIZE> row_kernel_table =
+    make_row_kernel_table( std::make_index_sequence<ROW_KERNEL_TABLE_SIZE>() );
+
+/**
+ * Select the row kernel for the conversion, or nullptr if the combination has no
+ * specialized kernel.
+ */
+inline row_kernel_func select_row_kernel( Channel_Type_Enum src_type,
+                                          Channel_Type_Enum dst_type,
+                                          bool              rescale,
+                                          size_t            src_channels,
+                                          size_t            dst_channels )
+{
+    int src_idx = row_kernel_type_index( src_type );
+    int dst_idx = row_kernel_type_index( dst_type );
+    if( src_idx < 0 || dst_idx < 0 ||
+        src_channels < 1 || src_channels > ROW_KERNEL_MAX_CHANNELS ||
+        dst_channels < 1 || dst_channels > ROW_KERNEL_MAX_CHANNELS )
+    {
+        return nullptr;
+    }
+
+    size_t index = ( ( ( src_idx * ROW_KERNEL_NUM_TYPES + dst_idx ) * 2 + ( rescale ? 1 : 0 ) )
+                     * ROW_KERNEL_MAX_CHANNELS + ( src_channels - 1 ) )
+                   * ROW_KERNEL_MAX_CHANNELS + ( dst_channels - 1 );
+    return row_kernel_table[index];
+}
+
+} // End of tmns::image::detail namespace
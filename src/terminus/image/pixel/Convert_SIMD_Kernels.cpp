@@ -0,0 +1,674 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Convert_SIMD_Kernels.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "Convert_SIMD_Kernels.hpp"
+
+// C++ Libraries
+#include <algorithm>
+#include <cstring>
+
+// SIMD kernels are compiled per-function with target attributes, so the library
+// itself does not need to be built with -mavx2.
+#if ( defined(__x86_64__) || defined(__i386__) ) && defined(__GNUC__)
+#define TMNS_CONVERT_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace tmns::image::detail {
+
+/****************************************/
+/*          Convert to String           */
+/****************************************/
+std::string enum_to_string( SIMD_Level level )
+{
+    switch( level )
+    {
+        case SIMD_Level::SCALAR: return "SCALAR";
+        case SIMD_Level::SSE4:   return "SSE4";
+        case SIMD_Level::AVX2:   return "AVX2";
+    }
+    return "UNKNOWN";
+}
+
+/****************************************/
+/*          Detect the CPU level        */
+/****************************************/
+SIMD_Level simd_level()
+{
+    static const SIMD_Level s_level = [](){
+#ifdef TMNS_CONVERT_X86_SIMD
+        __builtin_cpu_init();
+        if( __builtin_cpu_supports( "avx2" ) )
+        {
+            return SIMD_Level::AVX2;
+        }
+        if( __builtin_cpu_supports( "sse4.1" ) )
+        {
+            return SIMD_Level::SSE4;
+        }
+#endif
+        return SIMD_Level::SCALAR;
+    }();
+    return s_level;
+}
+
+//------------------------------------------------------------------------------------
+// Scalar kernels.  These also finish the tail of every vector loop.
+
+void rescale_u16_to_u8_scalar( const uint16_t* src, uint8_t* dst, size_t count )
+{
+    for( size_t i = 0; i < count; ++i )
+    {
+        dst[i] = uint8_t( src[i] / (65535/255) );
+    }
+}
+
+void rescale_u8_to_f32_scalar( const uint8_t* src, float* dst, size_t count )
+{
+    const float scale = 1.0f / 255.0f;
+    for( size_t i = 0; i < count; ++i )
+    {
+        dst[i] = float( src[i] ) * scale;
+    }
+}
+
+void rescale_f32_to_u8_scalar( const float* src, uint8_t* dst, size_t count )
+{
+    for( size_t i = 0; i < count; ++i )
+    {
+        if( src[i] > 1.0f )      dst[i] = 255;
+        else if( !( src[i] >= 0.0f ) ) dst[i] = 0;
+        else                     dst[i] = uint8_t( src[i] * 255.0f );
+    }
+}
+
+void average_rgb_u8_scalar( const uint8_t* src, uint8_t* dst, size_t pixels )
+{
+    for( size_t i = 0; i < pixels; ++i )
+    {
+        dst[i] = uint8_t( ( int32_t( src[3*i] ) + src[3*i+1] + src[3*i+2] ) / 3 );
+    }
+}
+
+void average_rgba_u8_scalar( const uint8_t* src, uint8_t* dst, size_t pixels )
+{
+    for( size_t i = 0; i < pixels; ++i )
+    {
+        dst[i] = uint8_t( ( int32_t( src[4*i] ) + src[4*i+1] + src[4*i+2] ) / 3 );
+    }
+}
+
+void premultiply_rgba_u8_scalar( const uint8_t* src, uint8_t* dst, size_t pixels )
+{
+    for( size_t i = 0; i < pixels; ++i )
+    {
+        // round( c * a / 255 ), exactly
+        uint32_t alpha = src[4*i+3];
+        for( int ch = 0; ch < 3; ++ch )
+        {
+            dst[4*i+ch] = uint8_t( ( src[4*i+ch] * alpha + 127 ) / 255 );
+        }
+        dst[4*i+3] = uint8_t( alpha );
+    }
+}
+
+void unpremultiply_rgba_u8_scalar( const uint8_t* src, uint8_t* dst, size_t pixels )
+{
+    for( size_t i = 0; i < pixels; ++i )
+    {
+        // round( c * 255 / a ), exactly, saturated to 255
+        uint32_t alpha = src[4*i+3];
+        for( int ch = 0; ch < 3; ++ch )
+        {
+            uint32_t value = ( alpha == 0 ) ? 0 : ( 2 * src[4*i+ch] * 255 + alpha ) / ( 2 * alpha );
+            dst[4*i+ch] = uint8_t( std::min<uint32_t>( value, 255 ) );
+        }
+        dst[4*i+3] = uint8_t( alpha );
+    }
+}
+
+#ifdef TMNS_CONVERT_X86_SIMD
+
+//------------------------------------------------------------------------------------
+// SSE4.1 kernels
+
+__attribute__((target("sse4.1")))
+void rescale_u16_to_u8_sse4( const uint16_t* src, uint8_t* dst, size_t count )
+{
+    // v / 257 == ( v * 0xFF01 ) >> 24 for all 16-bit v
+    const __m128i mul = _mm_set1_epi16( (short)0xFF01 );
+    size_t i = 0;
+    for( ; i + 16 <= count; i += 16 )
+    {
+        __m128i a = _mm_loadu_si128( (const __m128i*)( src + i ) );
+        __m128i b = _mm_loadu_si128( (const __m128i*)( src + i + 8 ) );
+        a = _mm_srli_epi16( _mm_mulhi_epu16( a, mul ), 8 );
+        b = _mm_srli_epi16( _mm_mulhi_epu16( b, mul ), 8 );
+        _mm_storeu_si128( (__m128i*)( dst + i ), _mm_packus_epi16( a, b ) );
+    }
+    rescale_u16_to_u8_scalar( src + i, dst + i, count - i );
+}
+
+__attribute__((target("sse4.1")))
+void rescale_u8_to_f32_sse4( const uint8_t* src, float* dst, size_t count )
+{
+    const __m128 scale = _mm_set1_ps( 1.0f / 255.0f );
+    size_t i = 0;
+    for( ; i + 16 <= count; i += 16 )
+    {
+        __m128i v = _mm_loadu_si128( (const __m128i*)( src + i ) );
+        for( int k = 0; k < 4; ++k )
+        {
+            __m128i w = _mm_cvtepu8_epi32( v );
+            _mm_storeu_ps( dst + i + 4 * k, _mm_mul_ps( _mm_cvtepi32_ps( w ), scale ) );
+            v = _mm_srli_si128( v, 4 );
+        }
+    }
+    rescale_u8_to_f32_scalar( src + i, dst + i, count - i );
+}
+
+__attribute__((target("sse4.1")))
+void rescale_f32_to_u8_sse4( const float* src, uint8_t* dst, size_t count )
+{
+    const __m128 scale = _mm_set1_ps( 255.0f );
+    const __m128 zero  = _mm_setzero_ps();
+    size_t i = 0;
+    for( ; i + 16 <= count; i += 16 )
+    {
+        __m128i q[4];
+        for( int k = 0; k < 4; ++k )
+        {
+            __m128 v = _mm_mul_ps( _mm_loadu_ps( src + i + 4 * k ), scale );
+            v = _mm_min_ps( _mm_max_ps( v, zero ), scale );
+            q[k] = _mm_cvttps_epi32( v );
+        }
+        __m128i lo = _mm_packs_epi32( q[0], q[1] );
+        __m128i hi = _mm_packs_epi32( q[2], q[3] );
+        _mm_storeu_si128( (__m128i*)( dst + i ), _mm_packus_epi16( lo, hi ) );
+    }
+    rescale_f32_to_u8_scalar( src + i, dst + i, count - i );
+}
+
+/// Sum the first three bytes of each 32-bit lane, then divide by 3
+__attribute__((target("sse4.1")))
+static inline __m128i average_lanes_sse4( __m128i v )
+{
+    const __m128i byte_mask = _mm_set1_epi32( 0xFF );
+    const __m128i div3      = _mm_set1_epi32( 0xAAAB );
+    __m128i sum = _mm_add_epi32( _mm_and_si128( v, byte_mask ),
+                  _mm_add_epi32( _mm_and_si128( _mm_srli_epi32( v, 8 ), byte_mask ),
+                                 _mm_and_si128( _mm_srli_epi32( v, 16 ), byte_mask ) ) );
+    // x / 3 == ( x * 0xAAAB ) >> 17 for x <= 765
+    return _mm_srli_epi32( _mm_mullo_epi32( sum, div3 ), 17 );
+}
+
+__attribute__((target("sse4.1")))
+void average_rgba_u8_sse4( const uint8_t* src, uint8_t* dst, size_t pixels )
+{
+    size_t i = 0;
+    for( ; i + 16 <= pixels; i += 16 )
+    {
+        __m128i q[4];
+        for( int k = 0; k < 4; ++k )
+        {
+            q[k] = average_lanes_sse4( _mm_loadu_si128( (const __m128i*)( src + 4 * ( i + 4 * k ) ) ) );
+        }
+        __m128i lo = _mm_packs_epi32( q[0], q[1] );
+        __m128i hi = _mm_packs_epi32( q[2], q[3] );
+        _mm_storeu_si128( (__m128i*)( dst + i ), _mm_packus_epi16( lo, hi ) );
+    }
+    average_rgba_u8_scalar( src + 4 * i, dst + i, pixels - i );
+}
+
+__attribute__((target("sse4.1")))
+void average_rgb_u8_sse4( const uint8_t* src, uint8_t* dst, size_t pixels )
+{
+    // Expand 4 packed RGB pixels into 32-bit lanes
+    const __m128i expand = _mm_setr_epi8( 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1 );
+    size_t i = 0;
+
+    // Each 16-byte load only uses 12 bytes, so stop before reading past the row
+    for( ; i + 18 <= pixels; i += 16 )
+    {
+        __m128i q[4];
+        for( int k = 0; k < 4; ++k )
+        {
+            __m128i v = _mm_loadu_si128( (const __m128i*)( src + 3 * ( i + 4 * k ) ) );
+            q[k] = average_lanes_sse4( _mm_shuffle_epi8( v, expand ) );
+        }
+        __m128i lo = _mm_packs_epi32( q[0], q[1] );
+        __m128i hi = _mm_packs_epi32( q[2], q[3] );
+        _mm_storeu_si128( (__m128i*)( dst + i ), _mm_packus_epi16( lo, hi ) );
+    }
+    average_rgb_u8_scalar( src + 3 * i, dst + i, pixels - i );
+}
+
+/// Premultiply 2 RGBA pixels held as 16-bit lanes
+__attribute__((target("sse4.1")))
+static inline __m128i premultiply_words_sse4( __m128i w )
+{
+    const __m128i round = _mm_set1_epi16( 128 );
+    __m128i alpha = _mm_shufflehi_epi16( _mm_shufflelo_epi16( w, 0xFF ), 0xFF );
+
+    // ( x + 127 ) / 255 == ( t + ( t >> 8 ) ) >> 8, where t = x + 128
+    __m128i t = _mm_add_epi16( _mm_mullo_epi16( w, alpha ), round );
+    return _mm_srli_epi16( _mm_add_epi16( t, _mm_srli_epi16( t, 8 ) ), 8 );
+}
+
+__attribute__((target("sse4.1")))
+void premultiply_rgba_u8_sse4( const uint8_t* src, uint8_t* dst, size_t pixels )
+{
+    const __m128i alpha_mask = _mm_set1_epi32( (int)0xFF000000 );
+    size_t i = 0;
+    for( ; i + 4 <= pixels; i += 4 )
+    {
+        __m128i v  = _mm_loadu_si128( (const __m128i*)( src + 4 * i ) );
+        __m128i lo = premultiply_words_sse4( _mm_cvtepu8_epi16( v ) );
+        __m128i hi = premultiply_words_sse4( _mm_cvtepu8_epi16( _mm_srli_si128( v, 8 ) ) );
+        __m128i out = _mm_blendv_epi8( _mm_packus_epi16( lo, hi ), v, alpha_mask );
+        _mm_storeu_si128( (__m128i*)( dst + 4 * i ), out );
+    }
+    premultiply_rgba_u8_scalar( src + 4 * i, dst + 4 * i, pixels - i );
+}
+
+/// Unpremultiply 1 RGBA pixel held as a float vector
+__attribute__((target("sse4.1")))
+static inline __m128i unpremultiply_pixel_sse4( __m128i pixel )
+{
+    const __m128 c510 = _mm_set1_ps( 510.0f );
+    const __m128 c255 = _mm_set1_ps( 255.0f );
+    const __m128 zero = _mm_setzero_ps();
+
+    __m128 f     = _mm_cvtepi32_ps( pixel );
+    __m128 alpha = _mm_shuffle_ps( f, f, 0xFF );
+
+    // floor( ( 2 * 255 * c + a ) / ( 2 * a ) ).  Float division is exact enough below 256.
+    __m128 q = _mm_div_ps( _mm_add_ps( _mm_mul_ps( f, c510 ), alpha ),
+                           _mm_add_ps( alpha, alpha ) );
+    q = _mm_min_ps( q, c255 );
+    q = _mm_andnot_ps( _mm_cmpeq_ps( alpha, zero ), q );
+
+    // Keep the original alpha
+    q = _mm_blend_ps( q, f, 0x8 );
+    return _mm_cvttps_epi32( q );
+}
+
+__attribute__((target("sse4.1")))
+void unpremultiply_rgba_u8_sse4( const uint8_t* src, uint8_t* dst, size_t pixels )
+{
+    size_t i = 0;
+    for( ; i + 4 <= pixels; i += 4 )
+    {
+        __m128i v = _mm_loadu_si128( (const __m128i*)( src + 4 * i ) );
+        __m128i q[4];
+        for( int k = 0; k < 4; ++k )
+        {
+            q[k] = unpremultiply_pixel_sse4( _mm_cvtepu8_epi32( v ) );
+            v = _mm_srli_si128( v, 4 );
+        }
+        __m128i lo = _mm_packs_epi32( q[0], q[1] );
+        __m128i hi = _mm_packs_epi32( q[2], q[3] );
+        _mm_storeu_si128( (__m128i*)( dst + 4 * i ), _mm_packus_epi16( lo, hi ) );
+    }
+    unpremultiply_rgba_u8_scalar( src + 4 * i, dst + 4 * i, pixels - i );
+}
+
+//------------------------------------------------------------------------------------
+// AVX2 kernels.  Packing instructions work per 128-bit lane, hence the permutes.
+
+__attribute__((target("avx2")))
+void rescale_u16_to_u8_avx2( const uint16_t* src, uint8_t* dst, size_t count )
+{
+    const __m256i mul = _mm256_set1_epi16( (short)0xFF01 );
+    size_t i = 0;
+    for( ; i + 32 <= count; i += 32 )
+    {
+        __m256i a = _mm256_loadu_si256( (const __m256i*)( src + i ) );
+        __m256i b = _mm256_loadu_si256( (const __m256i*)( src + i + 16 ) );
+        a = _mm256_srli_epi16( _mm256_mulhi_epu16( a, mul ), 8 );
+        b = _mm256_srli_epi16( _mm256_mulhi_epu16( b, mul ), 8 );
+        __m256i out = _mm256_permute4x64_epi64( _mm256_packus_epi16( a, b ), 0xD8 );
+        _mm256_storeu_si256( (__m256i*)( dst + i ), out );
+    }
+    rescale_u16_to_u8_sse4( src + i, dst + i, count - i );
+}
+
+__attribute__((target("avx2")))
+void rescale_u8_to_f32_avx2( const uint8_t* src, float* dst, size_t count )
+{
+    const __m256 scale = _mm256_set1_ps( 1.0f / 255.0f );
+    size_t i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        __m256i w = _mm256_cvtepu8_epi32( _mm_loadl_epi64( (const __m128i*)( src + i ) ) );
+        _mm256_storeu_ps( dst + i, _mm256_mul_ps( _mm256_cvtepi32_ps( w ), scale ) );
+    }
+    rescale_u8_to_f32_scalar( src + i, dst + i, count - i );
+}
+
+__attribute__((target("avx2")))
+void rescale_f32_to_u8_avx2( const float* src, uint8_t* dst, size_t count )
+{
+    const __m256  scale = _mm256_set1_ps( 255.0f );
+    const __m256  zero  = _mm256_setzero_ps();
+    const __m256i order = _mm256_setr_epi32( 0, 4, 1, 5, 2, 6, 3, 7 );
+    size_t i = 0;
+    for( ; i + 32 <= count; i += 32 )
+    {
+        __m256i q[4];
+        for( int k = 0; k < 4; ++k )
+        {
+            __m256 v = _mm256_mul_ps( _mm256_loadu_ps( src + i + 8 * k ), scale );
+            v = _mm256_min_ps( _mm256_max_ps( v, zero ), scale );
+            q[k] = _mm256_cvttps_epi32( v );
+        }
+        __m256i packed = _mm256_packus_epi16( _mm256_packs_epi32( q[0], q[1] ),
+                                              _mm256_packs_epi32( q[2], q[3] ) );
+        _mm256_storeu_si256( (__m256i*)( dst + i ), _mm256_permutevar8x32_epi32( packed, order ) );
+    }
+    rescale_f32_to_u8_sse4( src + i, dst + i, count - i );
+}
+
+/// Sum the first three bytes of each 32-bit lane, then divide by 3
+__attribute__((target("avx2")))
+static inline __m256i average_lanes_avx2( __m256i v )
+{
+    const __m256i byte_mask = _mm256_set1_epi32( 0xFF );
+    const __m256i div3      = _mm256_set1_epi32( 0xAAAB );
+    __m256i sum = _mm256_add_epi32( _mm256_and_si256( v, byte_mask ),
+                  _mm256_add_epi32( _mm256_and_si256( _mm256_srli_epi32( v, 8 ), byte_mask ),
+                                    _mm256_and_si256( _mm256_srli_epi32( v, 16 ), byte_mask ) ) );
+    return _mm256_srli_epi32( _mm256_mullo_epi32( sum, div3 ), 17 );
+}
+
+__attribute__((target("avx2")))
+void average_rgba_u8_avx2( const uint8_t* src, uint8_t* dst, size_t pixels )
+{
+    const __m256i order = _mm256_setr_epi32( 0, 4, 1, 5, 2, 6, 3, 7 );
+    size_t i = 0;
+    for( ; i + 32 <= pixels; i += 32 )
+    {
+        __m256i q[4];
+        for( int k = 0; k < 4; ++k )
+        {
+            q[k] = average_lanes_avx2( _mm256_loadu_si256( (const __m256i*)( src + 4 * ( i + 8 * k ) ) ) );
+        }
+        __m256i packed = _mm256_packus_epi16( _mm256_packs_epi32( q[0], q[1] ),
+                                              _mm256_packs_epi32( q[2], q[3] ) );
+        _mm256_storeu_si256( (__m256i*)( dst + i ), _mm256_permutevar8x32_epi32( packed, order ) );
+    }
+    average_rgba_u8_sse4( src + 4 * i, dst + i, pixels - i );
+}
+
+__attribute__((target("avx2")))
+void average_rgb_u8_avx2( const uint8_t* src, uint8_t* dst, size_t pixels )
+{
+    const __m256i expand = _mm256_setr_epi8( 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+                                             0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1 );
+    const __m256i order  = _mm256_setr_epi32( 0, 4, 1, 5, 2, 6, 3, 7 );
+    size_t i = 0;
+
+    // Each 16-byte half only uses 12 bytes, so stop before reading past the row
+    for( ; i + 34 <= pixels; i += 32 )
+    {
+        __m256i q[4];
+        for( int k = 0; k < 4; ++k )
+        {
+            const uint8_t* ptr = src + 3 * ( i + 8 * k );
+            __m256i v = _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( (const __m128i*)( ptr ) ) ),
+                                                 _mm_loadu_si128( (const __m128i*)( ptr + 12 ) ),
+                                                 1 );
+            q[k] = average_lanes_avx2( _mm256_shuffle_epi8( v, expand ) );
+        }
+        __m256i packed = _mm256_packus_epi16( _mm256_packs_epi32( q[0], q[1] ),
+                                              _mm256_packs_epi32( q[2], q[3] ) );
+        _mm256_storeu_si256( (__m256i*)( dst + i ), _mm256_permutevar8x32_epi32( packed, order ) );
+    }
+    average_rgb_u8_sse4( src + 3 * i, dst + i, pixels - i );
+}
+
+/// Premultiply 4 RGBA pixels held as 16-bit lanes
+__attribute__((target("avx2")))
+static inline __m256i premultiply_words_avx2( __m256i w )
+{
+    const __m256i round = _mm256_set1_epi16( 128 );
+    __m256i alpha = _mm256_shufflehi_epi16( _mm256_shufflelo_epi16( w, 0xFF ), 0xFF );
+    __m256i t = _mm256_add_epi16( _mm256_mullo_epi16( w, alpha ), round );
+    return _mm256_srli_epi16( _mm256_add_epi16( t, _mm256_srli_epi16( t, 8 ) ), 8 );
+}
+
+__attribute__((target("avx2")))
+void premultiply_rgba_u8_avx2( const uint8_t* src, uint8_t* dst, size_t pixels )
+{
+    const __m256i alpha_mask = _mm256_set1_epi32( (int)0xFF000000 );
+    size_t i = 0;
+    for( ; i + 8 <= pixels; i += 8 )
+    {
+        __m256i v  = _mm256_loadu_si256( (const __m256i*)( src + 4 * i ) );
+        __m256i lo = premultiply_words_avx2( _mm256_cvtepu8_epi16( _mm256_castsi256_si128( v ) ) );
+        __m256i hi = premultiply_words_avx2( _mm256_cvtepu8_epi16( _mm256_extracti128_si256( v, 1 ) ) );
+        __m256i packed = _mm256_permute4x64_epi64( _mm256_packus_epi16( lo, hi ), 0xD8 );
+        _mm256_storeu_si256( (__m256i*)( dst + 4 * i ), _mm256_blendv_epi8( packed, v, alpha_mask ) );
+    }
+    premultiply_rgba_u8_sse4( src + 4 * i, dst + 4 * i, pixels - i );
+}
+
+#endif // TMNS_CONVERT_X86_SIMD
+
+//------------------------------------------------------------------------------------
+// Dispatch
+
+/********************************************/
+/*          uint16 -> uint8 Rescale         */
+/********************************************/
+void rescale_u16_to_u8( const uint16_t* src, uint8_t* dst, size_t count, SIMD_Level level )
+{
+#ifdef TMNS_CONVERT_X86_SIMD
+    if( level == SIMD_Level::AVX2 ) { rescale_u16_to_u8_avx2( src, dst, count ); return; }
+    if( level == SIMD_Level::SSE4 ) { rescale_u16_to_u8_sse4( src, dst, count ); return; }
+#endif
+    rescale_u16_to_u8_scalar( src, dst, count );
+}
+
+/********************************************/
+/*          uint8 -> float32 Rescale        */
+/********************************************/
+void rescale_u8_to_f32( const uint8_t* src, float* dst, size_t count, SIMD_Level level )
+{
+#ifdef TMNS_CONVERT_X86_SIMD
+    if( level == SIMD_Level::AVX2 ) { rescale_u8_to_f32_avx2( src, dst, count ); return; }
+    if( level == SIMD_Level::SSE4 ) { rescale_u8_to_f32_sse4( src, dst, count ); return; }
+#endif
+    rescale_u8_to_f32_scalar( src, dst, count );
+}
+
+/********************************************/
+/*          float32 -> uint8 Rescale        */
+/********************************************/
+void rescale_f32_to_u8( const float* src, uint8_t* dst, size_t count, SIMD_Level level )
+{
+#ifdef TMNS_CONVERT_X86_SIMD
+    if( level == SIMD_Level::AVX2 ) { rescale_f32_to_u8_avx2( src, dst, count ); return; }
+    if( level == SIMD_Level::SSE4 ) { rescale_f32_to_u8_sse4( src, dst, count ); return; }
+#endif
+    rescale_f32_to_u8_scalar( src, dst, count );
+}
+
+/********************************************/
+/*          RGB -> Gray Average             */
+/********************************************/
+void average_rgb_u8( const uint8_t* src, uint8_t* dst, size_t pixels, SIMD_Level level )
+{
+#ifdef TMNS_CONVERT_X86_SIMD
+    if( level == SIMD_Level::AVX2 ) { average_rgb_u8_avx2( src, dst, pixels ); return; }
+    if( level == SIMD_Level::SSE4 ) { average_rgb_u8_sse4( src, dst, pixels ); return; }
+#endif
+    average_rgb_u8_scalar( src, dst, pixels );
+}
+
+/********************************************/
+/*          RGBA -> Gray Average            */
+/********************************************/
+void average_rgba_u8( const uint8_t* src, uint8_t* dst, size_t pixels, SIMD_Level level )
+{
+#ifdef TMNS_CONVERT_X86_SIMD
+    if( level == SIMD_Level::AVX2 ) { average_rgba_u8_avx2( src, dst, pixels ); return; }
+    if( level == SIMD_Level::SSE4 ) { average_rgba_u8_sse4( src, dst, pixels ); return; }
+#endif
+    average_rgba_u8_scalar( src, dst, pixels );
+}
+
+/********************************************/
+/*          RGBA Premultiply                */
+/********************************************/
+void premultiply_rgba_u8( const uint8_t* src, uint8_t* dst, size_t pixels, SIMD_Level level )
+{
+#ifdef TMNS_CONVERT_X86_SIMD
+    if( level == SIMD_Level::AVX2 ) { premultiply_rgba_u8_avx2( src, dst, pixels ); return; }
+    if( level == SIMD_Level::SSE4 ) { premultiply_rgba_u8_sse4( src, dst, pixels ); return; }
+#endif
+    premultiply_rgba_u8_scalar( src, dst, pixels );
+}
+
+/********************************************/
+/*          RGBA Unpremultiply              */
+/********************************************/
+void unpremultiply_rgba_u8( const uint8_t* src, uint8_t* dst, size_t pixels, SIMD_Level level )
+{
+#ifdef TMNS_CONVERT_X86_SIMD
+    // Division-bound, so AVX2 gains nothing over SSE4 here
+    if( level != SIMD_Level::SCALAR ) { unpremultiply_rgba_u8_sse4( src, dst, pixels ); return; }
+#endif
+    unpremultiply_rgba_u8_scalar( src, dst, pixels );
+}
+
+//------------------------------------------------------------------------------------
+// Row adapters for convert()
+
+template <int ChannelsV>
+void row_rescale_u16_to_u8( const uint8_t* src, uint8_t* dst, size_t cols )
+{
+    rescale_u16_to_u8( reinterpret_cast<const uint16_t*>( src ), dst, cols * ChannelsV );
+}
+
+template <int ChannelsV>
+void row_rescale_u8_to_f32( const uint8_t* src, uint8_t* dst, size_t cols )
+{
+    rescale_u8_to_f32( src, reinterpret_cast<float*>( dst ), cols * ChannelsV );
+}
+
+template <int ChannelsV>
+void row_rescale_f32_to_u8( const uint8_t* src, uint8_t* dst, size_t cols )
+{
+    rescale_f32_to_u8( reinterpret_cast<const float*>( src ), dst, cols * ChannelsV );
+}
+
+void row_average_rgb_u8( const uint8_t* src, uint8_t* dst, size_t cols )
+{
+    average_rgb_u8( src, dst, cols );
+}
+
+void row_average_rgba_u8( const uint8_t* src, uint8_t* dst, size_t cols )
+{
+    average_rgba_u8( src, dst, cols );
+}
+
+void row_premultiply_rgba_u8( const uint8_t* src, uint8_t* dst, size_t cols )
+{
+    premultiply_rgba_u8( src, dst, cols );
+}
+
+void row_unpremultiply_rgba_u8( const uint8_t* src, uint8_t* dst, size_t cols )
+{
+    unpremultiply_rgba_u8( src, dst, cols );
+}
+
+/****************************************************/
+/*          Select a SIMD row kernel                */
+/****************************************************/
+packed_row_func select_simd_row_kernel( Channel_Type_Enum src_type,
+                                        Channel_Type_Enum dst_type,
+                                        bool              rescale,
+                                        size_t            src_channels,
+                                        size_t            dst_channels,
+                                        bool              unpremultiply_src,
+                                        bool              premultiply_src,
+                                        bool              premultiply_dst )
+{
+    bool u8_to_u8 = src_type == Channel_Type_Enum::UINT8 && dst_type == Channel_Type_Enum::UINT8;
+
+    // Alpha handling.  Selected at every level, including scalar, so the rounding never
+    // depends on the CPU.
+    if( unpremultiply_src || premultiply_src || premultiply_dst )
+    {
+        if( u8_to_u8 && src_channels == 4 && dst_channels == 4 && !premultiply_src )
+        {
+            return premultiply_dst ? &row_premultiply_rgba_u8 : &row_unpremultiply_rgba_u8;
+        }
+        return nullptr;
+    }
+
+    if( simd_level() == SIMD_Level::SCALAR )
+    {
+        // The templated row kernels are just as good without vector units
+        return nullptr;
+    }
+
+    // Color to gray
+    if( u8_to_u8 && dst_channels == 1 )
+    {
+        if( src_channels == 3 ) return &row_average_rgb_u8;
+        if( src_channels == 4 ) return &row_average_rgba_u8;
+    }
+
+    // Per-channel rescales
+    if( !rescale || src_channels != dst_channels )
+    {
+        return nullptr;
+    }
+
+    if( src_type == Channel_Type_Enum::UINT16 && dst_type == Channel_Type_Enum::UINT8 )
+    {
+        switch( src_channels )
+        {
+            case 1: return &row_rescale_u16_to_u8<1>;
+            case 2: return &row_rescale_u16_to_u8<2>;
+            case 3: return &row_rescale_u16_to_u8<3>;
+            case 4: return &row_rescale_u16_to_u8<4>;
+        }
+    }
+    else if( src_type == Channel_Type_Enum::UINT8 && dst_type == Channel_Type_Enum::FLOAT32 )
+    {
+        switch( src_channels )
+        {
+            case 1: return &row_rescale_u8_to_f32<1>;
+            case 2: return &row_rescale_u8_to_f32<2>;
+            case 3: return &row_rescale_u8_to_f32<3>;
+            case 4: return &row_rescale_u8_to_f32<4>;
+        }
+    }
+    else if( src_type == Channel_Type_Enum::FLOAT32 && dst_type == Channel_Type_Enum::UINT8 )
+    {
+        switch( src_channels )
+        {
+            case 1: return &row_rescale_f32_to_u8<1>;
+            case 2: return &row_rescale_f32_to_u8<2>;
+            case 3: return &row_rescale_f32_to_u8<3>;
+            case 4: return &row_rescale_f32_to_u8<4>;
+        }
+    }
+    return nullptr;
+}
+
+} // End of tmns::image::detail namespace
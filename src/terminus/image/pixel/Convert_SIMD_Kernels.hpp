@@ -0,0 +1,94 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Convert_SIMD_Kernels.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Terminus Libraries
+#include <terminus/image/pixel/Channel_Type_Enum.hpp>
+
+namespace tmns::image::detail {
+
+/**
+ * Instruction set used by the SIMD conversion kernels
+ */
+enum class SIMD_Level
+{
+    SCALAR = 0,
+    SSE4   = 1,
+    AVX2   = 2,
+}; // End of SIMD_Level enum
+
+/**
+ * Convert the SIMD level to a string
+ */
+std::string enum_to_string( SIMD_Level level );
+
+/**
+ * Best instruction set supported by this CPU.  Detected once.
+ */
+SIMD_Level simd_level();
+
+/**
+ * Every kernel produces identical output at every SIMD level.  The level only exists
+ * as a parameter so tests can compare against the scalar version.
+ */
+
+/// uint16 -> uint8, rescaled (v / 257)
+void rescale_u16_to_u8( const uint16_t* src, uint8_t* dst, size_t count, SIMD_Level level = simd_level() );
+
+/// uint8 -> float32, rescaled to [0,1]
+void rescale_u8_to_f32( const uint8_t* src, float* dst, size_t count, SIMD_Level level = simd_level() );
+
+/// float32 -> uint8, clamped from [0,1].  NaN maps to 0.
+void rescale_f32_to_u8( const float* src, uint8_t* dst, size_t count, SIMD_Level level = simd_level() );
+
+/// Packed RGB uint8 -> GRAY uint8 by channel average
+void average_rgb_u8( const uint8_t* src, uint8_t* dst, size_t pixels, SIMD_Level level = simd_level() );
+
+/// Packed RGBA uint8 -> GRAY uint8 by channel average, ignoring alpha
+void average_rgba_u8( const uint8_t* src, uint8_t* dst, size_t pixels, SIMD_Level level = simd_level() );
+
+/// Packed RGBA uint8 premultiply by alpha, rounded to nearest
+void premultiply_rgba_u8( const uint8_t* src, uint8_t* dst, size_t pixels, SIMD_Level level = simd_level() );
+
+/**
+ * Packed RGBA uint8 unpremultiply by alpha, rounded to nearest and saturated.
+ * Fully transparent pixels come out black.
+ */
+void unpremultiply_rgba_u8( const uint8_t* src, uint8_t* dst, size_t pixels, SIMD_Level level = simd_level() );
+
+/// Row function for packed rows
+typedef void (*packed_row_func)( const uint8_t* src,
+                                 uint8_t*       dst,
+                                 size_t         cols );
+
+/**
+ * Select a SIMD row kernel for the conversion, or nullptr if the combination has none.
+ * The returned function requires both rows to be packed (no padding between pixels).
+ */
+packed_row_func select_simd_row_kernel( Channel_Type_Enum src_type,
+                                        Channel_Type_Enum dst_type,
+                                        bool              rescale,
+                                        size_t            src_channels,
+                                        size_t            dst_channels,
+                                        bool              unpremultiply_src,
+                                        bool              premultiply_src,
+                                        bool              premultiply_dst );
+
+} // End of tmns::image::detail namespace
@@ -0,0 +1,100 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Float16.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "Float16.hpp"
+
+#if ( defined(__x86_64__) || defined(__i386__) ) && defined(__GNUC__)
+#define TMNS_FLOAT16_F16C 1
+#include <immintrin.h>
+#endif
+
+namespace tmns::image {
+
+#ifdef TMNS_FLOAT16_F16C
+
+/**
+ * Check once if the CPU has the half-precision conversion instructions
+*/
+static bool has_f16c()
+{
+    static const bool s_has_f16c = [](){
+        __builtin_cpu_init();
+        return __builtin_cpu_supports( "f16c" ) && __builtin_cpu_supports( "avx" );
+    }();
+    return s_has_f16c;
+}
+
+__attribute__((target("avx,f16c")))
+static size_t convert_float16_to_float32_f16c( const Float16* src, float* dst, size_t count )
+{
+    size_t i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        __m128i half = _mm_loadu_si128( (const __m128i*)( src + i ) );
+        _mm256_storeu_ps( dst + i, _mm256_cvtph_ps( half ) );
+    }
+    return i;
+}
+
+__attribute__((target("avx,f16c")))
+static size_t convert_float32_to_float16_f16c( const float* src, Float16* dst, size_t count )
+{
+    size_t i = 0;
+    for( ; i + 8 <= count; i += 8 )
+    {
+        __m128i half = _mm256_cvtps_ph( _mm256_loadu_ps( src + i ), _MM_FROUND_TO_NEAREST_INT );
+        _mm_storeu_si128( (__m128i*)( dst + i ), half );
+    }
+    return i;
+}
+
+#endif // TMNS_FLOAT16_F16C
+
+/****************************************************/
+/*          Convert a Row of Half to Float          */
+/****************************************************/
+void convert_float16_to_float32( const Float16* src, float* dst, size_t count )
+{
+    size_t i = 0;
+#ifdef TMNS_FLOAT16_F16C
+    if( has_f16c() )
+    {
+        i = convert_float16_to_float32_f16c( src, dst, count );
+    }
+#endif
+    for( ; i < count; ++i )
+    {
+        dst[i] = half_bits_to_float( src[i].bits() );
+    }
+}
+
+/****************************************************/
+/*          Convert a Row of Float to Half          */
+/****************************************************/
+void convert_float32_to_float16( const float* src, Float16* dst, size_t count )
+{
+    size_t i = 0;
+#ifdef TMNS_FLOAT16_F16C
+    if( has_f16c() )
+    {
+        i = convert_float32_to_float16_f16c( src, dst, count );
+    }
+#endif
+    for( ; i < count; ++i )
+    {
+        dst[i] = Float16::from_bits( float_to_half_bits( src[i] ) );
+    }
+}
+
+} // End of tmns::image namespace
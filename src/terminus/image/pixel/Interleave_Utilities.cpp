@@ -0,0 +1,245 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Interleave_Utilities.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "Interleave_Utilities.hpp"
+
+// C++ Libraries
+#include <algorithm>
+
+namespace tmns::image {
+
+/// Pixels per tile for the generic channel count.  256 pixels of 8 channels x 8 bytes is 16 KB.
+static constexpr size_t TILE_COLS = 256;
+
+/**
+ * Interleave one row.  With a compile-time channel count the inner loop is a fixed
+ * gather the compiler turns into shuffles.  Otherwise the row is done in tiles, copying
+ * one channel at a time, so the tile of output stays in L1 while every plane streams.
+*/
+template <typename ValueT, size_t N>
+void planar_to_interleaved_row( const uint8_t* src,
+                                ssize_t        src_pstride,
+                                ValueT*        dst,
+                                size_t         cols,
+                                size_t         channels )
+{
+    if constexpr( N > 0 )
+    {
+        const ValueT* planes[N];
+        for( size_t ch = 0; ch < N; ++ch )
+        {
+            planes[ch] = (const ValueT*)( src + ssize_t( ch ) * src_pstride );
+        }
+        for( size_t c = 0; c < cols; ++c )
+        {
+            for( size_t ch = 0; ch < N; ++ch )
+            {
+                dst[c * N + ch] = planes[ch][c];
+            }
+        }
+    }
+    else
+    {
+        for( size_t start = 0; start < cols; start += TILE_COLS )
+        {
+            size_t end = std::min( start + TILE_COLS, cols );
+            for( size_t ch = 0; ch < channels; ++ch )
+            {
+                const ValueT* plane = (const ValueT*)( src + ssize_t( ch ) * src_pstride );
+                for( size_t c = start; c < end; ++c )
+                {
+                    dst[c * channels + ch] = plane[c];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Deinterleave one row
+*/
+template <typename ValueT, size_t N>
+void interleaved_to_planar_row( const ValueT* src,
+                                uint8_t*      dst,
+                                ssize_t       dst_pstride,
+                                size_t        cols,
+                                size_t        channels )
+{
+    if constexpr( N > 0 )
+    {
+        ValueT* planes[N];
+        for( size_t ch = 0; ch < N; ++ch )
+        {
+            planes[ch] = (ValueT*)( dst + ssize_t( ch ) * dst_pstride );
+        }
+        for( size_t c = 0; c < cols; ++c )
+        {
+            for( size_t ch = 0; ch < N; ++ch )
+            {
+                planes[ch][c] = src[c * N + ch];
+            }
+        }
+    }
+    else
+    {
+        for( size_t start = 0; start < cols; start += TILE_COLS )
+        {
+            size_t end = std::min( start + TILE_COLS, cols );
+            for( size_t ch = 0; ch < channels; ++ch )
+            {
+                ValueT* plane = (ValueT*)( dst + ssize_t( ch ) * dst_pstride );
+                for( size_t c = start; c < end; ++c )
+                {
+                    plane[c] = src[c * channels + ch];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Rows are independent; each one streams through its planes and the interleaved row
+*/
+template <typename ValueT, size_t N>
+void planar_to_interleaved_impl( const uint8_t* src,
+                                 ssize_t        src_pstride,
+                                 ssize_t        src_rstride,
+                                 uint8_t*       dst,
+                                 ssize_t        dst_rstride,
+                                 size_t         cols,
+                                 size_t         rows,
+                                 size_t         channels )
+{
+    for( size_t r = 0; r < rows; ++r )
+    {
+        planar_to_interleaved_row<ValueT,N>( src + ssize_t( r ) * src_rstride,
+                                             src_pstride,
+                                             (ValueT*)( dst + ssize_t( r ) * dst_rstride ),
+                                             cols,
+                                             channels );
+    }
+}
+
+template <typename ValueT, size_t N>
+void interleaved_to_planar_impl( const uint8_t* src,
+                                 ssize_t        src_rstride,
+                                 uint8_t*       dst,
+                                 ssize_t        dst_pstride,
+                                 ssize_t        dst_rstride,
+                                 size_t         cols,
+                                 size_t         rows,
+                                 size_t         channels )
+{
+    for( size_t r = 0; r < rows; ++r )
+    {
+        interleaved_to_planar_row<ValueT,N>( (const ValueT*)( src + ssize_t( r ) * src_rstride ),
+                                             dst + ssize_t( r ) * dst_rstride,
+                                             dst_pstride,
+                                             cols,
+                                             channels );
+    }
+}
+
+/**
+ * Pick the channel-count specialization
+*/
+template <typename ValueT, typename... ArgsT>
+void dispatch_planar_to_interleaved( size_t channels, ArgsT... args )
+{
+    switch( channels )
+    {
+        case 2:  planar_to_interleaved_impl<ValueT,2>( args..., channels ); break;
+        case 3:  planar_to_interleaved_impl<ValueT,3>( args..., channels ); break;
+        case 4:  planar_to_interleaved_impl<ValueT,4>( args..., channels ); break;
+        default: planar_to_interleaved_impl<ValueT,0>( args..., channels ); break;
+    }
+}
+
+template <typename ValueT, typename... ArgsT>
+void dispatch_interleaved_to_planar( size_t channels, ArgsT... args )
+{
+    switch( channels )
+    {
+        case 2:  interleaved_to_planar_impl<ValueT,2>( args..., channels ); break;
+        case 3:  interleaved_to_planar_impl<ValueT,3>( args..., channels ); break;
+        case 4:  interleaved_to_planar_impl<ValueT,4>( args..., channels ); break;
+        default: interleaved_to_planar_impl<ValueT,0>( args..., channels ); break;
+    }
+}
+
+/****************************************************/
+/*          Interleave Separate Planes              */
+/****************************************************/
+bool planar_to_interleaved( const uint8_t* src,
+                            ssize_t        src_pstride,
+                            ssize_t        src_rstride,
+                            uint8_t*       dst,
+                            ssize_t        dst_rstride,
+                            size_t         cols,
+                            size_t         rows,
+                            size_t         channels,
+                            size_t         channel_bytes )
+{
+    switch( channel_bytes )
+    {
+        case 1:
+            dispatch_planar_to_interleaved<uint8_t>( channels, src, src_pstride, src_rstride, dst, dst_rstride, cols, rows );
+            return true;
+        case 2:
+            dispatch_planar_to_interleaved<uint16_t>( channels, src, src_pstride, src_rstride, dst, dst_rstride, cols, rows );
+            return true;
+        case 4:
+            dispatch_planar_to_interleaved<uint32_t>( channels, src, src_pstride, src_rstride, dst, dst_rstride, cols, rows );
+            return true;
+        case 8:
+            dispatch_planar_to_interleaved<uint64_t>( channels, src, src_pstride, src_rstride, dst, dst_rstride, cols, rows );
+            return true;
+        default:
+            return false;
+    }
+}
+
+/****************************************************/
+/*          Split Pixels into Separate Planes       */
+/****************************************************/
+bool interleaved_to_planar( const uint8_t* src,
+                            ssize_t        src_rstride,
+                            uint8_t*       dst,
+                            ssize_t        dst_pstride,
+                            ssize_t        dst_rstride,
+                            size_t         cols,
+                            size_t         rows,
+                            size_t         channels,
+                            size_t         channel_bytes )
+{
+    switch( channel_bytes )
+    {
+        case 1:
+            dispatch_interleaved_to_planar<uint8_t>( channels, src, src_rstride, dst, dst_pstride, dst_rstride, cols, rows );
+            return true;
+        case 2:
+            dispatch_interleaved_to_planar<uint16_t>( channels, src, src_rstride, dst, dst_pstride, dst_rstride, cols, rows );
+            return true;
+        case 4:
+            dispatch_interleaved_to_planar<uint32_t>( channels, src, src_rstride, dst, dst_pstride, dst_rstride, cols, rows );
+            return true;
+        case 8:
+            dispatch_interleaved_to_planar<uint64_t>( channels, src, src_rstride, dst, dst_pstride, dst_rstride, cols, rows );
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // End of tmns::image namespace
@@ -0,0 +1,241 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Packed_Channel_Utilities.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "Packed_Channel_Utilities.hpp"
+
+// Terminus Libraries
+#include "Convert_SIMD_Kernels.hpp"
+
+// C++ Libraries
+#include <algorithm>
+
+#if ( defined(__x86_64__) || defined(__i386__) ) && defined(__GNUC__)
+#define TMNS_PACKED_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace tmns::image {
+
+//------------------------------------------------------------------------------------
+// Generic bit-stream kernels.  These finish the tail of every grouped loop, which always
+// ends on a byte boundary.
+
+static bool pack_bits_scalar( const uint16_t* src, uint8_t* dst, size_t count, uint32_t bits )
+{
+    const uint32_t max_value = ( 1u << bits ) - 1;
+    bool     fits  = true;
+    uint32_t acc   = 0;
+    uint32_t nbits = 0;
+    for( size_t i = 0; i < count; ++i )
+    {
+        uint32_t value = src[i];
+        if( value > max_value )
+        {
+            value = max_value;
+            fits  = false;
+        }
+        acc   |= value << nbits;
+        nbits += bits;
+        while( nbits >= 8 )
+        {
+            *dst++ = uint8_t( acc );
+            acc  >>= 8;
+            nbits -= 8;
+        }
+    }
+    if( nbits > 0 )
+    {
+        *dst = uint8_t( acc );
+    }
+    return fits;
+}
+
+static void unpack_bits_scalar( const uint8_t* src, uint16_t* dst, size_t count, uint32_t bits )
+{
+    const uint32_t mask = ( 1u << bits ) - 1;
+    uint32_t acc   = 0;
+    uint32_t nbits = 0;
+    for( size_t i = 0; i < count; ++i )
+    {
+        while( nbits < bits )
+        {
+            acc   |= uint32_t( *src++ ) << nbits;
+            nbits += 8;
+        }
+        dst[i]  = uint16_t( acc & mask );
+        acc   >>= bits;
+        nbits  -= bits;
+    }
+}
+
+#ifdef TMNS_PACKED_X86_SIMD
+
+/**
+ * Unpack 8 values (12 bytes) at a time.  Each 16-bit lane gathers the two bytes its value
+ * straddles, then even lanes keep the low 12 bits and odd lanes drop the low 4.
+ * Needs 4 readable bytes past each group, which the caller guarantees.
+*/
+__attribute__((target("sse4.1")))
+static size_t unpack_uint12_sse4( const uint8_t* src, uint16_t* dst, size_t count, size_t total_bytes )
+{
+    const __m128i gather = _mm_setr_epi8( 0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11 );
+    const __m128i mask   = _mm_set1_epi16( 0x0FFF );
+    size_t i = 0;
+    for( ; i + 8 <= count && ( i / 2 ) * 3 + 16 <= total_bytes; i += 8 )
+    {
+        __m128i v    = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i*)( src + ( i / 2 ) * 3 ) ), gather );
+        __m128i even = _mm_and_si128( v, mask );
+        __m128i odd  = _mm_srli_epi16( v, 4 );
+        _mm_storeu_si128( (__m128i*)( dst + i ), _mm_blend_epi16( even, odd, 0xAA ) );
+    }
+    return i;
+}
+
+#endif // TMNS_PACKED_X86_SIMD
+
+/********************************/
+/*          Pack 12-bit         */
+/********************************/
+bool pack_uint12( const uint16_t* src, uint8_t* dst, size_t count )
+{
+    // Pairs of values fill exactly 3 bytes
+    uint16_t overflow = 0;
+    size_t i = 0;
+    for( ; i + 2 <= count; i += 2 )
+    {
+        overflow |= uint16_t( src[i] | src[i+1] );
+        uint32_t a = std::min<uint32_t>( src[i],   0x0FFF );
+        uint32_t b = std::min<uint32_t>( src[i+1], 0x0FFF );
+        dst[0] = uint8_t( a );
+        dst[1] = uint8_t( ( a >> 8 ) | ( b << 4 ) );
+        dst[2] = uint8_t( b >> 4 );
+        dst += 3;
+    }
+    bool tail_fits = pack_bits_scalar( src + i, dst, count - i, 12 );
+    return tail_fits && ( overflow & 0xF000 ) == 0;
+}
+
+/********************************/
+/*          Unpack 12-bit       */
+/********************************/
+void unpack_uint12( const uint8_t* src, uint16_t* dst, size_t count )
+{
+    size_t i = 0;
+#ifdef TMNS_PACKED_X86_SIMD
+    if( detail::simd_level() != detail::SIMD_Level::SCALAR )
+    {
+        i = unpack_uint12_sse4( src, dst, count, packed_size_bytes( 12, count ) );
+    }
+#endif
+    for( ; i + 2 <= count; i += 2 )
+    {
+        const uint8_t* ptr = src + ( i / 2 ) * 3;
+        dst[i]   = uint16_t( ptr[0] | ( ( ptr[1] & 0x0F ) << 8 ) );
+        dst[i+1] = uint16_t( ( ptr[1] >> 4 ) | ( ptr[2] << 4 ) );
+    }
+    unpack_bits_scalar( src + ( i / 2 ) * 3, dst + i, count - i, 12 );
+}
+
+/********************************/
+/*          Pack 14-bit         */
+/********************************/
+bool pack_uint14( const uint16_t* src, uint8_t* dst, size_t count )
+{
+    // Groups of 4 values fill exactly 7 bytes
+    uint16_t overflow = 0;
+    size_t i = 0;
+    for( ; i + 4 <= count; i += 4 )
+    {
+        overflow |= uint16_t( src[i] | src[i+1] | src[i+2] | src[i+3] );
+        uint64_t word = uint64_t( std::min<uint16_t>( src[i],   0x3FFF ) )        |
+                        uint64_t( std::min<uint16_t>( src[i+1], 0x3FFF ) ) << 14  |
+                        uint64_t( std::min<uint16_t>( src[i+2], 0x3FFF ) ) << 28  |
+                        uint64_t( std::min<uint16_t>( src[i+3], 0x3FFF ) ) << 42;
+        for( int b = 0; b < 7; ++b )
+        {
+            dst[b] = uint8_t( word >> ( 8 * b ) );
+        }
+        dst += 7;
+    }
+    bool tail_fits = pack_bits_scalar( src + i, dst, count - i, 14 );
+    return tail_fits && ( overflow & 0xC000 ) == 0;
+}
+
+/********************************/
+/*          Unpack 14-bit       */
+/********************************/
+void unpack_uint14( const uint8_t* src, uint16_t* dst, size_t count )
+{
+    size_t i = 0;
+    for( ; i + 4 <= count; i += 4 )
+    {
+        const uint8_t* ptr = src + ( i / 4 ) * 7;
+        uint64_t word = 0;
+        for( int b = 0; b < 7; ++b )
+        {
+            word |= uint64_t( ptr[b] ) << ( 8 * b );
+        }
+        dst[i]   = uint16_t( word         & 0x3FFF );
+        dst[i+1] = uint16_t( word >> 14   & 0x3FFF );
+        dst[i+2] = uint16_t( word >> 28   & 0x3FFF );
+        dst[i+3] = uint16_t( word >> 42   & 0x3FFF );
+    }
+    unpack_bits_scalar( src + ( i / 4 ) * 7, dst + i, count - i, 14 );
+}
+
+/********************************************/
+/*          Pack by Channel Type            */
+/********************************************/
+Result<bool> pack_channels( Channel_Type_Enum channel_type,
+                            const uint16_t*   src,
+                            uint8_t*          dst,
+                            size_t            count )
+{
+    switch( channel_type )
+    {
+        case Channel_Type_Enum::UINT12:
+            return outcome::ok<bool>( pack_uint12( src, dst, count ) );
+        case Channel_Type_Enum::UINT14:
+            return outcome::ok<bool>( pack_uint14( src, dst, count ) );
+        default:
+            return outcome::fail( core::error::ErrorCode::INVALID_CHANNEL_TYPE,
+                                  "Channel type cannot be packed: ",
+                                  enum_to_string( channel_type ) );
+    }
+}
+
+/********************************************/
+/*          Unpack by Channel Type          */
+/********************************************/
+Result<void> unpack_channels( Channel_Type_Enum channel_type,
+                              const uint8_t*    src,
+                              uint16_t*         dst,
+                              size_t            count )
+{
+    switch( channel_type )
+    {
+        case Channel_Type_Enum::UINT12:
+            unpack_uint12( src, dst, count );
+            return outcome::ok();
+        case Channel_Type_Enum::UINT14:
+            unpack_uint14( src, dst, count );
+            return outcome::ok();
+        default:
+            return outcome::fail( core::error::ErrorCode::INVALID_CHANNEL_TYPE,
+                                  "Channel type cannot be unpacked: ",
+                                  enum_to_string( channel_type ) );
+    }
+}
+
+} // End of tmns::image namespace
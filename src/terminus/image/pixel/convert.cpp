@@ -6,17 +6,31 @@
 #include "convert.hpp"
 
 // C++ Libraries
+#include <cstring>
+#include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 // Boost Libraries
 #include <boost/integer_traits.hpp>
 
 // Terminus Libraries
 #include "Channel_Conversion_Utilities.hpp"
+#include "Channel_Lookup_Table.hpp"
 #include "Channel_Type_ID.hpp"
+#include "Convert_Row_Kernels.hpp"
+#include "Convert_SIMD_Kernels.hpp"
+#include "Float16.hpp"
+#include "Interleave_Utilities.hpp"
+#include "Packed_Channel_Utilities.hpp"
 
 // External Terminus Libraries
+#include <terminus/core/work/Thread.hpp>
+#include <terminus/image/operations/detail/Parallel_Band.hpp>
 #include <terminus/log/utility.hpp>
 
 namespace tmns::image {
@@ -34,25 +48,6 @@ void channel_convert_cast( SrcT* src, DestT* dest ) {
   *dest = DestT(*src);
 }
 
-// Simple integer type conversion functions
-void channel_convert_uint16_to_uint8( uint16_t* src, uint8_t* dest )
-{
-  *dest = uint8_t( *src / (65535/255) );
-}
-void channel_convert_uint8_to_uint16( uint8_t* src, uint16_t* dest )
-{
-  *dest = uint16_t( *src ) * (65535/255);
-}
-
-/// Convert a float in the range -1 to +1 to an integer type.
-template <class SrcT, class DestT>
-void channel_convert_float_to_int( SrcT* src, DestT* dest )
-{
-  if( *src > SrcT(1.0) ) *dest = boost::integer_traits<DestT>::const_max;
-  else if( *src < SrcT(0.0) ) *dest = DestT(0);
-  else *dest = DestT( *src * boost::integer_traits<DestT>::const_max );
-}
-
 /// Pointers to two maps:  <type pair> -> conversion function
 /// - One is for rescaling conversions, the other for non-rescaling.
 std::map< std::pair< Channel_Type_Enum, Channel_Type_Enum >, channel_convert_func >*  channel_convert_map         = nullptr;
@@ -270,14 +265,6 @@ Channel_Set_Max_Map_Entry _setmax_f64( &channel_set_max_float<double> );
 //   Reduces a number of channels into one by averaging
 typedef void (*channel_average_func)(void* src, void* dest, int32_t len);
 
-template <class T>
-void channel_average( T* src, T* dest, int len )
-{
-    typename Accumulator_Type<T>::type accum = typename Accumulator_Type<T>::type();
-    for( int32_t i=0; i<len; ++i ) accum += src[i];
-    *dest = accum / len;
-}
-
 // The map, class, and entry setting mirror the previous section.
 std::map<Channel_Type_Enum,channel_average_func>*  channel_average_map = 0;
 
@@ -316,14 +303,6 @@ Channel_Average_Map_Entry _average_f64( &channel_average<double> );
 //   Applies the Alpha Channel to the rest of the channels:
 typedef void (*channel_premultiply_func)(void* src, void* dst, int len);
 
-template <class T>
-void channel_premultiply_int( T* src, T* dst, int32_t len )
-{
-    double scale = src[len-1] / (double)(boost::integer_traits<T>::const_max);
-    for( int i=0; i<len-1; ++i ) dst[i] = T( round(src[i] * scale) );
-    dst[len-1] = src[len-1];
-}
-
 template <class T>
 void channel_premultiply_float( T* src, T* dst, int len )
 {
@@ -369,14 +348,6 @@ Channel_Premultiply_Map_Entry _premultiply_f64( &channel_premultiply_float<doubl
 ///   Removes the premultiply of alpha to other channels:
 typedef void (*channel_unpremultiply_func)( void* src, void* dst, int len );
 
-template <class T>
-void channel_unpremultiply_int( T* src, T* dst, int len )
-{
-    double scale = src[len-1] / (double)(boost::integer_traits<T>::const_max);
-    for( int i=0; i<len-1; ++i ) dst[i] = T( round(src[i] / scale) );
-    dst[len-1] = src[len-1];
-}
-
 template <class T>
 void channel_unpremultiply_float( T* src, T* dst, int len )
 {
@@ -418,101 +389,162 @@ Channel_Unpremultiply_Map_Entry _unpremultiply_f32( &channel_unpremultiply_float
 Channel_Unpremultiply_Map_Entry _unpremultiply_f64( &channel_unpremultiply_float<double> );
 
 
-/****************************************/
-/*          Convert Pixel Data          */
-/****************************************/
-Result<void> convert( const Image_Buffer&  dst,
-                      const Image_Buffer&  src,
-                      bool                 rescale )
+//------------------------------------------------------------------------------------
+// Lookup-table section
+
+/**
+ * Get the cached byte table mapping every source value to its converted destination
+ * bytes.  Only valid for 8/16-bit integer sources.  Entry `i` holds the result for the
+ * source value whose bytes read back as `i`.
+*/
+std::shared_ptr<const std::vector<uint8_t>> convert_lookup_table( Channel_Type_Enum     src_type,
+                                                                  Channel_Type_Enum     dst_type,
+                                                                  bool                  rescale,
+                                                                  channel_convert_func  conv_func,
+                                                                  size_t                src_chstride,
+                                                                  size_t                dst_chstride )
 {
-    // Check ranges and other good stuff
-    if( dst.format().cols() != src.format().cols() ||
-        dst.format().rows() != src.format().rows() )
-    {
-        return outcome::fail( core::error::ErrorCode::INVALID_CONFIGURATION,
-                              "Destination buffer has incorrect size." );
-    }
+    pix::Lookup_Table_Key key { src_type,
+                                dst_type,
+                                rescale ? "convert_rescale" : "convert",
+                                {} };
+    return pix::Lookup_Table_Cache::instance().get_table<std::vector<uint8_t>>( key, [&](){
+        size_t entries = size_t(1) << ( 8 * src_chstride );
+        auto bytes = std::make_shared<std::vector<uint8_t>>( entries * dst_chstride );
+        for( size_t i = 0; i < entries; ++i )
+        {
+            uint8_t  value8  = uint8_t( i );
+            uint16_t value16 = uint16_t( i );
+            conv_func( ( src_chstride == 1 ) ? (void*)&value8 : (void*)&value16,
+                       bytes->data() + i * dst_chstride );
+        }
+        return bytes;
+    });
+}
 
-    // If pixel types are the same, then it's a channel conversion
-    if( dst.format().pixel_type() != src.format().pixel_type() )
+/**
+ * Check if the channel type can be converted through a lookup table
+*/
+bool has_convert_lookup_table( Channel_Type_Enum channel_type )
+{
+    return channel_type == Channel_Type_Enum::UINT8  ||
+           channel_type == Channel_Type_Enum::INT8   ||
+           channel_type == Channel_Type_Enum::UINT16 ||
+           channel_type == Channel_Type_Enum::INT16;
+}
+
+//------------------------------------------------------------------------------------
+// Half-precision section
+
+Result<void> convert_serial( const Image_Buffer&  dst,
+                             const Image_Buffer&  src,
+                             bool                 rescale );
+
+/**
+ * Describe a single row of a buffer.  Half-precision rows are described as the float
+ * scratch row standing in for them.
+*/
+Image_Buffer float32_row_buffer( const Image_Buffer& buffer,
+                                 uint8_t*            row_data,
+                                 float*              scratch )
+{
+    Image_Format format = buffer.format();
+    format.set_rows( 1 );
+    format.set_planes( 1 );
+    if( format.channel_type() != Channel_Type_Enum::FLOAT16 )
     {
-        // Do nothing for now, it's just a check
+        return Image_Buffer( row_data, format, buffer.cstride(), buffer.rstride(), buffer.pstride() );
     }
+    format.set_channel_type( Channel_Type_Enum::FLOAT32 );
+    return Image_Buffer( format, scratch );
+}
 
-    //tmns::log::info( "Destination Buffer:\n", dst.to_string() );
+/****************************************************/
+/*          Convert To/From Half-Precision          */
+/****************************************************/
+Result<void> convert_float16( const Image_Buffer&  dst,
+                              const Image_Buffer&  src,
+                              bool                 rescale )
+{
+    // Half rows are widened to float, so every other conversion is the float one.
+    // Half rows that aren't contiguous (aliased planes) are gathered first.
+    bool   src_half     = src.format().channel_type() == Channel_Type_Enum::FLOAT16;
+    bool   dst_half     = dst.format().channel_type() == Channel_Type_Enum::FLOAT16;
+    size_t cols         = src.format().cols();
+    size_t src_channels = src.format().channels();
+    size_t dst_channels = dst.format().channels();
+    bool   src_packed   = src.cstride() == ssize_t( src_channels * sizeof(Float16) );
+    bool   dst_packed   = dst.cstride() == ssize_t( dst_channels * sizeof(Float16) );
+
+    std::vector<float>   src_row( src_half ? cols * src_channels : 0 );
+    std::vector<float>   dst_row( dst_half ? cols * dst_channels : 0 );
+    std::vector<Float16> gather( std::max( src_half && !src_packed ? cols * src_channels : 0,
+                                           dst_half && !dst_packed ? cols * dst_channels : 0 ) );
+
+    for( size_t p = 0; p < src.format().planes(); ++p )
+    for( size_t r = 0; r < src.format().rows(); ++r )
+    {
+        uint8_t* src_ptr = (uint8_t*)src.data() + ssize_t( p ) * src.pstride() + ssize_t( r ) * src.rstride();
+        uint8_t* dst_ptr = (uint8_t*)dst.data() + ssize_t( p ) * dst.pstride() + ssize_t( r ) * dst.rstride();
 
-    /**
-     * We only support a few special conversions, and the general case where
-     * the source and destination formats are the same.  Below we assume that
-     * we're doing a supported conversion, so we check first.
-    */
-   if( dst.format().pixel_type() != src.format().pixel_type() )
-   {
-        // We freely convert between multi-channel and multi-plane images,
-        // by aliasing the multi-channel buffer as a multi-plane buffer.
-        if( src.format().pixel_type() == Pixel_Format_Enum::SCALAR &&
-            dst.format().planes()     == 1  &&
-            src.format().planes()     == num_channels( dst.format().pixel_type() ).value() )
-        {
-            Image_Buffer new_dst          = dst;
-            new_dst.format().set_pixel_type( Pixel_Format_Enum::SCALAR );
-            new_dst.format().set_planes( src.format().planes() );
-            new_dst.set_pstride( channel_size_bytes( dst.format().channel_type() ).value() );
-            return convert( new_dst, src );
-        }
-        else if( dst.format().pixel_type() == Pixel_Format_Enum::SCALAR &&
-                 src.format().planes()     == 1 &&
-                 dst.format().planes()     == num_channels( src.format().pixel_type() ).value() )
+        if( src_half )
         {
-            Image_Buffer new_src          = src;
-            new_src.format().set_pixel_type( Pixel_Format_Enum::SCALAR );
-            new_src.format().set_planes( dst.format().planes() );
-            new_src.set_pstride( channel_size_bytes( src.format().channel_type() ).value() );
-            return convert( dst, new_src );
+            const Float16* half_ptr = (const Float16*)src_ptr;
+            if( !src_packed )
+            {
+                for( size_t c = 0; c < cols; ++c )
+                {
+                    std::memcpy( gather.data() + c * src_channels,
+                                 src_ptr + ssize_t( c ) * src.cstride(),
+                                 src_channels * sizeof(Float16) );
+                }
+                half_ptr = gather.data();
+            }
+            convert_float16_to_float32( half_ptr, src_row.data(), src_row.size() );
         }
 
-        // We support conversions between user specified generic pixel
-        // types and the pixel types with an identical number of channels.
-        if ( ( src.format().pixel_type() == Pixel_Format_Enum::SCALAR_MASKED     && dst.format().pixel_type() == Pixel_Format_Enum::GRAYA ) ||
-             ( dst.format().pixel_type() == Pixel_Format_Enum::SCALAR_MASKED     && src.format().pixel_type() == Pixel_Format_Enum::GRAYA ) ||
-             ( src.format().pixel_type() == Pixel_Format_Enum::GRAY_MASKED       && dst.format().pixel_type() == Pixel_Format_Enum::GRAYA ) ||
-             ( dst.format().pixel_type() == Pixel_Format_Enum::GRAY_MASKED       && src.format().pixel_type() == Pixel_Format_Enum::GRAYA ) ||
-             ( src.format().pixel_type() == Pixel_Format_Enum::RGB_MASKED        && dst.format().pixel_type() == Pixel_Format_Enum::RGBA  ) ||
-             ( dst.format().pixel_type() == Pixel_Format_Enum::RGB_MASKED        && src.format().pixel_type() == Pixel_Format_Enum::RGBA  ) ||
-             ( src.format().pixel_type() == Pixel_Format_Enum::GENERIC_1_CHANNEL && dst.format().pixel_type() == Pixel_Format_Enum::GRAY  ) ||
-             ( dst.format().pixel_type() == Pixel_Format_Enum::GENERIC_1_CHANNEL && src.format().pixel_type() == Pixel_Format_Enum::GRAY  ) ||
-             ( src.format().pixel_type() == Pixel_Format_Enum::GENERIC_2_CHANNEL && dst.format().pixel_type() == Pixel_Format_Enum::GRAYA ) ||
-             ( dst.format().pixel_type() == Pixel_Format_Enum::GENERIC_2_CHANNEL && src.format().pixel_type() == Pixel_Format_Enum::GRAYA ) ||
-             ( src.format().pixel_type() == Pixel_Format_Enum::GENERIC_3_CHANNEL && dst.format().pixel_type() == Pixel_Format_Enum::RGB   ) ||
-             ( dst.format().pixel_type() == Pixel_Format_Enum::GENERIC_3_CHANNEL && src.format().pixel_type() == Pixel_Format_Enum::RGB   ) ||
-             ( src.format().pixel_type() == Pixel_Format_Enum::GENERIC_3_CHANNEL && dst.format().pixel_type() == Pixel_Format_Enum::XYZ   ) ||
-             ( dst.format().pixel_type() == Pixel_Format_Enum::GENERIC_3_CHANNEL && src.format().pixel_type() == Pixel_Format_Enum::XYZ   ) ||
-             ( src.format().pixel_type() == Pixel_Format_Enum::GENERIC_4_CHANNEL && dst.format().pixel_type() == Pixel_Format_Enum::RGBA  ) ||
-             ( dst.format().pixel_type() == Pixel_Format_Enum::GENERIC_4_CHANNEL && src.format().pixel_type() == Pixel_Format_Enum::RGBA  ) )
+        auto result = convert_serial( float32_row_buffer( dst, dst_ptr, dst_row.data() ),
+                                      float32_row_buffer( src, src_ptr, src_row.data() ),
+                                      rescale );
+        if( result.has_error() )
         {
-            // Do nothing, these combinations are ok to convert.
+            return result;
         }
-        // Other than that, we only support conversion between the core pixel formats
-        else if( ( src.format().pixel_type() != Pixel_Format_Enum::GRAY  &&
-                   src.format().pixel_type() != Pixel_Format_Enum::GRAYA &&
-                   src.format().pixel_type() != Pixel_Format_Enum::RGB   &&
-                   src.format().pixel_type() != Pixel_Format_Enum::RGBA  &&
-                   src.format().pixel_type() != Pixel_Format_Enum::XYZ ) ||
-                 ( dst.format().pixel_type() != Pixel_Format_Enum::GRAY &&
-                   dst.format().pixel_type() != Pixel_Format_Enum::GRAYA &&
-                   dst.format().pixel_type() != Pixel_Format_Enum::RGB  &&
-                   dst.format().pixel_type() != Pixel_Format_Enum::RGBA  &&
-                   dst.format().pixel_type() != Pixel_Format_Enum::XYZ ) )
+
+        if( dst_half )
         {
-            std::stringstream sout;
-            sout << "Source and destination buffers have incompatible pixel formats. Source: "
-                 << enum_to_string( src.format().pixel_type() ) << " vs. "
-                 << enum_to_string( dst.format().pixel_type() ) << ").";
-            tmns::log::error( sout.str() );
-            return outcome::fail( core::error::ErrorCode::INVALID_PIXEL_TYPE,
-                                  sout.str() );
+            if( dst_packed )
+            {
+                convert_float32_to_float16( dst_row.data(), (Float16*)dst_ptr, dst_row.size() );
+            }
+            else
+            {
+                convert_float32_to_float16( dst_row.data(), gather.data(), dst_row.size() );
+                for( size_t c = 0; c < cols; ++c )
+                {
+                    std::memcpy( dst_ptr + ssize_t( c ) * dst.cstride(),
+                                 gather.data() + c * dst_channels,
+                                 dst_channels * sizeof(Float16) );
+                }
+            }
         }
     }
+    return outcome::ok();
+}
+
+/****************************************************/
+/*          Convert Pixel Data on this Thread       */
+/****************************************************/
+Result<void> convert_serial( const Image_Buffer&  dst,
+                             const Image_Buffer&  src,
+                             bool                 rescale )
+{
+    // Half-precision goes through float rows
+    if( src.format().channel_type() == Channel_Type_Enum::FLOAT16 ||
+        dst.format().channel_type() == Channel_Type_Enum::FLOAT16 )
+    {
+        return convert_float16( dst, src, rescale );
+    }
 
     // Gather some stats
     size_t src_channels = num_channels( src.format().pixel_type() ).value();
@@ -543,6 +575,81 @@ Result<void> convert( const Image_Buffer&  dst,
     bool add_alpha  = src_channels % 2 ==1 && dst_channels %  2 == 0;
     bool copy_alpha = src_channels != dst_channels && src_channels % 2 == 0 && dst_channels % 2 == 0;
 
+    // The hottest combinations have hand-vectorized kernels for packed buffers
+    auto simd_func = detail::select_simd_row_kernel( src.format().channel_type(),
+                                                     dst.format().channel_type(),
+                                                     rescale,
+                                                     src_channels,
+                                                     dst_channels,
+                                                     unpremultiply_src,
+                                                     premultiply_src,
+                                                     premultiply_dst );
+    if( simd_func &&
+        src.cstride() == ssize_t( src_channels * src_chstride ) &&
+        dst.cstride() == ssize_t( dst_channels * dst_chstride ) )
+    {
+        // Contiguous planes are converted as one long row
+        size_t cols = src.format().cols();
+        size_t rows = src.format().rows();
+        if( src.rstride() == ssize_t( cols * src.cstride() ) &&
+            dst.rstride() == ssize_t( cols * dst.cstride() ) )
+        {
+            cols *= rows;
+            rows  = 1;
+        }
+
+        const uint8_t* src_ptr_p = (const uint8_t*)src.data();
+        uint8_t*       dst_ptr_p = (uint8_t*)dst.data();
+        for( size_t p = 0; p < src.format().planes(); ++p )
+        {
+            const uint8_t* src_ptr_r = src_ptr_p;
+            uint8_t*       dst_ptr_r = dst_ptr_p;
+            for( size_t r = 0; r < rows; ++r )
+            {
+                simd_func( src_ptr_r, dst_ptr_r, cols );
+                src_ptr_r += src.rstride();
+                dst_ptr_r += dst.rstride();
+            }
+            src_ptr_p += src.pstride();
+            dst_ptr_p += dst.pstride();
+        }
+        return outcome::ok();
+    }
+
+    // Common channel types and counts have a fully-templated row kernel, selected once
+    // per call.  Premultiplication changes still go through the per-pixel path below.
+    if( !unpremultiply_src && !premultiply_src && !premultiply_dst )
+    {
+        auto row_func = detail::select_row_kernel( src.format().channel_type(),
+                                                   dst.format().channel_type(),
+                                                   rescale,
+                                                   src_channels,
+                                                   dst_channels );
+        if( row_func )
+        {
+            const uint8_t* src_ptr_p = (const uint8_t*)src.data();
+            uint8_t*       dst_ptr_p = (uint8_t*)dst.data();
+            for( size_t p = 0; p < src.format().planes(); ++p )
+            {
+                const uint8_t* src_ptr_r = src_ptr_p;
+                uint8_t*       dst_ptr_r = dst_ptr_p;
+                for( size_t r = 0; r < src.format().rows(); ++r )
+                {
+                    row_func( src_ptr_r,
+                              dst_ptr_r,
+                              src.format().cols(),
+                              src.cstride(),
+                              dst.cstride() );
+                    src_ptr_r += src.rstride();
+                    dst_ptr_r += dst.rstride();
+                }
+                src_ptr_p += src.pstride();
+                dst_ptr_p += dst.pstride();
+            }
+            return outcome::ok();
+        }
+    }
+
     // Get handler functions for all of the input data types.
     // - This could be replaced with function calls containing a switch statement.
     channel_convert_func conv_func = rescale ?
@@ -565,6 +672,44 @@ Result<void> convert( const Image_Buffer&  dst,
                               " -> ", dst.format().channel_type(), " )" );
     }
 
+    // Small integer sources go through a cached table instead of per-channel arithmetic
+    std::shared_ptr<const std::vector<uint8_t>> lut;
+    if( has_convert_lookup_table( src.format().channel_type() ) )
+    {
+        lut = convert_lookup_table( src.format().channel_type(),
+                                    dst.format().channel_type(),
+                                    rescale,
+                                    conv_func,
+                                    src_chstride,
+                                    dst_chstride );
+    }
+    const uint8_t* lut_data = lut ? lut->data() : nullptr;
+
+    auto convert_value = [&]( uint8_t* src_ch, uint8_t* dst_ch )
+    {
+        if( lut_data )
+        {
+            uint8_t  value8;
+            uint16_t value16;
+            size_t   index;
+            if( src_chstride == 1 )
+            {
+                std::memcpy( &value8, src_ch, 1 );
+                index = value8;
+            }
+            else
+            {
+                std::memcpy( &value16, src_ch, 2 );
+                index = value16;
+            }
+            std::memcpy( dst_ch, lut_data + index * dst_chstride, dst_chstride );
+        }
+        else
+        {
+            conv_func( src_ch, dst_ch );
+        }
+    };
+
     int max_channels = std::max( src_channels, dst_channels );
 
     std::shared_ptr<uint8_t[]> src_buf(new uint8_t[ max_channels * src_chstride ] );
@@ -602,31 +747,31 @@ Result<void> convert( const Image_Buffer&  dst,
                 // Copy/convert, unrolling the common multi-channel cases
                 if( copy_length == 4 )
                 {
-                    conv_func( src_ptr,                dst_ptr );
-                    conv_func( src_ptr+  src_chstride, dst_ptr+  dst_chstride );
-                    conv_func( src_ptr+2*src_chstride, dst_ptr+2*dst_chstride );
-                    conv_func( src_ptr+3*src_chstride, dst_ptr+3*dst_chstride );
+                    convert_value( src_ptr,                dst_ptr );
+                    convert_value( src_ptr+  src_chstride, dst_ptr+  dst_chstride );
+                    convert_value( src_ptr+2*src_chstride, dst_ptr+2*dst_chstride );
+                    convert_value( src_ptr+3*src_chstride, dst_ptr+3*dst_chstride );
                 }
                 else if( copy_length == 3 )
                 {
-                    conv_func( src_ptr,                dst_ptr );
-                    conv_func( src_ptr+  src_chstride, dst_ptr+  dst_chstride );
-                    conv_func( src_ptr+2*src_chstride, dst_ptr+2*dst_chstride );
+                    convert_value( src_ptr,                dst_ptr );
+                    convert_value( src_ptr+  src_chstride, dst_ptr+  dst_chstride );
+                    convert_value( src_ptr+2*src_chstride, dst_ptr+2*dst_chstride );
                 }
                 else if( copy_length == 2 )
                 {
-                    conv_func( src_ptr,              dst_ptr );
-                    conv_func( src_ptr+src_chstride, dst_ptr+dst_chstride );
+                    convert_value( src_ptr,              dst_ptr );
+                    convert_value( src_ptr+src_chstride, dst_ptr+dst_chstride );
                 }
                 else if( copy_length == 1 )
                 {
-                    conv_func( src_ptr, dst_ptr );
+                    convert_value( src_ptr, dst_ptr );
                 }
                 else
                 {
                     for( int32_t ch=0; ch < copy_length; ++ch )
                     {
-                        conv_func( src_ptr+ch*src_chstride, dst_ptr+ch*dst_chstride );
+                        convert_value( src_ptr+ch*src_chstride, dst_ptr+ch*dst_chstride );
                     }
                 }
 
@@ -634,20 +779,20 @@ Result<void> convert( const Image_Buffer&  dst,
                 if( triplicate )
                 {
                     // Duplicate the input channel twice more
-                    conv_func( src_ptr, dst_ptr+  dst_chstride );
-                    conv_func( src_ptr, dst_ptr+2*dst_chstride );
+                    convert_value( src_ptr, dst_ptr+  dst_chstride );
+                    convert_value( src_ptr, dst_ptr+2*dst_chstride );
                 }
                 else if( average )
                 {
                     for( int ch=0; ch<3; ++ch )
                     {
-                        conv_func( src_ptr+ch*src_chstride, dst_buf.get()+ch*dst_chstride );
+                        convert_value( src_ptr+ch*src_chstride, dst_buf.get()+ch*dst_chstride );
                     }
                     avg_func( dst_buf.get(), dst_ptr, 3 );
                 }
                 if( copy_alpha )
                 {
-                    conv_func( src_ptr+(src_channels-1)*src_chstride, dst_ptr+(dst_channels-1)*dst_chstride );
+                    convert_value( src_ptr+(src_channels-1)*src_chstride, dst_ptr+(dst_channels-1)*dst_chstride );
                 }
                 else if( add_alpha )
                 {
@@ -676,6 +821,494 @@ Result<void> convert( const Image_Buffer&  dst,
     } // End of for-each plane iteration
 
     return outcome::ok();
+} // End function convert_serial
+
+/// Converts one band of rows on the calling thread
+typedef std::function<Result<void>( const Image_Buffer&,
+                                    const Image_Buffer&,
+                                    bool )> band_func_type;
+
+/**
+ * Converts one band of rows.  Bands never overlap, so no locking is needed.
+*/
+class Convert_Band_Task
+{
+    public:
+
+        Convert_Band_Task( const Image_Buffer&   dst,
+                           const Image_Buffer&   src,
+                           bool                  rescale,
+                           const band_func_type& band_func )
+          : m_dst( dst ),
+            m_src( src ),
+            m_rescale( rescale ),
+            m_band_func( band_func ) {}
+
+        void operator()()
+        {
+            bool in_band = ops::detail::g_rasterize_in_band;
+            ops::detail::g_rasterize_in_band = true;
+            m_result = m_band_func( m_dst, m_src, m_rescale );
+            ops::detail::g_rasterize_in_band = in_band;
+        }
+
+        const Result<void>& result() const
+        {
+            return m_result;
+        }
+
+    private:
+
+        Image_Buffer   m_dst;
+        Image_Buffer   m_src;
+        bool           m_rescale;
+        band_func_type m_band_func;
+        Result<void>   m_result { outcome::ok() };
+}; // End of Convert_Band_Task class
+
+/**
+ * Get the rows [start_row, start_row + num_rows) of a buffer
+*/
+Image_Buffer row_band( const Image_Buffer& buffer,
+                       size_t              start_row,
+                       size_t              num_rows )
+{
+    Image_Format format = buffer.format();
+    format.set_rows( num_rows );
+    return Image_Buffer( (uint8_t*)buffer.data() + ssize_t( start_row ) * buffer.rstride(),
+                         format,
+                         buffer.cstride(),
+                         buffer.rstride(),
+                         buffer.pstride() );
+}
+
+/****************************************************/
+/*          Convert Pixel Data in Row Bands         */
+/****************************************************/
+Result<void> convert_parallel( const Image_Buffer&    dst,
+                               const Image_Buffer&    src,
+                               bool                   rescale,
+                               size_t                 num_threads,
+                               const band_func_type&  band_func )
+{
+    // Split rows evenly.  The caller's thread takes the first band.
+    size_t rows = src.format().rows();
+    std::vector<std::shared_ptr<Convert_Band_Task>> tasks;
+    for( size_t i = 0; i < num_threads; ++i )
+    {
+        size_t start_row = ( rows * i ) / num_threads;
+        size_t end_row   = ( rows * ( i + 1 ) ) / num_threads;
+        tasks.push_back( std::make_shared<Convert_Band_Task>( row_band( dst, start_row, end_row - start_row ),
+                                                              row_band( src, start_row, end_row - start_row ),
+                                                              rescale,
+                                                              band_func ) );
+    }
+
+    std::vector<std::shared_ptr<core::work::Thread>> threads;
+    for( size_t i = 1; i < tasks.size(); ++i )
+    {
+        threads.push_back( std::make_shared<core::work::Thread>( tasks[i] ) );
+    }
+    ( *tasks[0] )();
+
+    for( auto& thread : threads )
+    {
+        thread->join();
+    }
+
+    // Report the first failing band so errors don't depend on thread timing
+    for( const auto& task : tasks )
+    {
+        if( task->result().has_error() )
+        {
+            return task->result();
+        }
+    }
+    return outcome::ok();
+}
+
+/**
+ * Describe a single row of a buffer.  Packed rows are described as the 16-bit
+ * scratch row they get unpacked into.
+*/
+Image_Buffer single_row_buffer( const Image_Buffer& buffer,
+                                uint8_t*            row_data,
+                                uint16_t*           scratch )
+{
+    Image_Format format = buffer.format();
+    format.set_rows( 1 );
+    format.set_planes( 1 );
+    if( !format.packed() )
+    {
+        return Image_Buffer( row_data, format, buffer.cstride(), buffer.rstride(), buffer.pstride() );
+    }
+    format.set_packed( false );
+    format.set_channel_type( Channel_Type_Enum::UINT16 );
+    return Image_Buffer( format, scratch );
+}
+
+/****************************************************/
+/*          Convert To/From Bit-Packed Data         */
+/****************************************************/
+Result<void> convert_packed( const Image_Buffer&  dst,
+                             const Image_Buffer&  src,
+                             bool                 rescale )
+{
+    // Each row goes through 16-bit scratch space, so the regular kernels do the work
+    size_t src_values = src.format().cols() * src.format().channels();
+    size_t dst_values = dst.format().cols() * dst.format().channels();
+    std::vector<uint16_t> src_row( src.format().packed() ? src_values : 0 );
+    std::vector<uint16_t> dst_row( dst.format().packed() ? dst_values : 0 );
+
+    Convert_Parallel_Settings serial;
+    serial.num_threads = 1;
+
+    for( size_t p = 0; p < src.format().planes(); ++p )
+    for( size_t r = 0; r < src.format().rows(); ++r )
+    {
+        uint8_t* src_ptr = (uint8_t*)src.data() + ssize_t( p ) * src.pstride() + ssize_t( r ) * src.rstride();
+        uint8_t* dst_ptr = (uint8_t*)dst.data() + ssize_t( p ) * dst.pstride() + ssize_t( r ) * dst.rstride();
+
+        if( src.format().packed() )
+        {
+            auto result = unpack_channels( src.format().channel_type(), src_ptr, src_row.data(), src_values );
+            if( result.has_error() )
+            {
+                return result;
+            }
+        }
+
+        auto result = convert( single_row_buffer( dst, dst_ptr, dst_row.data() ),
+                               single_row_buffer( src, src_ptr, src_row.data() ),
+                               rescale,
+                               serial );
+        if( result.has_error() )
+        {
+            return result;
+        }
+
+        // Out-of-range values saturate, which matches the other narrowing conversions
+        if( dst.format().packed() )
+        {
+            auto pack_result = pack_channels( dst.format().channel_type(), dst_row.data(), dst_ptr, dst_values );
+            if( pack_result.has_error() )
+            {
+                return outcome::fail( pack_result.error() );
+            }
+        }
+    }
+    return outcome::ok();
+}
+
+/**
+ * Check that values within a plane, or pixels within an interleaved row, are contiguous
+*/
+bool is_contiguous_row( const Image_Buffer& buffer )
+{
+    return buffer.cstride() == ssize_t( buffer.format().channels() *
+                                        channel_size_bytes( buffer.format().channel_type() ).value() );
+}
+
+/**
+ * Check that the transpose kernels can handle these buffers
+ * @param channel_type Type of the values being transposed
+*/
+bool is_transposable( const Image_Buffer& dst,
+                      const Image_Buffer& src,
+                      Channel_Type_Enum   channel_type )
+{
+    size_t channel_bytes = channel_size_bytes( channel_type ).value();
+    return is_contiguous_row( src ) && is_contiguous_row( dst ) &&
+           ( channel_bytes == 1 || channel_bytes == 2 || channel_bytes == 4 || channel_bytes == 8 );
+}
+
+/**
+ * Convert planes of a SCALAR buffer into the channels of a single-plane buffer with the
+ * transpose kernels, instead of the strided per-pixel walk.  Differing channel types go
+ * a row at a time through an interleaved scratch row in the source type.  Check
+ * is_transposable() on the source type first.
+*/
+Result<void> convert_planar_to_interleaved( const Image_Buffer&  dst,
+                                            const Image_Buffer&  src,
+                                            bool                 rescale )
+{
+    size_t channels      = src.format().planes();
+    size_t channel_bytes = channel_size_bytes( src.format().channel_type() ).value();
+
+    if( src.format().channel_type() == dst.format().channel_type() )
+    {
+        planar_to_interleaved( (const uint8_t*)src.data(), src.pstride(), src.rstride(),
+                               (uint8_t*)dst.data(), dst.rstride(),
+                               src.format().cols(), src.format().rows(),
+                               channels, channel_bytes );
+        return outcome::ok();
+    }
+
+    Image_Format row_format = dst.format();
+    row_format.set_rows( 1 );
+    row_format.set_channel_type( src.format().channel_type() );
+    std::vector<uint8_t> scratch( row_format.rstride() );
+    Image_Buffer scratch_buffer( row_format, scratch.data() );
+
+    for( size_t r = 0; r < src.format().rows(); ++r )
+    {
+        planar_to_interleaved( (const uint8_t*)src.data() + ssize_t( r ) * src.rstride(), src.pstride(), src.rstride(),
+                               scratch.data(), 0,
+                               src.format().cols(), 1,
+                               channels, channel_bytes );
+        auto result = convert_serial( row_band( dst, r, 1 ), scratch_buffer, rescale );
+        if( result.has_error() )
+        {
+            return result;
+        }
+    }
+    return outcome::ok();
+}
+
+/**
+ * The inverse of convert_planar_to_interleaved().  Check is_transposable() on the
+ * destination type first.
+*/
+Result<void> convert_interleaved_to_planar( const Image_Buffer&  dst,
+                                            const Image_Buffer&  src,
+                                            bool                 rescale )
+{
+    size_t channels      = dst.format().planes();
+    size_t channel_bytes = channel_size_bytes( dst.format().channel_type() ).value();
+
+    if( src.format().channel_type() == dst.format().channel_type() )
+    {
+        interleaved_to_planar( (const uint8_t*)src.data(), src.rstride(),
+                               (uint8_t*)dst.data(), dst.pstride(), dst.rstride(),
+                               src.format().cols(), src.format().rows(),
+                               channels, channel_bytes );
+        return outcome::ok();
+    }
+
+    Image_Format row_format = src.format();
+    row_format.set_rows( 1 );
+    row_format.set_channel_type( dst.format().channel_type() );
+    std::vector<uint8_t> scratch( row_format.rstride() );
+    Image_Buffer scratch_buffer( row_format, scratch.data() );
+
+    for( size_t r = 0; r < src.format().rows(); ++r )
+    {
+        auto result = convert_serial( scratch_buffer, row_band( src, r, 1 ), rescale );
+        if( result.has_error() )
+        {
+            return result;
+        }
+        interleaved_to_planar( scratch.data(), 0,
+                               (uint8_t*)dst.data() + ssize_t( r ) * dst.rstride(), dst.pstride(), dst.rstride(),
+                               src.format().cols(), 1,
+                               channels, channel_bytes );
+    }
+    return outcome::ok();
+}
+
+/**
+ * Run a band conversion, split into row bands across threads when the buffer is large.
+ * Inside a parallel rasterize or convert band, the band's thread does it all.
+*/
+Result<void> convert_bands( const Image_Buffer&               dst,
+                            const Image_Buffer&               src,
+                            bool                              rescale,
+                            const Convert_Parallel_Settings&  settings,
+                            const band_func_type&             band_func )
+{
+    size_t num_threads = ops::detail::g_rasterize_in_band ? 1 : settings.thread_count( src.format() );
+    if( num_threads > 1 )
+    {
+        return convert_parallel( dst, src, rescale, num_threads, band_func );
+    }
+    return band_func( dst, src, rescale );
+}
+
+/// Guards the default parallel settings
+std::mutex g_convert_parallel_mtx;
+
+/// Default parallel settings
+Convert_Parallel_Settings g_convert_parallel_settings;
+
+/********************************************************/
+/*          Get the thread count for a buffer           */
+/********************************************************/
+size_t Convert_Parallel_Settings::thread_count( const Image_Format& format ) const
+{
+    size_t pixels = format.cols() * format.rows() * format.planes();
+    if( num_threads == 1 || pixels < min_pixels || format.rows() < 2 )
+    {
+        return 1;
+    }
+
+    size_t threads = ( num_threads == 0 ) ? std::max<size_t>( std::thread::hardware_concurrency(), 1 )
+                                          : num_threads;
+    size_t max_by_rows = format.rows() / std::max<size_t>( min_rows_per_thread, 1 );
+    return std::max<size_t>( std::min( threads, max_by_rows ), 1 );
+}
+
+/****************************************************/
+/*          Get the default parallel settings       */
+/****************************************************/
+Convert_Parallel_Settings convert_parallel_settings()
+{
+    std::unique_lock<std::mutex> lck( g_convert_parallel_mtx );
+    return g_convert_parallel_settings;
+}
+
+/****************************************************/
+/*          Set the default parallel settings       */
+/****************************************************/
+void set_convert_parallel_settings( const Convert_Parallel_Settings& settings )
+{
+    std::unique_lock<std::mutex> lck( g_convert_parallel_mtx );
+    g_convert_parallel_settings = settings;
+}
+
+/****************************************/
+/*          Convert Pixel Data          */
+/****************************************/
+Result<void> convert( const Image_Buffer&  dst,
+                      const Image_Buffer&  src,
+                      bool                 rescale )
+{
+    return convert( dst, src, rescale, convert_parallel_settings() );
+}
+
+/****************************************/
+/*          Convert Pixel Data          */
+/****************************************/
+Result<void> convert( const Image_Buffer&               dst,
+                      const Image_Buffer&               src,
+                      bool                              rescale,
+                      const Convert_Parallel_Settings&  settings )
+{
+    // Check ranges and other good stuff
+    if( dst.format().cols() != src.format().cols() ||
+        dst.format().rows() != src.format().rows() )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_CONFIGURATION,
+                              "Destination buffer has incorrect size." );
+    }
+
+    if( src.format().planes() != dst.format().planes() &&
+        ( src.format().packed() || dst.format().packed() ) )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_CONFIGURATION,
+                              "Packed buffers must have matching plane counts." );
+    }
+
+    // Bit-packed data is unpacked a row at a time
+    if( src.format().packed() || dst.format().packed() )
+    {
+        return convert_packed( dst, src, rescale );
+    }
+
+    // Unpacked 12/14-bit channels are held in 16-bit words, so convert them as such
+    if( is_packable_type( src.format().channel_type() ) )
+    {
+        Image_Buffer new_src = src;
+        new_src.format().set_channel_type( Channel_Type_Enum::UINT16 );
+        return convert( dst, new_src, rescale, settings );
+    }
+    if( is_packable_type( dst.format().channel_type() ) )
+    {
+        Image_Buffer new_dst = dst;
+        new_dst.format().set_channel_type( Channel_Type_Enum::UINT16 );
+        return convert( new_dst, src, rescale, settings );
+    }
+
+    // If pixel types are the same, then it's a channel conversion
+    if( dst.format().pixel_type() != src.format().pixel_type() )
+    {
+        // Do nothing for now, it's just a check
+    }
+
+    //tmns::log::info( "Destination Buffer:\n", dst.to_string() );
+
+    /**
+     * We only support a few special conversions, and the general case where
+     * the source and destination formats are the same.  Below we assume that
+     * we're doing a supported conversion, so we check first.
+    */
+   if( dst.format().pixel_type() != src.format().pixel_type() )
+   {
+        // We freely convert between multi-channel and multi-plane images,
+        // by aliasing the multi-channel buffer as a multi-plane buffer.
+        if( src.format().pixel_type() == Pixel_Format_Enum::SCALAR &&
+            dst.format().planes()     == 1  &&
+            src.format().planes()     == num_channels( dst.format().pixel_type() ).value() )
+        {
+            if( is_transposable( dst, src, src.format().channel_type() ) )
+            {
+                return convert_bands( dst, src, rescale, settings, convert_planar_to_interleaved );
+            }
+            Image_Buffer new_dst          = dst;
+            new_dst.format().set_pixel_type( Pixel_Format_Enum::SCALAR );
+            new_dst.format().set_planes( src.format().planes() );
+            new_dst.set_pstride( channel_size_bytes( dst.format().channel_type() ).value() );
+            return convert( new_dst, src, rescale, settings );
+        }
+        else if( dst.format().pixel_type() == Pixel_Format_Enum::SCALAR &&
+                 src.format().planes()     == 1 &&
+                 dst.format().planes()     == num_channels( src.format().pixel_type() ).value() )
+        {
+            if( is_transposable( dst, src, dst.format().channel_type() ) )
+            {
+                return convert_bands( dst, src, rescale, settings, convert_interleaved_to_planar );
+            }
+            Image_Buffer new_src          = src;
+            new_src.format().set_pixel_type( Pixel_Format_Enum::SCALAR );
+            new_src.format().set_planes( dst.format().planes() );
+            new_src.set_pstride( channel_size_bytes( src.format().channel_type() ).value() );
+            return convert( dst, new_src, rescale, settings );
+        }
+
+        // We support conversions between user specified generic pixel
+        // types and the pixel types with an identical number of channels.
+        if ( ( src.format().pixel_type() == Pixel_Format_Enum::SCALAR_MASKED     && dst.format().pixel_type() == Pixel_Format_Enum::GRAYA ) ||
+             ( dst.format().pixel_type() == Pixel_Format_Enum::SCALAR_MASKED     && src.format().pixel_type() == Pixel_Format_Enum::GRAYA ) ||
+             ( src.format().pixel_type() == Pixel_Format_Enum::GRAY_MASKED       && dst.format().pixel_type() == Pixel_Format_Enum::GRAYA ) ||
+             ( dst.format().pixel_type() == Pixel_Format_Enum::GRAY_MASKED       && src.format().pixel_type() == Pixel_Format_Enum::GRAYA ) ||
+             ( src.format().pixel_type() == Pixel_Format_Enum::RGB_MASKED        && dst.format().pixel_type() == Pixel_Format_Enum::RGBA  ) ||
+             ( dst.format().pixel_type() == Pixel_Format_Enum::RGB_MASKED        && src.format().pixel_type() == Pixel_Format_Enum::RGBA  ) ||
+             ( src.format().pixel_type() == Pixel_Format_Enum::GENERIC_1_CHANNEL && dst.format().pixel_type() == Pixel_Format_Enum::GRAY  ) ||
+             ( dst.format().pixel_type() == Pixel_Format_Enum::GENERIC_1_CHANNEL && src.format().pixel_type() == Pixel_Format_Enum::GRAY  ) ||
+             ( src.format().pixel_type() == Pixel_Format_Enum::GENERIC_2_CHANNEL && dst.format().pixel_type() == Pixel_Format_Enum::GRAYA ) ||
+             ( dst.format().pixel_type() == Pixel_Format_Enum::GENERIC_2_CHANNEL && src.format().pixel_type() == Pixel_Format_Enum::GRAYA ) ||
+             ( src.format().pixel_type() == Pixel_Format_Enum::GENERIC_3_CHANNEL && dst.format().pixel_type() == Pixel_Format_Enum::RGB   ) ||
+             ( dst.format().pixel_type() == Pixel_Format_Enum::GENERIC_3_CHANNEL && src.format().pixel_type() == Pixel_Format_Enum::RGB   ) ||
+             ( src.format().pixel_type() == Pixel_Format_Enum::GENERIC_3_CHANNEL && dst.format().pixel_type() == Pixel_Format_Enum::XYZ   ) ||
+             ( dst.format().pixel_type() == Pixel_Format_Enum::GENERIC_3_CHANNEL && src.format().pixel_type() == Pixel_Format_Enum::XYZ   ) ||
+             ( src.format().pixel_type() == Pixel_Format_Enum::GENERIC_4_CHANNEL && dst.format().pixel_type() == Pixel_Format_Enum::RGBA  ) ||
+             ( dst.format().pixel_type() == Pixel_Format_Enum::GENERIC_4_CHANNEL && src.format().pixel_type() == Pixel_Format_Enum::RGBA  ) )
+        {
+            // Do nothing, these combinations are ok to convert.
+        }
+        // Other than that, we only support conversion between the core pixel formats
+        else if( ( src.format().pixel_type() != Pixel_Format_Enum::GRAY  &&
+                   src.format().pixel_type() != Pixel_Format_Enum::GRAYA &&
+                   src.format().pixel_type() != Pixel_Format_Enum::RGB   &&
+                   src.format().pixel_type() != Pixel_Format_Enum::RGBA  &&
+                   src.format().pixel_type() != Pixel_Format_Enum::XYZ ) ||
+                 ( dst.format().pixel_type() != Pixel_Format_Enum::GRAY &&
+                   dst.format().pixel_type() != Pixel_Format_Enum::GRAYA &&
+                   dst.format().pixel_type() != Pixel_Format_Enum::RGB  &&
+                   dst.format().pixel_type() != Pixel_Format_Enum::RGBA  &&
+                   dst.format().pixel_type() != Pixel_Format_Enum::XYZ ) )
+        {
+            std::stringstream sout;
+            sout << "Source and destination buffers have incompatible pixel formats. Source: "
+                 << enum_to_string( src.format().pixel_type() ) << " vs. "
+                 << enum_to_string( dst.format().pixel_type() ) << ").";
+            tmns::log::error( sout.str() );
+            return outcome::fail( core::error::ErrorCode::INVALID_PIXEL_TYPE,
+                                  sout.str() );
+        }
+    }
+
+    // Large buffers get split into row bands
+    return convert_bands( dst, src, rescale, settings, convert_serial );
 } // End function convert
 
 } // End of tmns::image namespace
\ No newline at end of file
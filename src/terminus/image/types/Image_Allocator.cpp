@@ -0,0 +1,218 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Image_Allocator.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "Image_Allocator.hpp"
+
+// C++ Libraries
+#include <bit>
+#include <map>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace tmns::image {
+
+/**
+ * Free lists, keyed by size class and alignment
+*/
+struct Pooled_Image_Allocator::Impl
+{
+    typedef std::pair<size_t,size_t> key_type;
+
+    /**
+     * Free every block on the lists until the cache fits the limit
+    */
+    void trim( size_t limit )
+    {
+        for( auto it = free_lists.begin(); it != free_lists.end() && cached_bytes > limit; )
+        {
+            auto& blocks = it->second;
+            while( !blocks.empty() && cached_bytes > limit )
+            {
+                ::operator delete( blocks.back(), std::align_val_t( it->first.second ) );
+                blocks.pop_back();
+                cached_bytes -= it->first.first;
+            }
+            it = blocks.empty() ? free_lists.erase( it ) : std::next( it );
+        }
+    }
+
+    /**
+     * Take back a block whose last reference dropped
+    */
+    void release( void* ptr, const key_type& key )
+    {
+        std::unique_lock<std::mutex> lck( mtx );
+        if( cached_bytes + key.first > max_cached_bytes )
+        {
+            ::operator delete( ptr, std::align_val_t( key.second ) );
+            return;
+        }
+        free_lists[key].push_back( ptr );
+        cached_bytes += key.first;
+    }
+
+    mutable std::mutex mtx;
+    std::map<key_type,std::vector<void*>> free_lists;
+    size_t cached_bytes { 0 };
+    size_t max_cached_bytes { 0 };
+    size_t hits { 0 };
+    size_t misses { 0 };
+
+}; // End of Impl struct
+
+/****************************************************/
+/*          Constructor                             */
+/****************************************************/
+Pooled_Image_Allocator::Pooled_Image_Allocator( size_t max_cached_bytes )
+  : m_impl( std::make_shared<Impl>() )
+{
+    m_impl->max_cached_bytes = max_cached_bytes;
+}
+
+/****************************************************/
+/*          Destructor                              */
+/****************************************************/
+Pooled_Image_Allocator::~Pooled_Image_Allocator()
+{
+    // Outstanding blocks still hold the free lists, so stop caching before letting go
+    std::unique_lock<std::mutex> lck( m_impl->mtx );
+    m_impl->max_cached_bytes = 0;
+    m_impl->trim( 0 );
+}
+
+/****************************************************/
+/*          Allocate a Block                        */
+/****************************************************/
+std::shared_ptr<void> Pooled_Image_Allocator::allocate( size_t bytes,
+                                                        size_t alignment )
+{
+    Impl::key_type key( size_class( bytes ), alignment );
+
+    void* ptr = nullptr;
+    {
+        std::unique_lock<std::mutex> lck( m_impl->mtx );
+        auto it = m_impl->free_lists.find( key );
+        if( it != m_impl->free_lists.end() && !it->second.empty() )
+        {
+            ptr = it->second.back();
+            it->second.pop_back();
+            m_impl->cached_bytes -= key.first;
+            m_impl->hits++;
+        }
+        else
+        {
+            m_impl->misses++;
+        }
+    }
+
+    if( !ptr )
+    {
+        ptr = ::operator new( key.first, std::align_val_t( alignment ), std::nothrow );
+        if( !ptr )
+        {
+            // Cached blocks of other sizes may be what's in the way
+            clear();
+            ptr = ::operator new( key.first, std::align_val_t( alignment ), std::nothrow );
+            if( !ptr )
+            {
+                return {};
+            }
+        }
+    }
+
+    std::weak_ptr<Impl> pool = m_impl;
+    return std::shared_ptr<void>( ptr, [pool,key]( void* block ){
+        if( auto impl = pool.lock() )
+        {
+            impl->release( block, key );
+        }
+        else
+        {
+            ::operator delete( block, std::align_val_t( key.second ) );
+        }
+    });
+}
+
+/****************************************************/
+/*          Cache Statistics                        */
+/****************************************************/
+size_t Pooled_Image_Allocator::cached_bytes() const
+{
+    std::unique_lock<std::mutex> lck( m_impl->mtx );
+    return m_impl->cached_bytes;
+}
+
+size_t Pooled_Image_Allocator::max_cached_bytes() const
+{
+    std::unique_lock<std::mutex> lck( m_impl->mtx );
+    return m_impl->max_cached_bytes;
+}
+
+void Pooled_Image_Allocator::set_max_cached_bytes( size_t max_cached_bytes )
+{
+    std::unique_lock<std::mutex> lck( m_impl->mtx );
+    m_impl->max_cached_bytes = max_cached_bytes;
+    m_impl->trim( max_cached_bytes );
+}
+
+size_t Pooled_Image_Allocator::hits() const
+{
+    std::unique_lock<std::mutex> lck( m_impl->mtx );
+    return m_impl->hits;
+}
+
+size_t Pooled_Image_Allocator::misses() const
+{
+    std::unique_lock<std::mutex> lck( m_impl->mtx );
+    return m_impl->misses;
+}
+
+/****************************************************/
+/*          Release the Cached Blocks               */
+/****************************************************/
+void Pooled_Image_Allocator::clear()
+{
+    std::unique_lock<std::mutex> lck( m_impl->mtx );
+    m_impl->trim( 0 );
+}
+
+/****************************************************/
+/*          Round Up to the Size Class              */
+/****************************************************/
+size_t Pooled_Image_Allocator::size_class( size_t bytes )
+{
+    // Small blocks all share one class
+    static constexpr size_t MIN_CLASS = 4096;
+    if( bytes <= MIN_CLASS )
+    {
+        return MIN_CLASS;
+    }
+
+    // Four steps between powers of 2, so at most 25% is wasted
+    size_t step = std::bit_floor( bytes - 1 ) / 4;
+    return ( bytes + step - 1 ) / step * step;
+}
+
+/****************************************************/
+/*          Get the Shared Pool                     */
+/****************************************************/
+Pooled_Image_Allocator::ptr_t Pooled_Image_Allocator::instance()
+{
+    static ptr_t s_instance = std::make_shared<Pooled_Image_Allocator>();
+    return s_instance;
+}
+
+} // End of tmns::image namespace
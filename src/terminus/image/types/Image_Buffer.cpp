@@ -25,10 +25,9 @@ Image_Buffer::Image_Buffer( Image_Format format,
                             void*        data )
   : m_data( data ),
    m_format( std::move( format ) ),
-   m_cstride( channel_size_bytes( format.channel_type() ).assume_value() *
-              num_channels( format.pixel_type() ).assume_value() ),
-   m_rstride( m_cstride * format.cols() ),
-   m_pstride( m_rstride * format.rows() )
+   m_cstride( m_format.cstride() ),
+   m_rstride( m_format.rstride() ),
+   m_pstride( m_format.pstride() )
 {}
 
 /********************************/
@@ -7,6 +7,7 @@
 
 // Terminus Libraries
 #include "../pixel/Channel_Type_Enum.hpp"
+#include "../pixel/Packed_Channel_Utilities.hpp"
 #include "../pixel/Pixel_Format_Enum.hpp"
 
 // C++ Libraries
@@ -137,6 +138,22 @@ bool Image_Format::premultiply() const
     return m_premultiply;
 }
 
+/****************************************/
+/*          Check if packed             */
+/****************************************/
+bool Image_Format::packed() const
+{
+    return m_packed && is_packable_type( m_channel_type );
+}
+
+/****************************************/
+/*          Set packed storage          */
+/****************************************/
+void Image_Format::set_packed( bool packed )
+{
+    m_packed = packed;
+}
+
 /************************************************************/
 /*   Check if the image format object is fully structured   */
 /************************************************************/
@@ -154,6 +171,11 @@ bool Image_Format::complete() const
 /*******************************************/
 size_t Image_Format::cstride() const
 {
+    // Packed pixels don't start on byte boundaries
+    if( packed() )
+    {
+        return 0;
+    }
     return channel_size_bytes( channel_type() ).value() *
            num_channels( pixel_type() ).value();
 }
@@ -163,6 +185,11 @@ size_t Image_Format::cstride() const
 /*******************************************/
 size_t Image_Format::rstride() const
 {
+    if( packed() )
+    {
+        return packed_size_bytes( channel_size_bits( channel_type() ).value(),
+                                  cols() * num_channels( pixel_type() ).value() );
+    }
     return cstride() * cols();
 }
 
@@ -196,6 +223,7 @@ std::string Image_Format::to_string( size_t offset ) const
     sout << gap << "    - ptype: " << enum_to_string( pixel_type() ) << std::endl;
     sout << gap << "    - ctype: " << enum_to_string( channel_type() ) << std::endl;
     sout << gap << "    - premult: " << std::boolalpha << premultiply() << std::endl;
+    sout << gap << "    - packed: " << std::boolalpha << packed() << std::endl;
     return sout.str();
 }
 
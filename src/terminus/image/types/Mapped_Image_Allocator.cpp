@@ -0,0 +1,137 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    Mapped_Image_Allocator.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "Mapped_Image_Allocator.hpp"
+
+// Terminus Libraries
+#include <terminus/log/utility.hpp>
+
+// C++ Libraries
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// POSIX Libraries
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace tmns::image {
+
+/****************************************************/
+/*          Convert Access Pattern to String        */
+/****************************************************/
+std::string enum_to_string( Mapped_Access_Pattern pattern )
+{
+    switch( pattern )
+    {
+        case Mapped_Access_Pattern::NORMAL:
+            return "NORMAL";
+        case Mapped_Access_Pattern::SEQUENTIAL:
+            return "SEQUENTIAL";
+        case Mapped_Access_Pattern::RANDOM:
+            return "RANDOM";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+/****************************************************/
+/*          Constructor                             */
+/****************************************************/
+Mapped_Image_Allocator::Mapped_Image_Allocator( const std::filesystem::path& scratch_dir,
+                                                Mapped_Access_Pattern        pattern )
+  : m_scratch_dir( scratch_dir ),
+    m_pattern( pattern )
+{}
+
+/****************************************************/
+/*          Map a Scratch File                      */
+/****************************************************/
+std::shared_ptr<void> Mapped_Image_Allocator::allocate( size_t bytes,
+                                                        size_t alignment )
+{
+    if( alignment > size_t( sysconf( _SC_PAGESIZE ) ) )
+    {
+        tmns::log::error( "Mapped images support alignment up to the page size, not ", alignment );
+        return {};
+    }
+
+    // Create the file and unlink it right away, so it goes away with the mapping
+    std::string path_str = ( m_scratch_dir / "terminus_image_XXXXXX" ).string();
+    std::vector<char> path( path_str.begin(), path_str.end() );
+    path.push_back( '\0' );
+    int fd = mkstemp( path.data() );
+    if( fd < 0 )
+    {
+        tmns::log::error( "Unable to create scratch file in ", m_scratch_dir.string(), ": ", std::strerror( errno ) );
+        return {};
+    }
+    unlink( path.data() );
+
+    // Sparse file, so space is only used for pages actually written
+    if( ftruncate( fd, off_t( bytes ) ) != 0 )
+    {
+        tmns::log::error( "Unable to size scratch file to ", bytes, " bytes: ", std::strerror( errno ) );
+        close( fd );
+        return {};
+    }
+
+    void* data = mmap( nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_NORESERVE, fd, 0 );
+    close( fd );
+    if( data == MAP_FAILED )
+    {
+        tmns::log::error( "Unable to map ", bytes, " byte scratch file: ", std::strerror( errno ) );
+        return {};
+    }
+
+    if( !advise( data, bytes, m_pattern ) )
+    {
+        tmns::log::warn( "Access hint ", enum_to_string( m_pattern ), " refused for scratch mapping: ", std::strerror( errno ) );
+    }
+
+    return std::shared_ptr<void>( data, [bytes]( void* ptr ){
+        munmap( ptr, bytes );
+    });
+}
+
+/****************************************************/
+/*          Set the Access Hint                     */
+/****************************************************/
+bool Mapped_Image_Allocator::advise( void*                 data,
+                                     size_t                bytes,
+                                     Mapped_Access_Pattern pattern )
+{
+    int advice = MADV_NORMAL;
+    switch( pattern )
+    {
+        case Mapped_Access_Pattern::SEQUENTIAL:
+            advice = MADV_SEQUENTIAL;
+            break;
+        case Mapped_Access_Pattern::RANDOM:
+            advice = MADV_RANDOM;
+            break;
+        default:
+            break;
+    }
+
+    // madvise() wants a page-aligned start
+    size_t page  = size_t( sysconf( _SC_PAGESIZE ) );
+    auto   start = reinterpret_cast<uintptr_t>( data ) / page * page;
+    bytes += reinterpret_cast<uintptr_t>( data ) - start;
+    return madvise( reinterpret_cast<void*>( start ), bytes, advice ) == 0;
+}
+
+} // End of tmns::image namespace
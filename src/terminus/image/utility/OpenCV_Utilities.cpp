@@ -4,6 +4,7 @@
  * @date    7/29/2023
 */
 #include "OpenCV_Utilities.hpp"
+#include "OpenCV_Adapters.hpp"
 
 // OpenCV Libraries
 #include <opencv4/opencv2/core.hpp>
@@ -28,12 +29,19 @@ Result<int> get_data_type_code( Channel_Type_Enum  channel_type )
         case Channel_Type_Enum::UINT16:
             return outcome::ok<int>( CV_16U );
 
+        case Channel_Type_Enum::INT8:
+            return outcome::ok<int>( CV_8S );
+
         case Channel_Type_Enum::INT16:
             return outcome::ok<int>( CV_16S );
 
         case Channel_Type_Enum::UINT32:
+        case Channel_Type_Enum::INT32:
             return outcome::ok<int>( CV_32S );
 
+        case Channel_Type_Enum::FLOAT16:
+            return outcome::ok<int>( CV_16F );
+
         case Channel_Type_Enum::FLOAT32:
             return outcome::ok<int>( CV_32F );
 
@@ -77,6 +85,106 @@ Result<int> get_pixel_type_code( Pixel_Format_Enum  pixel_type,
                                            ch_res.value() ) );
 }
 
+/****************************************/
+/*      Get the Channel Type of a Depth */
+/****************************************/
+Result<Channel_Type_Enum> get_channel_type( int depth )
+{
+    switch( depth )
+    {
+        case CV_8U:  return outcome::ok<Channel_Type_Enum>( Channel_Type_Enum::UINT8 );
+        case CV_8S:  return outcome::ok<Channel_Type_Enum>( Channel_Type_Enum::INT8 );
+        case CV_16U: return outcome::ok<Channel_Type_Enum>( Channel_Type_Enum::UINT16 );
+        case CV_16S: return outcome::ok<Channel_Type_Enum>( Channel_Type_Enum::INT16 );
+        case CV_32S: return outcome::ok<Channel_Type_Enum>( Channel_Type_Enum::INT32 );
+        case CV_16F: return outcome::ok<Channel_Type_Enum>( Channel_Type_Enum::FLOAT16 );
+        case CV_32F: return outcome::ok<Channel_Type_Enum>( Channel_Type_Enum::FLOAT32 );
+        case CV_64F: return outcome::ok<Channel_Type_Enum>( Channel_Type_Enum::FLOAT64 );
+        default:
+            return outcome::fail( core::error::ErrorCode::INVALID_CHANNEL_TYPE,
+                                  "Unsupported OpenCV depth: ", depth );
+    }
+}
+
+/****************************************/
+/*      Wrap a Buffer as a Mat          */
+/****************************************/
+Result<cv::Mat> to_cv_mat( const Image_Buffer& buffer )
+{
+    if( buffer.planes() > 1 )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "Only single-plane buffers can be wrapped as a cv::Mat. Planes: ",
+                              buffer.planes() );
+    }
+
+    auto type_code = get_pixel_type_code( buffer.pixel_type(),
+                                          buffer.channel_type() );
+    if( type_code.has_error() )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_CONFIGURATION,
+                              "Unsupported conversion. ",
+                              type_code.error().message() );
+    }
+
+    // OpenCV needs the pixels packed within a row
+    size_t pixel_bytes = CV_ELEM_SIZE( type_code.value() );
+    if( buffer.cstride() != ssize_t( pixel_bytes ) || buffer.rstride() < ssize_t( pixel_bytes * buffer.cols() ) )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "Buffer strides cannot be expressed as a cv::Mat. ",
+                              buffer.to_string() );
+    }
+
+    return outcome::ok<cv::Mat>( cv::Mat( buffer.rows(),
+                                          buffer.cols(),
+                                          type_code.value(),
+                                          buffer.data(),
+                                          size_t( buffer.rstride() ) ) );
+}
+
+/****************************************/
+/*      Wrap a Mat as a Buffer          */
+/****************************************/
+Result<Image_Buffer> to_image_buffer( const cv::Mat& mat )
+{
+    if( mat.dims != 2 || mat.empty() )
+    {
+        return outcome::fail( core::error::ErrorCode::INVALID_INPUT,
+                              "Only non-empty 2D cv::Mats can be wrapped. Dims: ", mat.dims );
+    }
+
+    auto channel_type = get_channel_type( mat.depth() );
+    if( channel_type.has_error() )
+    {
+        return channel_type.error();
+    }
+
+    Pixel_Format_Enum pixel_type;
+    switch( mat.channels() )
+    {
+        case 1:  pixel_type = Pixel_Format_Enum::GRAY;  break;
+        case 2:  pixel_type = Pixel_Format_Enum::GRAYA; break;
+        case 3:  pixel_type = Pixel_Format_Enum::RGB;   break;
+        case 4:  pixel_type = Pixel_Format_Enum::RGBA;  break;
+        default:
+            return outcome::fail( core::error::ErrorCode::INVALID_PIXEL_TYPE,
+                                  "Unsupported cv::Mat channel count: ", mat.channels() );
+    }
+
+    Image_Format format( mat.cols,
+                         mat.rows,
+                         1,
+                         pixel_type,
+                         channel_type.value(),
+                         true );
+    return outcome::ok<Image_Buffer>( Image_Buffer( mat.data,
+                                                    format,
+                                                    mat.elemSize(),
+                                                    mat.step[0],
+                                                    mat.step[0] * mat.rows ) );
+}
+
 /********************************************/
 /*      Convert OpenCV Type to String       */
 /********************************************/
@@ -27,6 +27,11 @@ Result<int> get_data_type_code( Channel_Type_Enum channel_type );
 Result<int> get_pixel_type_code( Pixel_Format_Enum  pixel_type,
                                  Channel_Type_Enum  channel_type );
 
+/**
+ * Given an OpenCV depth code (ex: CV_8U), get the channel type
+*/
+Result<Channel_Type_Enum> get_channel_type( int depth );
+
 /**
  * Convert the OpenCV type code to a string
 */
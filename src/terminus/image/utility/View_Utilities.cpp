@@ -9,6 +9,7 @@
 #include <opencv4/opencv2/highgui.hpp>
 
 // Terminus Image Libraries
+#include "OpenCV_Adapters.hpp"
 #include "OpenCV_Utilities.hpp"
 
 // Terminus Libraries
@@ -23,21 +24,16 @@ Result<void> visualize( const std::string&  window_name,
                         const Image_Buffer& buffer_data,
                         int                 window_sleep )
 {
-    auto type_code = ocv::get_pixel_type_code( buffer_data.pixel_type(),
-                                               buffer_data.channel_type() );
-    if( type_code.has_error() )
+    // wrap as an opencv image, sharing the pixels
+    tmns::log::trace( "Creating OpenCV Image" );
+    auto mat_res = ocv::to_cv_mat( buffer_data );
+    if( mat_res.has_error() )
     {
         return outcome::fail( core::error::ErrorCode::INVALID_CONFIGURATION,
                               "Unsupported conversion. ",
-                              type_code.error().message() );
+                              mat_res.error().message() );
     }
-
-    // convert to opencv image
-    tmns::log::trace( "Creating OpenCV Image" );
-    cv::Mat tmp_image( buffer_data.rows(),
-                       buffer_data.cols(),
-                       type_code.value(),
-                       buffer_data.data() );
+    cv::Mat tmp_image = mat_res.value();
 
     tmns::log::trace( "Rendering window: ", window_name );
     cv::imshow( window_name.c_str(), tmp_image );
@@ -0,0 +1,89 @@
+/**
+ * @file    Test_Images.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/image/operations/rasterize.hpp>
+#include <terminus/image/pixel/Pixel_Accessor_Loose.hpp>
+#include <terminus/image/types/Image_Base.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+#include <terminus/math/Rectangle.hpp>
+
+// C++ Libraries
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace tx = tmns::image;
+
+/**
+ * Image whose value is a linear function of position
+*/
+inline tx::Image_Memory<float> make_ramp( size_t cols, size_t rows )
+{
+    tx::Image_Memory<float> image( cols, rows );
+    for( size_t r = 0; r < rows; r++ )
+    for( size_t c = 0; c < cols; c++ )
+    {
+        image( c, r ) = float( c + 100 * r );
+    }
+    return image;
+}
+
+/**
+ * Memory image which counts the pixels read from it, both rasterized and through
+ * the pixel operator.  Copies share the count.
+*/
+class Counting_View : public tx::Image_Base<Counting_View>
+{
+    public:
+
+        typedef float pixel_type;
+        typedef float result_type;
+        typedef tx::Pixel_Accessor_Loose<Counting_View> pixel_accessor;
+
+        Counting_View( const tx::Image_Memory<float>& image )
+          : m_image( image ),
+            m_pixels_read( std::make_shared<std::atomic<size_t>>( 0 ) )
+        {}
+
+        size_t cols()   const { return m_image.cols(); }
+        size_t rows()   const { return m_image.rows(); }
+        size_t planes() const { return m_image.planes(); }
+
+        pixel_accessor origin() const { return pixel_accessor( *this, 0, 0, 0 ); }
+
+        result_type operator()( size_t c, size_t r, size_t p = 0 ) const
+        {
+            *m_pixels_read += 1;
+            return m_image( c, r, p );
+        }
+
+        typedef tx::Image_Memory<float> prerasterize_type;
+        prerasterize_type prerasterize( const tmns::math::Rect2i& bbox ) const
+        {
+            *m_pixels_read += bbox.width() * bbox.height();
+            return m_image;
+        }
+
+        template <class DestT>
+        void rasterize( const DestT& dest, const tmns::math::Rect2i& bbox ) const
+        {
+            tx::ops::rasterize( prerasterize( bbox ), dest, bbox );
+        }
+
+        size_t pixels_read() const { return *m_pixels_read; }
+
+        void reset() { *m_pixels_read = 0; }
+
+        static std::string class_name() { return "Counting_View"; }
+        static std::string full_name()  { return class_name(); }
+
+    private:
+
+        tx::Image_Memory<float> m_image;
+        std::shared_ptr<std::atomic<size_t>> m_pixels_read;
+};
@@ -6,7 +6,10 @@
 #include <gtest/gtest.h>
 
 // C++ Libraries
+#include <algorithm>
 #include <filesystem>
+#include <set>
+#include <utility>
 
 // Terminus Libraries
 #include <terminus/feature/drivers/ocv/config/Detector_Config_OCV_ORB.hpp>
@@ -14,6 +17,7 @@
 #include <terminus/image/io/read_image_disk.hpp>
 #include <terminus/image/pixel/Pixel_RGBA.hpp>
 #include <terminus/image/utility/View_Utilities.hpp>
+#include <terminus/math/Point_Utilities.hpp>
 
 // Unit-Test APIs
 #include "../UNIT_TEST_ONLY/Test_Environment.hpp"
@@ -21,6 +25,111 @@
 namespace tx=tmns::image;
 namespace tf=tmns::feature;
 
+namespace {
+
+/**
+ * Tiles of 32x32 with an 8 pixel halo, asking for 64 points per tile
+*/
+class Grid_Detector_Config : public tf::Detector_Config_Base
+{
+    public:
+
+        bool allow_custom_tile_size() const override { return true; }
+
+        tmns::math::Size2i tile_size_pixels() const override { return tmns::math::Size2i( { 32, 32 } ); }
+
+        int tile_halo_pixels() const override { return 8; }
+
+        int max_features() const override { return 64; }
+
+        std::string logger_name() const override { return "Grid_Detector"; }
+
+        std::string to_string( size_t offset ) const override { return "Grid_Detector_Config"; }
+};
+
+/**
+ * Reports every nonzero pixel as a point, with the pixel value as its response,
+ * keeping only the strongest ones like a real detector.
+*/
+class Grid_Detector : public tf::Detector_Base
+{
+    public:
+
+        Grid_Detector()
+          : tf::Detector_Base( std::make_shared<Grid_Detector_Config>() )
+        {}
+
+        tmns::Result<tf::Interest_Point_List> process_image( const tx::Image_Buffer& image_data,
+                                                             bool                    cast_if_ctype_unsupported,
+                                                             int                     max_points_override ) override
+        {
+            tf::Interest_Point_List points;
+            auto data = (const uint8_t*)image_data.data();
+            for( size_t r = 0; r < image_data.rows(); r++ )
+            for( size_t c = 0; c < image_data.cols(); c++ )
+            {
+                uint8_t value = data[r * image_data.rstride() + c * image_data.cstride()];
+                if( value > 0 )
+                {
+                    points.emplace_back( tmns::math::ToPoint2<float>( (float)c, (float)r ),
+                                         1, 0, value, 0, 0 );
+                }
+            }
+
+            std::stable_sort( points.begin(),
+                              points.end(),
+                              []( const tf::Interest_Point& a, const tf::Interest_Point& b ){
+                                  return a.response() > b.response(); } );
+            if( max_points_override > 0 && points.size() > (size_t)max_points_override )
+            {
+                points.resize( max_points_override );
+            }
+            return points;
+        }
+
+        std::string class_name() const override { return "Grid_Detector"; }
+};
+
+} // End of anonymous namespace
+
+/************************************************************/
+/*          Tiles keep their full share of points           */
+/*          even when the halo outranks them                */
+/************************************************************/
+TEST( detect_interest_points, halo_tile_seams )
+{
+    // A point every 4 pixels, so each 32x32 tile holds exactly 64.  Responses vary
+    // so the strongest points are spread across tiles and halos alike.
+    tx::Image_Memory<tx::PixelGray_u8> image( 96, 96 );
+    std::set<std::pair<int,int>> expected;
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        bool on_grid = ( r % 4 == 2 ) && ( c % 4 == 2 );
+        image( c, r ) = tx::PixelGray_u8( on_grid ? ( c * 7 + r * 13 ) % 31 + 1 : 0 );
+        if( on_grid )
+        {
+            expected.emplace( (int)c, (int)r );
+        }
+    }
+
+    auto detector = std::make_shared<Grid_Detector>();
+    auto session_context = tmns::core::create_default_session();
+    auto result = tf::detect_interest_points( image,
+                                              detector,
+                                              session_context );
+    ASSERT_FALSE( result.has_error() );
+
+    // Every grid point is found exactly once, including those along the seams
+    std::set<std::pair<int,int>> found;
+    for( const auto& ip : result.value() )
+    {
+        ASSERT_TRUE( found.emplace( ip.raster_loc().x(), ip.raster_loc().y() ).second );
+    }
+    ASSERT_EQ( result.value().size(), expected.size() );
+    ASSERT_EQ( found, expected );
+}
+
 /************************************************************/
 /*          Test the Find Keypoints on a test image         */
 /*          - Disk Image Example                            */
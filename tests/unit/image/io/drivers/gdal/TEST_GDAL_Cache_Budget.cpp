@@ -0,0 +1,70 @@
+/**
+ * @file    TEST_GDAL_Cache_Budget.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// GDAL Libraries
+#include <gdal.h>
+
+// Terminus Libraries
+#include <terminus/image/io/drivers/gdal/GDAL_Cache_Budget.hpp>
+#include <terminus/image/io/drivers/gdal/GDAL_Utilities.hpp>
+
+using namespace tmns::image;
+
+/****************************************************/
+/*          Test the budget split with GDAL         */
+/****************************************************/
+TEST( GDAL_Cache_Budget, budget_split )
+{
+    // Make sure GDAL is initialized
+    io::gdal::get_master_gdal_mutex();
+
+    auto& budget = io::gdal::GDAL_Cache_Budget::instance();
+    ASSERT_TRUE( budget.set_total_bytes( 0 ).has_error() );
+    ASSERT_TRUE( budget.set_gdal_reserve_fraction( 1.5 ).has_error() );
+
+    ASSERT_FALSE( budget.set_total_bytes( 200000000 ).has_error() );
+    ASSERT_FALSE( budget.set_gdal_reserve_fraction( 0.25 ).has_error() );
+
+    // No tile cache yet, so GDAL owns it all
+    {
+        ASSERT_FALSE( budget.tile_cache_active() );
+        ASSERT_EQ( budget.gdal_cache_bytes(), 200000000 );
+        ASSERT_EQ( GDALGetCacheMax64(), 200000000 );
+
+        // Once a tile cache exists, GDAL gets shrunk
+        auto cache = budget.tile_cache();
+        ASSERT_TRUE( cache != nullptr );
+        ASSERT_TRUE( budget.tile_cache_active() );
+        ASSERT_EQ( budget.tile_cache(), cache );
+        ASSERT_EQ( budget.gdal_cache_bytes(), 50000000 );
+        ASSERT_EQ( budget.tile_cache_bytes(), 150000000 );
+        ASSERT_EQ( GDALGetCacheMax64(), 50000000 );
+    }
+
+    // Cache released, so GDAL gets the budget back on its own
+    ASSERT_FALSE( budget.tile_cache_active() );
+    ASSERT_EQ( budget.gdal_cache_bytes(), 200000000 );
+    ASSERT_EQ( GDALGetCacheMax64(), 200000000 );
+
+    // A copy held elsewhere keeps GDAL shrunk until it is dropped too
+    {
+        auto cache = budget.tile_cache();
+        auto copy  = cache;
+        cache.reset();
+        ASSERT_EQ( GDALGetCacheMax64(), 50000000 );
+    }
+    ASSERT_EQ( GDALGetCacheMax64(), 200000000 );
+
+    // Streaming flag
+    budget.set_streaming_reads( true );
+    ASSERT_TRUE( budget.streaming_reads() );
+    budget.set_streaming_reads( false );
+
+    // Restore defaults
+    ASSERT_FALSE( budget.set_total_bytes( io::gdal::GDAL_Cache_Budget::DEFAULT_TOTAL_BYTES ).has_error() );
+    ASSERT_FALSE( budget.set_gdal_reserve_fraction( io::gdal::GDAL_Cache_Budget::DEFAULT_GDAL_RESERVE_FRACTION ).has_error() );
+}
@@ -0,0 +1,52 @@
+/**
+ * @file    TEST_GDAL_Dataset_Registry.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/io/drivers/gdal/GDAL_Dataset_Registry.hpp>
+#include <terminus/image/io/drivers/gdal/Image_Resource_Disk_GDAL.hpp>
+#include <terminus/image/pixel/Pixel_RGB.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+namespace tx = tmns::image;
+
+/************************************************************/
+/*          Test reads while datasets are being evicted     */
+/************************************************************/
+TEST( GDAL_Dataset_Registry, lazy_reopen )
+{
+    auto& registry = tx::io::gdal::GDAL_Dataset_Registry::instance();
+    ASSERT_TRUE( registry.set_max_open_datasets( 0 ).has_error() );
+    ASSERT_FALSE( registry.set_max_open_datasets( 1 ).has_error() );
+    ASSERT_EQ( registry.max_open_datasets(), 1 );
+
+    {
+        tx::io::gdal::Image_Resource_Disk_GDAL resource_jpg( "./data/images/jpeg/lena.jpg" );
+        tx::io::gdal::Image_Resource_Disk_GDAL resource_png( "./data/images/png/lena.png" );
+        ASSERT_EQ( registry.num_open_datasets(), 1 );
+
+        // Format info is cached, so no reopen is required
+        ASSERT_EQ( resource_jpg.cols(), 512 );
+        ASSERT_EQ( resource_jpg.rows(), 512 );
+
+        tx::Image_Memory<tx::PixelRGB_u8> image_jpg( resource_jpg.cols(), resource_jpg.rows() );
+        tx::Image_Memory<tx::PixelRGB_u8> image_png( resource_png.cols(), resource_png.rows() );
+
+        // Alternate reads, forcing each resource to reopen its file
+        for( int i = 0; i < 2; i++ )
+        {
+            ASSERT_FALSE( resource_jpg.read( image_jpg.buffer(), resource_jpg.format().bbox() ).has_error() );
+            ASSERT_EQ( registry.num_open_datasets(), 1 );
+            ASSERT_FALSE( resource_png.read( image_png.buffer(), resource_png.format().bbox() ).has_error() );
+            ASSERT_EQ( registry.num_open_datasets(), 1 );
+        }
+    }
+
+    // Destroyed resources release their datasets
+    ASSERT_EQ( registry.num_open_datasets(), 0 );
+
+    ASSERT_FALSE( registry.set_max_open_datasets( tx::io::gdal::GDAL_Dataset_Registry::DEFAULT_MAX_OPEN_DATASETS ).has_error() );
+}
@@ -0,0 +1,65 @@
+/**
+ * @file    TEST_GDAL_Write_Profile.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// GDAL Libraries
+#include <gdal.h>
+
+// Terminus Libraries
+#include <terminus/image/io/drivers/gdal/GDAL_Write_Profile.hpp>
+#include <terminus/image/io/read_image_disk.hpp>
+#include <terminus/image/io/write_image.hpp>
+
+// C++ Libraries
+#include <filesystem>
+
+namespace tx = tmns::image;
+
+/****************************************/
+/*          Test profile parsing        */
+/****************************************/
+TEST( GDAL_Write_Profile, parse_write_profile )
+{
+    ASSERT_EQ( tx::io::gdal::parse_write_profile( "fast" ).value(), tx::io::gdal::GDAL_Write_Profile::FAST );
+    ASSERT_EQ( tx::io::gdal::parse_write_profile( "Balanced" ).value(), tx::io::gdal::GDAL_Write_Profile::BALANCED );
+    ASSERT_EQ( tx::io::gdal::parse_write_profile( "ARCHIVE" ).value(), tx::io::gdal::GDAL_Write_Profile::ARCHIVE );
+    ASSERT_TRUE( tx::io::gdal::parse_write_profile( "turbo" ).has_error() );
+
+    ASSERT_EQ( tx::io::gdal::enum_to_string( tx::io::gdal::GDAL_Write_Profile::BALANCED ), "balanced" );
+}
+
+/************************************************/
+/*          Test writing with a profile         */
+/************************************************/
+TEST( GDAL_Write_Profile, write_balanced_tiff )
+{
+    std::filesystem::path image_to_load { "./data/images/jpeg/lena.jpg" };
+    auto image_to_write = std::filesystem::temp_directory_path() / "TEST_GDAL_Write_Profile.tif";
+
+    auto result = tx::io::read_image_disk<tx::PixelRGB_u8>( image_to_load );
+    ASSERT_FALSE( result.has_error() );
+
+    std::map<std::string,std::string> write_options;
+    write_options[tx::io::gdal::WRITE_PROFILE_OPTION] = "balanced";
+    ASSERT_FALSE( tx::io::write_image( image_to_write,
+                                       result.value(),
+                                       write_options ).has_error() );
+
+    // Check GDAL saw the profile's codec and tiling
+    GDALDatasetH dataset = GDALOpen( image_to_write.c_str(), GA_ReadOnly );
+    ASSERT_TRUE( dataset != nullptr );
+    const char* compression = GDALGetMetadataItem( dataset, "COMPRESSION", "IMAGE_STRUCTURE" );
+    ASSERT_TRUE( compression != nullptr );
+    ASSERT_EQ( std::string( compression ), "DEFLATE" );
+
+    int block_x, block_y;
+    GDALGetBlockSize( GDALGetRasterBand( dataset, 1 ), &block_x, &block_y );
+    ASSERT_EQ( block_x, 256 );
+    ASSERT_EQ( block_y, 256 );
+    GDALClose( dataset );
+
+    std::filesystem::remove( image_to_write );
+}
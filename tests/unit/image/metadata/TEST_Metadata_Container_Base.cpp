@@ -0,0 +1,111 @@
+/**
+ * @file    TEST_Metadata_Container_Base.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/metadata/Metadata_Container_Base.hpp>
+
+// C++ Libraries
+#include <thread>
+#include <vector>
+
+using namespace tmns::image;
+
+/************************************************/
+/*          Test deferred domain loading        */
+/************************************************/
+TEST( meta_Metadata_Container_Base, deferred_domains )
+{
+    int load_count = 0;
+
+    auto source = std::make_shared<meta::Metadata_Container_Base>();
+    source->insert( "pathname", std::string( "lena.tif" ) );
+    source->insert_deferred( "label", [&load_count]( meta::Metadata_Container_Base& container ) -> Result<void>
+    {
+        load_count++;
+        container.insert( "label.lines", 512 );
+        return outcome::ok();
+    });
+
+    // Merging does not trigger a load
+    auto dest = std::make_shared<meta::Metadata_Container_Base>();
+    ASSERT_FALSE( dest->insert( source, true ).has_error() );
+    ASSERT_FALSE( dest->insert( source, true ).has_error() );
+    ASSERT_EQ( load_count, 0 );
+    ASSERT_EQ( dest->deferred_domains().size(), 1 );
+
+    // Unknown domains are ignored
+    ASSERT_FALSE( dest->load_domain( "other" ).has_error() );
+    ASSERT_EQ( load_count, 0 );
+
+    // First query loads it
+    ASSERT_EQ( dest->get<int>( "label.lines" ).value(), 512 );
+    ASSERT_EQ( dest->get<std::string>( "pathname" ).value(), "lena.tif" );
+    ASSERT_EQ( load_count, 1 );
+    ASSERT_TRUE( dest->deferred_domains().empty() );
+
+    // The source shares the result rather than loading again
+    ASSERT_EQ( source->get<int>( "label.lines" ).value(), 512 );
+    ASSERT_EQ( load_count, 1 );
+}
+
+/****************************************************/
+/*          Test loading while others query         */
+/****************************************************/
+TEST( meta_Metadata_Container_Base, deferred_concurrent_queries )
+{
+    auto container = std::make_shared<meta::Metadata_Container_Base>();
+    container->insert( "pathname", std::string( "lena.tif" ) );
+    for( int d = 0; d < 8; d++ )
+    {
+        container->insert_deferred( "domain_" + std::to_string( d ), [d]( meta::Metadata_Container_Base& c ) -> Result<void>
+        {
+            for( int i = 0; i < 100; i++ )
+            {
+                c.insert( "domain_" + std::to_string( d ) + ".key_" + std::to_string( i ), i );
+            }
+            return outcome::ok();
+        });
+    }
+
+    // Each thread loads a different domain while the rest read
+    std::vector<std::thread> threads;
+    for( int d = 0; d < 8; d++ )
+    {
+        threads.emplace_back( [container, d](){
+            ASSERT_FALSE( container->load_domain( "domain_" + std::to_string( d ) ).has_error() );
+            ASSERT_EQ( container->get<std::string>( "pathname" ).value(), "lena.tif" );
+        });
+    }
+    for( auto& thread : threads )
+    {
+        thread.join();
+    }
+    ASSERT_EQ( container->get<int>( "domain_7.key_99" ).value(), 99 );
+}
+
+/************************************************/
+/*          Test dropping deferred domains      */
+/************************************************/
+TEST( meta_Metadata_Container_Base, clear_deferred )
+{
+    int load_count = 0;
+
+    auto container = std::make_shared<meta::Metadata_Container_Base>();
+    container->insert_deferred( "label", [&load_count]( meta::Metadata_Container_Base& c ) -> Result<void>
+    {
+        load_count++;
+        c.insert( "label.lines", 512 );
+        return outcome::ok();
+    });
+    ASSERT_EQ( container->deferred_domains().size(), 1 );
+
+    // A reopen drops what the old source deferred
+    container->clear_deferred();
+    ASSERT_TRUE( container->deferred_domains().empty() );
+    ASSERT_TRUE( container->get<int>( "label.lines" ).has_error() );
+    ASSERT_EQ( load_count, 0 );
+}
@@ -0,0 +1,103 @@
+/**
+ * @file    TEST_image_math.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/image_math.hpp>
+#include <terminus/image/operations/pixel_cast.hpp>
+#include <terminus/image/pixel/Pixel_RGB.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+namespace tx = tmns::image;
+
+/****************************************************/
+/*      Fused Band Math Over Two Images             */
+/****************************************************/
+TEST( ops_image_math, binary_operators )
+{
+    tx::Image_Memory<uint16_t> red( 64, 48 );
+    tx::Image_Memory<uint16_t> nir( 64, 48 );
+    for( size_t r = 0; r < red.rows(); r++ )
+    for( size_t c = 0; c < red.cols(); c++ )
+    {
+        red( c, r ) = uint16_t( 100 + c );
+        nir( c, r ) = uint16_t( 300 + r * 3 );
+    }
+
+    auto red_f = tx::ops::pixel_cast<float>( red );
+    auto nir_f = tx::ops::pixel_cast<float>( nir );
+    tx::Image_Memory<float> ndvi = ( nir_f - red_f ) / ( nir_f + red_f );
+    tx::Image_Memory<float> scaled = 2.f * red_f + 1.f;
+    tx::Image_Memory<uint8_t> brighter = nir > red;
+
+    for( size_t r = 0; r < red.rows(); r++ )
+    for( size_t c = 0; c < red.cols(); c++ )
+    {
+        float n = nir( c, r ), v = red( c, r );
+        ASSERT_FLOAT_EQ( ndvi( c, r ), ( n - v ) / ( n + v ) );
+        ASSERT_FLOAT_EQ( scaled( c, r ), 2.f * v + 1.f );
+        ASSERT_EQ( brighter( c, r ), nir( c, r ) > red( c, r ) );
+    }
+
+    // Views are lazy, so single pixels can be read without rasterizing
+    auto diff = nir_f - red_f;
+    ASSERT_FLOAT_EQ( diff( 5, 7 ), float( nir( 5, 7 ) ) - float( red( 5, 7 ) ) );
+    ASSERT_EQ( diff.cols(), 64 );
+    ASSERT_EQ( diff.rows(), 48 );
+
+    // Sizes must match
+    tx::Image_Memory<uint16_t> other( 10, 10 );
+    ASSERT_THROW( red + other, std::runtime_error );
+}
+
+/****************************************************/
+/*      Multi-Channel Pixels Work Per Channel       */
+/****************************************************/
+TEST( ops_image_math, compound_pixels )
+{
+    tx::Image_Memory<tx::PixelRGB_f32> image1( 8, 8 );
+    tx::Image_Memory<tx::PixelRGB_f32> image2( 8, 8 );
+    for( size_t r = 0; r < image1.rows(); r++ )
+    for( size_t c = 0; c < image1.cols(); c++ )
+    {
+        image1( c, r ) = tx::PixelRGB_f32( c, r, 1 );
+        image2( c, r ) = tx::PixelRGB_f32( 2, 3, 4 );
+    }
+
+    tx::Image_Memory<tx::PixelRGB_f32> product = image1 * image2 - 1.f;
+    for( size_t r = 0; r < image1.rows(); r++ )
+    for( size_t c = 0; c < image1.cols(); c++ )
+    {
+        ASSERT_FLOAT_EQ( product( c, r )[0], c * 2.f - 1 );
+        ASSERT_FLOAT_EQ( product( c, r )[1], r * 3.f - 1 );
+        ASSERT_FLOAT_EQ( product( c, r )[2], 3.f );
+    }
+}
+
+/****************************************************/
+/*      N-ary Views                                 */
+/****************************************************/
+TEST( ops_image_math, nary_view )
+{
+    tx::Image_Memory<float> a( 16, 12 ), b( 16, 12 ), c( 16, 12 );
+    for( size_t r = 0; r < a.rows(); r++ )
+    for( size_t col = 0; col < a.cols(); col++ )
+    {
+        a( col, r ) = col;
+        b( col, r ) = r;
+        c( col, r ) = 0.5f;
+    }
+
+    auto fma = []( float x, float y, float z ) { return x * y + z; };
+    tx::Image_Memory<float> result = tx::ops::per_pixel_nary_view( fma, a, b, c );
+    auto sum = tx::ops::per_pixel_view( a, b, []( float x, float y ) { return x + y; } );
+    for( size_t r = 0; r < a.rows(); r++ )
+    for( size_t col = 0; col < a.cols(); col++ )
+    {
+        ASSERT_FLOAT_EQ( result( col, r ), col * float( r ) + 0.5f );
+        ASSERT_FLOAT_EQ( sum( col, r ), col + float( r ) );
+    }
+}
@@ -0,0 +1,168 @@
+/**
+ * @file    TEST_rasterize.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/clamp.hpp>
+#include <terminus/image/operations/crop_image.hpp>
+#include <terminus/image/operations/normalize.hpp>
+#include <terminus/image/operations/pixel_cast.hpp>
+#include <terminus/image/operations/rasterize.hpp>
+#include <terminus/image/pixel/Pixel_RGB.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+// C++ Libraries
+#include <span>
+
+namespace tx = tmns::image;
+
+/**
+ * Doubles values, counting how often each interface is used
+*/
+struct Span_Counting_Functor
+{
+    float operator()( float value ) const
+    {
+        ( *pixel_calls )++;
+        return value * 2;
+    }
+
+    void operator()( std::span<const float> input,
+                     std::span<float>       output ) const
+    {
+        ( *span_calls )++;
+        for( size_t i = 0; i < input.size(); i++ )
+        {
+            output[i] = input[i] * 2;
+        }
+    }
+
+    size_t* pixel_calls;
+    size_t* span_calls;
+};
+
+/****************************************************/
+/*      Parallel Rasterize Matches Serial           */
+/****************************************************/
+TEST( ops_rasterize, parallel_matches_serial )
+{
+    tx::Image_Memory<uint16_t> image( 700, 650, 2 );
+    for( size_t p = 0; p < image.planes(); p++ )
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r, p ) = uint16_t( c * 31 + r * 7 + p * 1000 );
+    }
+
+    auto view = tx::ops::pixel_cast<float>( tx::crop_image( image, 10, 20, 600, 613 ) );
+    tmns::math::Rect2i bbox( 0, 0, view.cols(), view.rows() );
+
+    tx::ops::Rasterize_Parallel_Settings serial;
+    tx::ops::Rasterize_Parallel_Settings parallel;
+    parallel.num_threads = 5;
+    parallel.min_pixels  = 0;
+
+    tx::Image_Memory<float> expected( view.cols(), view.rows(), view.planes() );
+    tx::Image_Memory<float> actual( view.cols(), view.rows(), view.planes() );
+    tx::ops::rasterize( view, expected, bbox, serial );
+    tx::ops::rasterize( view, actual, bbox, parallel );
+
+    // Row counts that don't split evenly still cover every row
+    tmns::math::Rect2i sub_bbox( 3, 5, 101, 97 );
+    tx::Image_Memory<float> sub_actual( sub_bbox.width(), sub_bbox.height(), view.planes() );
+    parallel.min_rows_per_thread = 1;
+    tx::ops::rasterize( view, sub_actual, sub_bbox, parallel );
+
+    for( size_t p = 0; p < view.planes(); p++ )
+    {
+        for( size_t r = 0; r < view.rows(); r++ )
+        for( size_t c = 0; c < view.cols(); c++ )
+        {
+            ASSERT_EQ( expected( c, r, p ), float( image( c + 10, r + 20, p ) ) );
+            ASSERT_EQ( actual( c, r, p ), expected( c, r, p ) );
+        }
+        for( int r = 0; r < sub_bbox.height(); r++ )
+        for( int c = 0; c < sub_bbox.width(); c++ )
+        {
+            ASSERT_EQ( sub_actual( c, r, p ), expected( c + 3, r + 5, p ) );
+        }
+    }
+}
+
+/****************************************************/
+/*      Global Setting Applies to Assignment        */
+/****************************************************/
+TEST( ops_rasterize, global_settings )
+{
+    auto defaults = tx::ops::rasterize_parallel_settings();
+    ASSERT_EQ( defaults.num_threads, 1 );
+
+    tx::Image_Memory<uint8_t> image( 512, 512 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = uint8_t( c ^ r );
+    }
+
+    auto settings = defaults;
+    settings.num_threads = 0;
+    settings.min_pixels  = 0;
+    tx::ops::set_rasterize_parallel_settings( settings );
+    ASSERT_EQ( tx::ops::rasterize_parallel_settings().num_threads, 0 );
+
+    tx::Image_Memory<double> result = tx::ops::pixel_cast<double>( image );
+    tx::ops::set_rasterize_parallel_settings( defaults );
+
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        ASSERT_EQ( result( c, r ), double( image( c, r ) ) );
+    }
+}
+
+/****************************************************/
+/*      Span Functors Rasterize Whole Rows          */
+/****************************************************/
+TEST( ops_rasterize, span_functors )
+{
+    static_assert( tx::ops::Has_Span_Operator<Span_Counting_Functor,float,float>::value );
+    static_assert( !tx::ops::Has_Span_Operator<std::negate<float>,float,float>::value );
+
+    tx::Image_Memory<float> image( 33, 21 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = float( c ) - float( r );
+    }
+
+    size_t pixel_calls = 0, span_calls = 0;
+    Span_Counting_Functor func { &pixel_calls, &span_calls };
+    tx::ops::Per_Pixel_View_Unary<tx::Image_Memory<float>,Span_Counting_Functor> view( image, func );
+    tx::Image_Memory<float> result = view;
+    ASSERT_EQ( span_calls, image.rows() );
+    ASSERT_EQ( pixel_calls, 0 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        ASSERT_EQ( result( c, r ), image( c, r ) * 2 );
+    }
+
+    // Chained views with span support match the per-pixel values
+    tx::Image_Memory<tx::PixelRGB_u8> rgb( 40, 30 );
+    for( size_t r = 0; r < rgb.rows(); r++ )
+    for( size_t c = 0; c < rgb.cols(); c++ )
+    {
+        rgb( c, r ) = tx::PixelRGB_u8( uint8_t( c * 6 ), uint8_t( r * 8 ), uint8_t( c + r ) );
+    }
+    auto chain = tx::ops::clamp( tx::ops::normalize( tx::ops::pixel_cast<tx::PixelRGB_f32>( rgb ), 0, 255, 0, 1 ), 0.1, 0.9 );
+    tx::Image_Memory<tx::PixelRGB_f32> fast = chain;
+    for( size_t r = 0; r < rgb.rows(); r++ )
+    for( size_t c = 0; c < rgb.cols(); c++ )
+    for( size_t ch = 0; ch < 3; ch++ )
+    {
+        ASSERT_FLOAT_EQ( fast( c, r )[ch], chain( c, r )[ch] );
+    }
+}
@@ -0,0 +1,53 @@
+/**
+ * @file    TEST_Block_Generator.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/block/Block_Generator.hpp>
+#include <terminus/image/pixel/Pixel_Gray.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+// C++ Libraries
+#include <memory>
+
+namespace tx = tmns::image;
+
+/****************************************************/
+/*      Reported Size Matches the Held Block        */
+/****************************************************/
+TEST( Block_Generator, size_bytes_held )
+{
+    typedef tx::Image_Memory<tx::PixelGray_u16> image_type;
+    const size_t cols = 64, rows = 16;
+
+    auto image = std::make_shared<image_type>( cols, rows );
+    for( size_t r = 0; r < rows; r++ )
+    for( size_t c = 0; c < cols; c++ )
+    {
+        ( *image )( c, r ) = tx::PixelGray_u16( uint16_t( ( c * 61 + r * 7 ) % 4096 ) );
+    }
+
+    // 12-bit values pack, so the block shrinks to 1.5 bytes per value once generated
+    tx::ops::block::Block_Generator<image_type> generator( image,
+                                                           tmns::math::Rect2i( 0, 0, cols, rows ),
+                                                           tx::Channel_Type_Enum::UINT12 );
+    ASSERT_EQ( generator.size_bytes(), cols * rows * 2 );
+    auto block = generator.generate();
+    ASSERT_TRUE( block->is_packed() );
+    ASSERT_EQ( generator.size_bytes(), block->size_bytes() );
+    ASSERT_EQ( generator.size_bytes(), cols * 3 / 2 * rows );
+    ASSERT_EQ( ( *block )( 5, 3 ), ( *image )( 5, 3 ) );
+
+    // One value too wide for 12 bits keeps the whole block unpacked, and the size says so
+    ( *image )( 10, 10 ) = tx::PixelGray_u16( 5000 );
+    tx::ops::block::Block_Generator<image_type> wide_generator( image,
+                                                                tmns::math::Rect2i( 0, 0, cols, rows ),
+                                                                tx::Channel_Type_Enum::UINT12 );
+    auto wide_block = wide_generator.generate();
+    ASSERT_FALSE( wide_block->is_packed() );
+    ASSERT_EQ( wide_generator.size_bytes(), cols * rows * 2 );
+    ASSERT_EQ( ( *wide_block )( 10, 10 ), tx::PixelGray_u16( 5000 ) );
+}
@@ -0,0 +1,139 @@
+/**
+ * @file    TEST_Block_Halo.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/block/Block_Halo.hpp>
+#include <terminus/image/operations/block/Block_Processor.hpp>
+#include <terminus/image/operations/block/Block_Rasterize_View.hpp>
+#include <terminus/image/operations/crop_image.hpp>
+#include <terminus/image/operations/filter/Separable_Convolution_View.hpp>
+#include <terminus/image/operations/image_math.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+// C++ Libraries
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace tx = tmns::image;
+
+/**
+ * Records every block and halo bbox it is called with
+*/
+class Halo_Recorder
+{
+    public:
+
+        struct Calls
+        {
+            std::mutex mtx;
+            std::vector<std::pair<tmns::math::Rect2i,tmns::math::Rect2i>> bboxes;
+        };
+
+        Halo_Recorder()
+          : m_calls( std::make_shared<Calls>() )
+        {}
+
+        void operator()( const tmns::math::Rect2i& bbox,
+                         const tmns::math::Rect2i& halo_bbox ) const
+        {
+            std::lock_guard<std::mutex> lock( m_calls->mtx );
+            m_calls->bboxes.push_back( { bbox, halo_bbox } );
+        }
+
+        const Calls& calls() const { return *m_calls; }
+
+        static std::string full_name() { return "Halo_Recorder"; }
+
+    private:
+
+        std::shared_ptr<Calls> m_calls;
+};
+
+/****************************************************/
+/*      Halo Arithmetic and Propagation             */
+/****************************************************/
+TEST( ops_Block_Halo, propagation )
+{
+    tx::ops::block::Halo halo( 1, 2, 3, 4 );
+    auto grown = halo.expand( tmns::math::Rect2i( 10, 20, 5, 6 ) );
+    EXPECT_EQ( grown.min().x(), 9 );
+    EXPECT_EQ( grown.min().y(), 18 );
+    EXPECT_EQ( grown.width(),  9 );
+    EXPECT_EQ( grown.height(), 12 );
+
+    EXPECT_EQ( halo + tx::ops::block::Halo( 1 ), tx::ops::block::Halo( 2, 3, 4, 5 ) );
+    EXPECT_EQ( tx::ops::block::Halo::merge( halo, tx::ops::block::Halo( 2 ) ),
+               tx::ops::block::Halo( 2, 2, 3, 4 ) );
+
+    tx::Image_Memory<float> image( 40, 30 );
+    EXPECT_TRUE( tx::ops::block::image_halo( image ).empty() );
+
+    // Neighborhood views add their reach, per-pixel views and crops pass it through
+    auto blur  = tx::box_blur( image, 5 );
+    auto twice = tx::gaussian_blur( blur, 1.0 );
+    EXPECT_EQ( tx::ops::block::image_halo( blur ),  tx::ops::block::Halo( 2 ) );
+    EXPECT_EQ( tx::ops::block::image_halo( twice ), tx::ops::block::Halo( 5 ) );
+    EXPECT_EQ( tx::ops::block::image_halo( blur - image ), tx::ops::block::Halo( 2 ) );
+    EXPECT_EQ( tx::ops::block::image_halo( tx::crop_image( twice, 5, 5, 10, 10 ) ),
+               tx::ops::block::Halo( 5 ) );
+}
+
+/****************************************************/
+/*      Processor Hands Out Clipped Halo Regions    */
+/****************************************************/
+TEST( ops_Block_Halo, processor_halo_bbox )
+{
+    Halo_Recorder recorder;
+    tmns::math::Rect2i bounds( 0, 0, 50, 40 );
+    tx::ops::block::Block_Processor<Halo_Recorder> process( recorder,
+                                                            tmns::math::Size2i( { 16, 16 } ),
+                                                            tx::ops::block::Halo( 3 ),
+                                                            bounds,
+                                                            2 );
+    process( bounds );
+
+    // 4 x 3 blocks
+    ASSERT_EQ( recorder.calls().bboxes.size(), 12 );
+    for( const auto& [bbox, halo_bbox] : recorder.calls().bboxes )
+    {
+        auto expected = tmns::math::Rect2i::intersection( tx::ops::block::Halo( 3 ).expand( bbox ),
+                                                          bounds );
+        ASSERT_EQ( halo_bbox.min().x(), expected.min().x() );
+        ASSERT_EQ( halo_bbox.min().y(), expected.min().y() );
+        ASSERT_EQ( halo_bbox.width(),   expected.width() );
+        ASSERT_EQ( halo_bbox.height(),  expected.height() );
+    }
+}
+
+/****************************************************/
+/*      Blocked Neighborhood Views Have No Seams    */
+/****************************************************/
+TEST( ops_Block_Halo, block_rasterize_view )
+{
+    tx::Image_Memory<float> image( 67, 45 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = float( ( c * 13 + r * 7 ) % 31 );
+    }
+
+    auto view = tx::gaussian_blur( image, 1.5 ) - image;
+    tx::Image_Memory<float> expected = view;
+
+    tx::ops::Block_Rasterize_View<decltype(view)> blocked( view,
+                                                           tmns::math::Size2i( { 16, 16 } ),
+                                                           4 );
+    EXPECT_EQ( blocked.halo(), tx::ops::block::Halo( 5 ) );
+
+    tx::Image_Memory<float> result = blocked;
+    for( size_t r = 0; r < result.rows(); r++ )
+    for( size_t c = 0; c < result.cols(); c++ )
+    {
+        ASSERT_FLOAT_EQ( result( c, r ), expected( c, r ) );
+    }
+}
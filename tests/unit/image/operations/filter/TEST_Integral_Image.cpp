@@ -0,0 +1,187 @@
+/**
+ * @file    TEST_Integral_Image.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/filter/Integral_Box_Filter_View.hpp>
+#include <terminus/image/operations/filter/Integral_Image.hpp>
+#include <terminus/image/operations/filter/Separable_Convolution_View.hpp>
+#include <terminus/image/pixel/Pixel_RGB.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+// C++ Libraries
+#include <cstdint>
+#include <type_traits>
+
+namespace tx = tmns::image;
+
+/**
+ * Brute-force sum of one channel over a region, clipped to the image
+*/
+static double region_sum( const tx::Image_Memory<tx::PixelRGB_u8>& image,
+                          int x0, int y0, int width, int height,
+                          size_t ch,
+                          bool squared = false )
+{
+    double sum = 0;
+    for( int r = std::max( y0, 0 ); r < std::min( y0 + height, int( image.rows() ) ); r++ )
+    for( int c = std::max( x0, 0 ); c < std::min( x0 + width,  int( image.cols() ) ); c++ )
+    {
+        double value = image( c, r )[ch];
+        sum += squared ? value * value : value;
+    }
+    return sum;
+}
+
+/****************************************************/
+/*      Region Queries Match Brute Force            */
+/****************************************************/
+TEST( ops_Integral_Image, region_queries )
+{
+    tx::Image_Memory<tx::PixelRGB_u8> image( 53, 37 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = tx::PixelRGB_u8( ( c * 37 + r * 11 ) % 256,
+                                         ( c * r ) % 256,
+                                         ( c + r ) % 2 ? 255 : 0 );
+    }
+
+    // Uneven bands across threads
+    auto integral = tx::integral_image( image, true, 5 );
+    ASSERT_EQ( integral->cols(), 53 );
+    ASSERT_EQ( integral->rows(), 37 );
+    ASSERT_TRUE( integral->has_squares() );
+
+    const int boxes[][4] = { { 0, 0, 53, 37 }, { 3, 4, 10, 9 }, { 20, 8, 1, 1 },
+                             { 40, 30, 20, 20 }, { -5, -5, 8, 12 }, { 0, 36, 53, 1 } };
+    for( const auto& box : boxes )
+    {
+        tmns::math::Rect2i bbox( box[0], box[1], box[2], box[3] );
+        double n = double( integral->count( bbox ) );
+        for( size_t ch = 0; ch < 3; ch++ )
+        {
+            double sum = region_sum( image, box[0], box[1], box[2], box[3], ch );
+            double sq  = region_sum( image, box[0], box[1], box[2], box[3], ch, true );
+            ASSERT_EQ( integral->sum( bbox, 0, ch ), int64_t( sum ) );
+            ASSERT_EQ( integral->sum_squares( bbox, 0, ch ), int64_t( sq ) );
+            ASSERT_NEAR( integral->mean( bbox, 0, ch ), sum / n, 1e-9 );
+            ASSERT_NEAR( integral->variance( bbox, 0, ch ), sq / n - ( sum / n ) * ( sum / n ), 1e-6 );
+        }
+    }
+
+    // Regions off the image are empty
+    tmns::math::Rect2i outside( 60, 0, 5, 5 );
+    EXPECT_EQ( integral->count( outside ), 0 );
+    EXPECT_EQ( integral->sum( outside ), 0 );
+    EXPECT_EQ( integral->mean( outside ), 0 );
+
+    // No squares, no variance
+    auto plain = tx::integral_image( image );
+    EXPECT_THROW( plain->variance( outside ), std::runtime_error );
+}
+
+/****************************************************/
+/*      Thread Count Does Not Change the Table      */
+/****************************************************/
+TEST( ops_Integral_Image, thread_counts )
+{
+    tx::Image_Memory<float> image( 31, 64 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = float( ( c * 7 + r * 3 ) % 17 ) - 8.f;
+    }
+
+    auto serial = tx::integral_image( image, false, 1 );
+    for( size_t threads : { 2, 3, 8, 100 } )
+    {
+        auto parallel = tx::integral_image( image, false, threads );
+        for( size_t r = 0; r <= image.rows(); r++ )
+        for( size_t c = 0; c <= image.cols(); c++ )
+        {
+            ASSERT_DOUBLE_EQ( parallel->table( c, r ), serial->table( c, r ) );
+        }
+    }
+}
+
+/****************************************************/
+/*      Wide Channels Accumulate in Double          */
+/****************************************************/
+TEST( ops_Integral_Image, wide_channels )
+{
+    static_assert( std::is_same_v<tx::ops::detail::Integral_Accum_Type<uint8_t>,int64_t> );
+    static_assert( std::is_same_v<tx::ops::detail::Integral_Accum_Type<int16_t>,int64_t> );
+    static_assert( std::is_same_v<tx::ops::detail::Integral_Accum_Type<uint32_t>,double> );
+    static_assert( std::is_same_v<tx::ops::detail::Integral_Accum_Type<float>,double> );
+
+    // Squares of these would wrap a 64-bit integer sum many times over
+    const uint32_t value = 4000000000u;
+    tx::Image_Memory<uint32_t> image( 8, 8 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = value;
+    }
+
+    auto integral = tx::integral_image( image, true, 2 );
+    tmns::math::Rect2i bbox( 0, 0, 8, 8 );
+    const double expected_squares = 64.0 * double( value ) * double( value );
+    ASSERT_NEAR( integral->sum_squares( bbox ), expected_squares, expected_squares * 1e-12 );
+    ASSERT_DOUBLE_EQ( integral->mean( bbox ), double( value ) );
+}
+
+/****************************************************/
+/*      Box Filter Matches the Separable Blur       */
+/****************************************************/
+TEST( ops_Integral_Image, box_filter )
+{
+    tx::Image_Memory<float> image( 48, 40 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = float( ( c * 13 + r * 7 ) % 31 );
+    }
+
+    tx::Image_Memory<float> fast = tx::integral_box_filter( image, 7 );
+    tx::Image_Memory<float> slow = tx::box_blur( image, 7 );
+
+    // Away from the edges the windows are identical
+    for( size_t r = 3; r < 37; r++ )
+    for( size_t c = 3; c < 45; c++ )
+    {
+        ASSERT_NEAR( fast( c, r ), slow( c, r ), 1e-3 );
+    }
+
+    // At the edges the window only covers the image
+    double corner = 0;
+    for( size_t r = 0; r < 4; r++ )
+    for( size_t c = 0; c < 4; c++ )
+    {
+        corner += image( c, r );
+    }
+    EXPECT_NEAR( fast( 0, 0 ), corner / 16, 1e-4 );
+
+    // A constant image has no variance, and windows can share one table
+    tx::Image_Memory<uint8_t> flat( 20, 20 );
+    for( size_t r = 0; r < flat.rows(); r++ )
+    for( size_t c = 0; c < flat.cols(); c++ )
+    {
+        flat( c, r ) = 42;
+    }
+    auto integral = tx::integral_image( flat, true );
+    tx::Image_Memory<double>  variance = tx::integral_variance_filter( integral, tmns::math::Size2i( { 5, 3 } ) );
+    tx::Image_Memory<uint8_t> mean     = tx::integral_box_filter( integral, tmns::math::Size2i( { 9, 9 } ) );
+    for( size_t r = 0; r < flat.rows(); r++ )
+    for( size_t c = 0; c < flat.cols(); c++ )
+    {
+        ASSERT_DOUBLE_EQ( variance( c, r ), 0 );
+        ASSERT_EQ( mean( c, r ), 42 );
+    }
+
+    EXPECT_THROW( tx::integral_variance_filter( tx::integral_image( flat ), tmns::math::Size2i( { 3, 3 } ) ),
+                  std::runtime_error );
+}
@@ -0,0 +1,191 @@
+/**
+ * @file    TEST_Morphology_View.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/filter/Morphology_View.hpp>
+#include <terminus/image/pixel/Pixel_Mask.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <limits>
+
+namespace tx = tmns::image;
+
+/**
+ * Brute-force min or max over the window at a pixel, ignoring pixels off the image
+*/
+static float window_extreme( const tx::Image_Memory<float>& image,
+                             int c, int r,
+                             int before_x, int after_x,
+                             int before_y, int after_y,
+                             bool minimum )
+{
+    float result = minimum ? std::numeric_limits<float>::max() : std::numeric_limits<float>::lowest();
+    for( int y = std::max( r - before_y, 0 ); y <= std::min( r + after_y, int( image.rows() ) - 1 ); y++ )
+    for( int x = std::max( c - before_x, 0 ); x <= std::min( c + after_x, int( image.cols() ) - 1 ); x++ )
+    {
+        result = minimum ? std::min( result, image( x, y ) ) : std::max( result, image( x, y ) );
+    }
+    return result;
+}
+
+/****************************************************/
+/*      Erosion and Dilation Match Brute Force      */
+/****************************************************/
+TEST( ops_Morphology_View, erode_dilate )
+{
+    tx::Image_Memory<float> image( 71, 53 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = float( ( c * 37 + r * 11 + c * r ) % 101 );
+    }
+
+    // Even sizes, and tiles smaller than the element
+    const int sizes[][2] = { { 1, 1 }, { 3, 3 }, { 4, 7 }, { 9, 2 }, { 25, 25 } };
+    for( const auto& size : sizes )
+    {
+        tmns::math::Size2i element( { size[0], size[1] } );
+        int bx = size[0] / 2, ax = size[0] - 1 - bx;
+        int by = size[1] / 2, ay = size[1] - 1 - by;
+
+        tx::Image_Memory<float> eroded  = tx::morphology( image, tx::ops::Morphology_Op::ERODE,  element,
+                                                          tmns::math::Size2i( { 16, 8 } ), 3 );
+        tx::Image_Memory<float> dilated = tx::morphology( image, tx::ops::Morphology_Op::DILATE, element,
+                                                          tmns::math::Size2i( { 16, 8 } ), 3 );
+        for( int r = 0; r < int( image.rows() ); r++ )
+        for( int c = 0; c < int( image.cols() ); c++ )
+        {
+            ASSERT_EQ( eroded( c, r ),  window_extreme( image, c, r, bx, ax, by, ay, true ) );
+            ASSERT_EQ( dilated( c, r ), window_extreme( image, c, r, ax, bx, ay, by, false ) );
+        }
+    }
+
+    auto view = tx::erode( image, tmns::math::Size2i( { 5, 3 } ) );
+    EXPECT_EQ( view.halo(), tx::ops::block::Halo( 2, 1, 2, 1 ) );
+    EXPECT_EQ( view( 10, 10 ), window_extreme( image, 10, 10, 2, 2, 1, 1, true ) );
+    EXPECT_EQ( tx::opening( image, tmns::math::Size2i( { 5, 3 } ) ).halo(),
+               tx::ops::block::Halo( 4, 2, 4, 2 ) );
+
+    EXPECT_THROW( tx::erode( image, tmns::math::Size2i( { 0, 3 } ) ), std::runtime_error );
+}
+
+/****************************************************/
+/*      Opening and Closing                         */
+/****************************************************/
+TEST( ops_Morphology_View, opening_closing )
+{
+    tx::Image_Memory<uint8_t> image( 60, 45 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = uint8_t( ( c * 29 + r * 17 + ( c ^ r ) ) % 251 );
+    }
+
+    for( int size : { 3, 4, 7 } )
+    {
+        tmns::math::Size2i element( { size, size } );
+        tx::Image_Memory<uint8_t> opened = tx::opening( image, element );
+        tx::Image_Memory<uint8_t> closed = tx::closing( image, element );
+
+        // Same as the two steps rasterized separately
+        tx::Image_Memory<uint8_t> eroded = tx::erode( image, element );
+        tx::Image_Memory<uint8_t> two_step_open = tx::dilate( eroded, element );
+
+        // Idempotent, and opening <= image <= closing
+        tx::Image_Memory<uint8_t> reopened  = tx::opening( opened, element );
+        tx::Image_Memory<uint8_t> reclosed  = tx::closing( closed, element );
+        for( size_t r = 0; r < image.rows(); r++ )
+        for( size_t c = 0; c < image.cols(); c++ )
+        {
+            ASSERT_EQ( opened( c, r ), two_step_open( c, r ) );
+            ASSERT_EQ( reopened( c, r ), opened( c, r ) );
+            ASSERT_EQ( reclosed( c, r ), closed( c, r ) );
+            ASSERT_LE( opened( c, r ), image( c, r ) );
+            ASSERT_GE( closed( c, r ), image( c, r ) );
+        }
+    }
+}
+
+/****************************************************/
+/*      Binary Masks Match the Grayscale Path       */
+/****************************************************/
+TEST( ops_Morphology_View, binary_masks )
+{
+    // Wider than a word, with rows that straddle word boundaries
+    tx::Image_Memory<uint8_t> mask( 150, 41 );
+    for( size_t r = 0; r < mask.rows(); r++ )
+    for( size_t c = 0; c < mask.cols(); c++ )
+    {
+        mask( c, r ) = ( ( c * 7 + r * 13 ) % 11 ) > 2 ? 1 : 0;
+    }
+
+    const tx::ops::Morphology_Op ops[] = { tx::ops::Morphology_Op::ERODE,
+                                           tx::ops::Morphology_Op::DILATE,
+                                           tx::ops::Morphology_Op::OPENING,
+                                           tx::ops::Morphology_Op::CLOSING };
+    const int sizes[][2] = { { 1, 1 }, { 3, 3 }, { 2, 5 }, { 70, 3 }, { 8, 8 } };
+    for( auto op : ops )
+    for( const auto& size : sizes )
+    {
+        tmns::math::Size2i element( { size[0], size[1] } );
+        tx::Image_Memory<uint8_t> gray   = tx::morphology( mask, op, element );
+        tx::Image_Memory<uint8_t> binary = tx::binary_morphology( mask, op, element,
+                                                                  tmns::math::Size2i( { 64, 16 } ), 2 );
+        for( size_t r = 0; r < mask.rows(); r++ )
+        for( size_t c = 0; c < mask.cols(); c++ )
+        {
+            ASSERT_EQ( binary( c, r ), gray( c, r ) );
+        }
+    }
+
+    // Any non-zero value is foreground, and the result is 0 / 1
+    tx::Image_Memory<uint8_t> cloud( 10, 10 );
+    for( size_t r = 0; r < cloud.rows(); r++ )
+    for( size_t c = 0; c < cloud.cols(); c++ )
+    {
+        cloud( c, r ) = ( c == 5 && r == 5 ) ? 200 : 0;
+    }
+    tx::Image_Memory<uint8_t> grown = tx::binary_dilate( cloud, tmns::math::Size2i( { 3, 3 } ) );
+    EXPECT_EQ( grown( 4, 4 ), 1 );
+    EXPECT_EQ( grown( 6, 6 ), 1 );
+    EXPECT_EQ( grown( 7, 5 ), 0 );
+}
+
+/****************************************************/
+/*      Pixel_Mask Validity                         */
+/****************************************************/
+TEST( ops_Morphology_View, pixel_mask_validity )
+{
+    tx::Image_Memory<tx::Pixel_Mask<float>> image( 20, 12 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = tx::Pixel_Mask<float>( float( c + r ) );
+
+        // One invalid pixel
+        if( c == 10 && r == 6 )
+        {
+            image( c, r ).invalidate();
+        }
+    }
+
+    // The hole grows, values stay untouched, and the image edges do not erode
+    tx::Image_Memory<tx::Pixel_Mask<float>> eroded = tx::binary_erode( image, tmns::math::Size2i( { 3, 3 } ) );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        bool near_hole = ( c >= 9 && c <= 11 && r >= 5 && r <= 7 );
+        ASSERT_EQ( tx::is_valid( eroded( c, r ) ), !near_hole );
+        ASSERT_EQ( eroded( c, r ).child(), float( c + r ) );
+    }
+
+    // Closing fills it back in
+    tx::Image_Memory<tx::Pixel_Mask<float>> closed = tx::binary_closing( image, tmns::math::Size2i( { 3, 3 } ) );
+    EXPECT_TRUE( tx::is_valid( closed( 10, 6 ) ) );
+}
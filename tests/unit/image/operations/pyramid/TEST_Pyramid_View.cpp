@@ -0,0 +1,136 @@
+/**
+ * @file    TEST_Pyramid_View.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/crop_image.hpp>
+#include <terminus/image/operations/pyramid/Pyramid_View.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+// Terminus Unit-Test Libraries
+#include "../../../UNIT_TEST_ONLY/Test_Images.hpp"
+
+namespace tx = tmns::image;
+
+/****************************************************/
+/*      Level Sizes                                 */
+/****************************************************/
+TEST( ops_Pyramid_View, level_sizes )
+{
+    auto image = make_ramp( 33, 20 );
+    tx::ops::Pyramid_View<tx::Image_Memory<float>> pyramid( image, nullptr );
+
+    // 33x20, 17x10, 9x5, 5x3, 3x2, 2x1, 1x1
+    ASSERT_EQ( pyramid.num_levels(), 7 );
+    EXPECT_EQ( pyramid.level( 1 ).cols(), 17 );
+    EXPECT_EQ( pyramid.level( 1 ).rows(), 10 );
+    EXPECT_EQ( pyramid.level( 3 ).cols(), 5 );
+    EXPECT_EQ( pyramid.level( 3 ).rows(), 3 );
+    EXPECT_EQ( pyramid.level( 6 ).cols(), 1 );
+    EXPECT_EQ( pyramid.level( 6 ).rows(), 1 );
+    EXPECT_THROW( pyramid.level( 7 ), std::runtime_error );
+
+    tx::ops::Pyramid_View<tx::Image_Memory<float>> short_pyramid( image, nullptr, tx::ops::Pyramid_Filter::BOX, 3 );
+    EXPECT_EQ( short_pyramid.num_levels(), 3 );
+}
+
+/****************************************************/
+/*      Box and Gaussian Reduction                  */
+/****************************************************/
+TEST( ops_Pyramid_View, reduction )
+{
+    auto image = make_ramp( 32, 32 );
+
+    // Box filter averages each 2x2 block
+    tx::Image_Memory<float> box = tx::reduce_image( image, tx::ops::Pyramid_Filter::BOX );
+    ASSERT_EQ( box.cols(), 16 );
+    for( size_t r = 0; r < box.rows(); r++ )
+    for( size_t c = 0; c < box.cols(); c++ )
+    {
+        ASSERT_FLOAT_EQ( box( c, r ), ( 2 * c + 0.5f ) + 100 * ( 2 * r + 0.5f ) );
+    }
+
+    // Symmetric kernel keeps a ramp centered on the even pixels, away from the edges
+    tx::Image_Memory<float> gaussian = tx::reduce_image( image );
+    for( size_t r = 1; r < 15; r++ )
+    for( size_t c = 1; c < 15; c++ )
+    {
+        ASSERT_FLOAT_EQ( gaussian( c, r ), image( 2 * c, 2 * r ) );
+    }
+}
+
+/****************************************************/
+/*      Cached Levels Match Direct Computation      */
+/****************************************************/
+TEST( ops_Pyramid_View, cached_matches_direct )
+{
+    auto image = make_ramp( 150, 97 );
+    auto cache = std::make_shared<tmns::core::cache::Cache_Local>( 100000000 );
+
+    tx::ops::Pyramid_View<tx::Image_Memory<float>> direct( image, nullptr );
+    tx::ops::Pyramid_View<tx::Image_Memory<float>> cached( image,
+                                                           cache,
+                                                           tx::ops::Pyramid_Filter::GAUSSIAN,
+                                                           0,
+                                                           tmns::math::Size2i( { 16, 8 } ) );
+
+    for( size_t k = 0; k < direct.num_levels(); k++ )
+    {
+        tx::Image_Memory<float> expected = direct.level( k );
+        tx::Image_Memory<float> result   = cached.level( k );
+        ASSERT_EQ( result.cols(), expected.cols() );
+        ASSERT_EQ( result.rows(), expected.rows() );
+        for( size_t r = 0; r < result.rows(); r++ )
+        for( size_t c = 0; c < result.cols(); c++ )
+        {
+            ASSERT_EQ( result( c, r ), expected( c, r ) );
+            ASSERT_EQ( cached.level( k )( c, r ), expected( c, r ) );
+        }
+    }
+
+    // Cropped regions of a level straddle blocks
+    auto level = cached.level( 2 );
+    tx::Image_Memory<float> full = level;
+    tx::Image_Memory<float> crop = tx::crop_image( level, 5, 3, 20, 15 );
+    for( size_t r = 0; r < crop.rows(); r++ )
+    for( size_t c = 0; c < crop.cols(); c++ )
+    {
+        ASSERT_EQ( crop( c, r ), full( c + 5, r + 3 ) );
+    }
+}
+
+/****************************************************/
+/*      Blocks Are Shared Between Consumers         */
+/****************************************************/
+TEST( ops_Pyramid_View, blocks_are_shared )
+{
+    Counting_View base( make_ramp( 128, 128 ) );
+    auto cache = std::make_shared<tmns::core::cache::Cache_Local>( 100000000 );
+
+    tx::ops::Pyramid_View<Counting_View> pyramid( base,
+                                                  cache,
+                                                  tx::ops::Pyramid_Filter::BOX,
+                                                  0,
+                                                  tmns::math::Size2i( { 8, 8 } ) );
+
+    // Only the base pixels under the requested block of level 2 are read
+    tx::Image_Memory<float> corner = tx::crop_image( pyramid.level( 2 ), 0, 0, 8, 8 );
+    size_t first_read = base.pixels_read();
+    EXPECT_GT( first_read, 0 );
+    EXPECT_LE( first_read, 32 * 32 );
+
+    // A second consumer, and the finer level it was built from, reuse the cached blocks
+    auto copy = pyramid;
+    tx::Image_Memory<float> again = tx::crop_image( copy.level( 2 ), 0, 0, 8, 8 );
+    tx::Image_Memory<float> level1 = tx::crop_image( copy.level( 1 ), 0, 0, 16, 16 );
+    EXPECT_EQ( base.pixels_read(), first_read );
+
+    for( size_t r = 0; r < 8; r++ )
+    for( size_t c = 0; c < 8; c++ )
+    {
+        ASSERT_EQ( again( c, r ), corner( c, r ) );
+    }
+}
@@ -0,0 +1,263 @@
+/**
+ * @file    TEST_Transform_View.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/transform/Transform_View.hpp>
+#include <terminus/image/pixel/Pixel_RGB.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+// C++ Libraries
+#include <cmath>
+
+// Terminus Unit-Test Libraries
+#include "../../../UNIT_TEST_ONLY/Test_Images.hpp"
+
+namespace tx = tmns::image;
+
+/****************************************************/
+/*      Integer Translation Shifts Pixels           */
+/****************************************************/
+TEST( ops_Transform_View, integer_translation )
+{
+    auto image = make_ramp( 20, 15 );
+
+    // Destination (c,r) reads source (c-3,r-2)
+    auto view = tx::transform( image,
+                               tx::ops::Affine_Transform::translate( 3, 2 ),
+                               image.cols(),
+                               image.rows(),
+                               tx::ops::Nearest_Interpolation(),
+                               tx::ops::Constant_Edge<float>( -1 ) );
+    tx::Image_Memory<float> result = view;
+
+    for( size_t r = 0; r < result.rows(); r++ )
+    for( size_t c = 0; c < result.cols(); c++ )
+    {
+        if( c < 3 || r < 2 )
+        {
+            ASSERT_EQ( result( c, r ), -1 );
+        }
+        else
+        {
+            ASSERT_EQ( result( c, r ), image( c - 3, r - 2 ) );
+        }
+    }
+}
+
+/****************************************************/
+/*      Interpolators Reproduce a Ramp              */
+/****************************************************/
+TEST( ops_Transform_View, interpolation )
+{
+    auto image = make_ramp( 32, 32 );
+    auto shift = tx::ops::Affine_Transform::translate( -0.5, -0.25 );
+
+    // Linear data is reproduced exactly by bilinear and bicubic away from the edges
+    tx::Image_Memory<float> bilinear = tx::transform( image, shift, 32, 32 );
+    tx::Image_Memory<float> bicubic  = tx::transform( image, shift, 32, 32,
+                                                      tx::ops::Bicubic_Interpolation(),
+                                                      tx::ops::Extend_Edge() );
+    for( size_t r = 2; r < 28; r++ )
+    for( size_t c = 2; c < 28; c++ )
+    {
+        float expected = ( c + 0.5f ) + 100 * ( r + 0.25f );
+        ASSERT_NEAR( bilinear( c, r ), expected, 1e-3 );
+        ASSERT_NEAR( bicubic( c, r ),  expected, 1e-3 );
+    }
+}
+
+/****************************************************/
+/*      Integer Pixels Round and Saturate           */
+/****************************************************/
+TEST( ops_Transform_View, integer_channels )
+{
+    tx::Image_Memory<tx::PixelRGB_u8> image( 8, 8 );
+    for( size_t r = 0; r < 8; r++ )
+    for( size_t c = 0; c < 8; c++ )
+    {
+        image( c, r ) = ( c < 4 ) ? tx::PixelRGB_u8( 0, 10, 255 ) : tx::PixelRGB_u8( 255, 11, 0 );
+    }
+
+    tx::Image_Memory<tx::PixelRGB_u8> result = tx::transform( image,
+                                                              tx::ops::Affine_Transform::translate( -0.5, 0 ),
+                                                              8, 8,
+                                                              tx::ops::Bicubic_Interpolation(),
+                                                              tx::ops::Extend_Edge() );
+
+    // Halfway across the step
+    EXPECT_EQ( result( 3, 4 )[0], 128 );
+    EXPECT_EQ( result( 3, 4 )[2], 128 );
+
+    // Overshoot next to the step stays in range
+    for( size_t c = 0; c < 8; c++ )
+    {
+        EXPECT_GE( result( c, 4 )[1], 10 );
+        EXPECT_LE( result( c, 4 )[1], 11 );
+    }
+}
+
+/****************************************************/
+/*      Edge Modes                                  */
+/****************************************************/
+TEST( ops_Transform_View, edge_modes )
+{
+    auto image = make_ramp( 4, 3 );
+    auto shift = tx::ops::Affine_Transform::translate( 2, 0 );
+    tx::ops::Nearest_Interpolation nearest;
+
+    tx::Image_Memory<float> extend   = tx::transform( image, shift, 4, 3, nearest, tx::ops::Extend_Edge() );
+    tx::Image_Memory<float> periodic = tx::transform( image, shift, 4, 3, nearest, tx::ops::Periodic_Edge() );
+    tx::Image_Memory<float> reflect  = tx::transform( image, shift, 4, 3, nearest, tx::ops::Reflect_Edge() );
+    tx::Image_Memory<float> zero     = tx::transform( image, shift, 4, 3, nearest, tx::ops::Constant_Edge<float>() );
+
+    // Destination columns 0 and 1 read source columns -2 and -1
+    EXPECT_EQ( extend( 0, 1 ),   image( 0, 1 ) );
+    EXPECT_EQ( extend( 1, 1 ),   image( 0, 1 ) );
+    EXPECT_EQ( periodic( 0, 1 ), image( 2, 1 ) );
+    EXPECT_EQ( periodic( 1, 1 ), image( 3, 1 ) );
+    EXPECT_EQ( reflect( 0, 1 ),  image( 2, 1 ) );
+    EXPECT_EQ( reflect( 1, 1 ),  image( 1, 1 ) );
+    EXPECT_EQ( zero( 0, 1 ),     0 );
+    EXPECT_EQ( zero( 1, 1 ),     0 );
+    EXPECT_EQ( zero( 2, 1 ),     image( 0, 1 ) );
+}
+
+/****************************************************/
+/*      Edge Blocks Only Read What They Sample      */
+/****************************************************/
+TEST( ops_Transform_View, edge_block_reads )
+{
+    Counting_View image( make_ramp( 600, 400 ) );
+    auto shift = tx::ops::Affine_Transform::translate( 3, 2 );
+
+    // Destination (c,r) reads source (c-3,r-2), so the corner block wraps around
+    auto periodic = tx::transform( image, shift, 600, 400,
+                                   tx::ops::Bilinear_Interpolation(),
+                                   tx::ops::Periodic_Edge(),
+                                   tmns::math::Size2i( { 32, 32 } ),
+                                   1 );
+    image.reset();
+    tx::Image_Memory<float> wrapped = tx::crop_image( periodic, 0, 0, 32, 32 );
+    EXPECT_GT( image.pixels_read(), 0 );
+    EXPECT_LE( image.pixels_read(), 40 * 40 );
+    for( size_t r = 0; r < 32; r++ )
+    for( size_t c = 0; c < 32; c++ )
+    {
+        ASSERT_NEAR( wrapped( c, r ), float( ( c + 597 ) % 600 + 100 * ( ( r + 398 ) % 400 ) ), 1e-2 );
+    }
+
+    auto reflect = tx::transform( image, shift, 600, 400,
+                                  tx::ops::Bilinear_Interpolation(),
+                                  tx::ops::Reflect_Edge(),
+                                  tmns::math::Size2i( { 32, 32 } ),
+                                  1 );
+    image.reset();
+    tx::Image_Memory<float> mirrored = tx::crop_image( reflect, 0, 0, 32, 32 );
+    EXPECT_GT( image.pixels_read(), 0 );
+    EXPECT_LE( image.pixels_read(), 40 * 40 );
+    EXPECT_NEAR( mirrored( 0, 0 ), 3 + 100 * 2, 1e-2 );
+    EXPECT_NEAR( mirrored( 5, 5 ), 2 + 100 * 3, 1e-2 );
+}
+
+/****************************************************/
+/*      Parallel Blocks Match Per-Pixel Evaluation  */
+/****************************************************/
+TEST( ops_Transform_View, blocks_match_pixels )
+{
+    auto image = make_ramp( 150, 120 );
+
+    // Perspective warp, so the block footprints come from sampling the transform
+    tx::ops::Homography_Transform homography( { 0.9,    0.15,  5,
+                                               -0.1,    1.05, -3,
+                                                0.0004, 0.0002, 1 } );
+    auto view = tx::transform( image,
+                               homography,
+                               170, 130,
+                               tx::ops::Bilinear_Interpolation(),
+                               tx::ops::Reflect_Edge(),
+                               tmns::math::Size2i( { 32, 24 } ),
+                               4 );
+    tx::Image_Memory<float> result = view;
+
+    for( size_t r = 0; r < result.rows(); r++ )
+    for( size_t c = 0; c < result.cols(); c++ )
+    {
+        ASSERT_EQ( result( c, r ), view( c, r ) );
+    }
+
+    // A crop of the view rasterizes the same pixels
+    tx::Image_Memory<float> crop = tx::crop_image( view, 40, 30, 70, 50 );
+    for( size_t r = 0; r < crop.rows(); r++ )
+    for( size_t c = 0; c < crop.cols(); c++ )
+    {
+        ASSERT_EQ( crop( c, r ), result( c + 40, r + 30 ) );
+    }
+}
+
+/****************************************************/
+/*      Far-Away Footprints Stay In Range           */
+/****************************************************/
+TEST( ops_Transform_View, huge_footprint )
+{
+    auto image = make_ramp( 16, 16 );
+
+    // Destination pixels land billions of pixels apart in the source
+    auto view = tx::transform( image,
+                               tx::ops::Affine_Transform::scale( 1e-9, 1e-9 ),
+                               8, 8,
+                               tx::ops::Bilinear_Interpolation(),
+                               tx::ops::Periodic_Edge() );
+    for( const auto& region : view.source_footprint( tmns::math::Rect2i( 0, 0, 8, 8 ) ) )
+    {
+        ASSERT_GE( region.width(),  0 );
+        ASSERT_GE( region.height(), 0 );
+        ASSERT_LE( region.min().x() + region.width(),  16 );
+        ASSERT_LE( region.min().y() + region.height(), 16 );
+    }
+
+    tx::Image_Memory<float> result = view;
+    for( size_t r = 0; r < result.rows(); r++ )
+    for( size_t c = 0; c < result.cols(); c++ )
+    {
+        ASSERT_EQ( result( c, r ), view( c, r ) );
+    }
+}
+
+/****************************************************/
+/*      Functor Transforms                          */
+/****************************************************/
+TEST( ops_Transform_View, functor_transform )
+{
+    auto image = make_ramp( 16, 16 );
+
+    // Mirror left to right, with a hole where the model has no answer
+    auto mirror = tx::ops::functor_transform( []( const tmns::math::Point2d& pt ) {
+        if( pt.y() == 0 )
+        {
+            double nan = std::nan( "" );
+            return tmns::math::Point2d( { nan, nan } );
+        }
+        return tmns::math::Point2d( { 15 - pt.x(), pt.y() } );
+    });
+
+    auto view = tx::transform( image, mirror, 16, 16,
+                               tx::ops::Nearest_Interpolation(),
+                               tx::ops::Constant_Edge<float>( -1 ),
+                               tmns::math::Size2i( { 8, 8 } ),
+                               2 );
+    tx::Image_Memory<float> result = view;
+
+    for( size_t c = 0; c < 16; c++ )
+    {
+        EXPECT_EQ( result( c, 0 ), 0 );
+    }
+    for( size_t r = 1; r < 16; r++ )
+    for( size_t c = 0; c < 16; c++ )
+    {
+        ASSERT_EQ( result( c, r ), image( 15 - c, r ) );
+    }
+}
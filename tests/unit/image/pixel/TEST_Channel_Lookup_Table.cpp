@@ -0,0 +1,168 @@
+/**
+ * @file    TEST_Channel_Lookup_Table.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Image Libraries
+#include <terminus/image/operations/lookup_table.hpp>
+#include <terminus/image/operations/normalize.hpp>
+#include <terminus/image/operations/pixel_cast.hpp>
+#include <terminus/image/pixel/Channel_Lookup_Table.hpp>
+#include <terminus/image/pixel/convert.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+// C++ Libraries
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace tx = tmns::image;
+
+/****************************************************/
+/*      Lookup Table Matches the Channel Functor    */
+/****************************************************/
+TEST( Channel_Lookup_Table, matches_channel_cast_rescale )
+{
+    auto table = tx::pix::channel_cast_rescale_lookup_table<uint16_t,uint8_t>();
+    tx::pix::Channel_Cast_Rescale_Functor<uint8_t> func;
+    for( size_t i = 0; i < 65536; i++ )
+    {
+        ASSERT_EQ( (*table)( uint16_t( i ) ), func( uint16_t( i ) ) );
+    }
+
+    // Signed sources index by bit pattern
+    auto signed_table = tx::pix::channel_cast_rescale_lookup_table<int8_t,float>();
+    tx::pix::Channel_Cast_Rescale_Functor<float> signed_func;
+    for( int i = -128; i < 128; i++ )
+    {
+        ASSERT_EQ( (*signed_table)( int8_t( i ) ), signed_func( int8_t( i ) ) );
+    }
+
+    // The second request comes from the cache
+    ASSERT_EQ( table, ( tx::pix::channel_cast_rescale_lookup_table<uint16_t,uint8_t>() ) );
+}
+
+/****************************************************/
+/*      Views Produce the Same Pixels as Before     */
+/****************************************************/
+TEST( Channel_Lookup_Table, pixel_cast_and_normalize_views )
+{
+    tx::Image_Memory<tx::PixelRGB_u16> image( 37, 11 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = tx::PixelRGB_u16( uint16_t( c * 1700 ), uint16_t( r * 5000 ), uint16_t( c * r * 97 ) );
+    }
+
+    auto cast_view = tx::ops::pixel_cast_rescale<tx::PixelRGB_u8>( image );
+    tx::ops::Channel_Normalize_Functor<tx::PixelRGB_u16> norm_func( 1000, 40000, 0, 65535 );
+    auto norm_view = tx::ops::normalize( image, 1000, 40000, 0, 65535 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        auto expected = tx::pix::pixel_cast_rescale<tx::PixelRGB_u8>( image( c, r ) );
+        auto actual   = cast_view( c, r );
+        for( int ch = 0; ch < 3; ch++ )
+        {
+            ASSERT_EQ( actual[ch], expected[ch] );
+            ASSERT_EQ( norm_view( c, r )[ch], norm_func( image( c, r )[ch] ) );
+        }
+    }
+}
+
+/****************************************************/
+/*      Tone Curves and Cache Sharing               */
+/****************************************************/
+TEST( Channel_Lookup_Table, tone_curve )
+{
+    tx::Image_Memory<tx::PixelRGB_u8> image( 16, 16 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = tx::PixelRGB_u8( uint8_t( r * 16 + c ), 0, 255 );
+    }
+
+    auto gamma = []( uint8_t value ){ return float( std::pow( value / 255.0, 1.0 / 2.2 ) ); };
+    auto view_01 = tx::ops::tone_curve<float>( image, "gamma", { 2.2 }, gamma );
+    auto view_02 = tx::ops::tone_curve<float>( image, gamma );
+
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        ASSERT_EQ( view_01( c, r )[0], gamma( uint8_t( r * 16 + c ) ) );
+        ASSERT_EQ( view_02( c, r )[0], view_01( c, r )[0] );
+        ASSERT_EQ( view_01( c, r )[2], 1.f );
+    }
+}
+
+/****************************************************/
+/*      Generic convert() Path Uses the Table       */
+/****************************************************/
+TEST( Channel_Lookup_Table, convert_int16_to_float )
+{
+    std::array<int16_t,4> src_data { -32768, -1, 0, 32767 };
+    std::array<float,4>   dst_data { 0, 0, 0, 0 };
+
+    tx::Image_Buffer src( tx::Image_Format( 4, 1, 1, tx::Pixel_Format_Enum::GRAY, tx::Channel_Type_Enum::INT16,   false ), src_data.data() );
+    tx::Image_Buffer dst( tx::Image_Format( 4, 1, 1, tx::Pixel_Format_Enum::GRAY, tx::Channel_Type_Enum::FLOAT32, false ), dst_data.data() );
+
+    ASSERT_FALSE( tx::convert( dst, src, true ).has_error() );
+    for( size_t i = 0; i < src_data.size(); i++ )
+    {
+        float expected;
+        tx::channel_convert_int_to_float( &src_data[i], &expected );
+        ASSERT_EQ( dst_data[i], expected );
+    }
+}
+
+/****************************************************/
+/*      Same Name, Different Table Types            */
+/****************************************************/
+TEST( Channel_Lookup_Table, table_types_do_not_collide )
+{
+    // A user curve under the name convert() uses internally
+    auto invert = []( uint8_t value ){ return uint8_t( 255 - value ); };
+    auto curve  = tx::pix::Channel_Lookup_Table<uint8_t,uint8_t>::cached( "convert", {}, invert );
+
+    tx::pix::Lookup_Table_Key key { tx::Channel_Type_Enum::UINT8,
+                                    tx::Channel_Type_Enum::UINT8,
+                                    "convert",
+                                    {} };
+    auto bytes = tx::pix::Lookup_Table_Cache::instance().get_table<std::vector<uint8_t>>( key, [](){
+        return std::make_shared<std::vector<uint8_t>>( 3, uint8_t( 7 ) );
+    });
+
+    // Each caller gets back the table it built
+    ASSERT_EQ( bytes->size(), 3 );
+    ASSERT_EQ( (*bytes)[0], 7 );
+    ASSERT_EQ( (*curve)( 0 ), 255 );
+    ASSERT_EQ( curve, ( tx::pix::Channel_Lookup_Table<uint8_t,uint8_t>::cached( "convert", {}, invert ) ) );
+}
+
+/****************************************************/
+/*      Normalize Saturates Out-of-Range Values     */
+/****************************************************/
+TEST( Channel_Lookup_Table, normalize_saturates )
+{
+    typedef tx::ops::Channel_Normalize_Functor_Type<tx::PixelGray_u16> norm_type;
+
+    // Values outside the old range would land outside the channel
+    tx::ops::Channel_Normalize_Functor<tx::PixelGray_u16> func( 1000, 2000, 0, 65535 );
+    ASSERT_EQ( func( uint16_t( 500 ) ),   0 );
+    ASSERT_EQ( func( uint16_t( 1500 ) ),  32767 );
+    ASSERT_EQ( func( uint16_t( 60000 ) ), 65535 );
+
+    // Small images compute directly, large ones map through the table
+    auto direct = norm_type::create( 1000, 2000, 0, 65535, 37 * 11 );
+    auto table  = norm_type::create( 1000, 2000, 0, 65535, 65536 );
+    ASSERT_TRUE( direct.table() == nullptr );
+    ASSERT_TRUE( table.table() != nullptr );
+    for( size_t i = 0; i < 65536; i++ )
+    {
+        ASSERT_EQ( direct( uint16_t( i ) ), func( uint16_t( i ) ) );
+        ASSERT_EQ( table( uint16_t( i ) ),  func( uint16_t( i ) ) );
+    }
+}
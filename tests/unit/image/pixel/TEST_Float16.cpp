@@ -0,0 +1,166 @@
+/**
+ * @file    TEST_Float16.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Image Libraries
+#include <terminus/image/pixel/Channel_Cast_Utilities.hpp>
+#include <terminus/image/pixel/Channel_Type_ID.hpp>
+#include <terminus/image/pixel/convert.hpp>
+#include <terminus/image/pixel/Float16.hpp>
+#include <terminus/image/pixel/Pixel_RGB.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+// C++ Libraries
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace tx = tmns::image;
+
+/****************************************************/
+/*      Scalar Conversions                          */
+/****************************************************/
+TEST( Float16, scalar_conversions )
+{
+    // Exactly representable values survive the round trip
+    for( float value : { 0.f, -0.f, 1.f, -2.5f, 0.333251953125f, 65504.f, 6.103515625e-05f, 5.9604645e-08f } )
+    {
+        ASSERT_EQ( float( tx::Float16( value ) ), value );
+    }
+
+    // Rounding and range limits
+    ASSERT_EQ( tx::Float16( 1.f + 1.f / 4096 ).bits(), 0x3C00 );
+    ASSERT_EQ( tx::Float16( 1.f + 3.f / 4096 ).bits(), 0x3C01 );
+    ASSERT_EQ( tx::Float16( 70000.f ).bits(), 0x7C00 );
+    ASSERT_EQ( tx::Float16( -70000.f ).bits(), 0xFC00 );
+    ASSERT_EQ( tx::Float16( 1e-10f ).bits(), 0x0000 );
+    ASSERT_TRUE( std::isnan( float( tx::Float16( std::nanf( "" ) ) ) ) );
+
+    ASSERT_EQ( tx::Channel_Type_ID<tx::Float16>::value, tx::Channel_Type_Enum::FLOAT16 );
+    ASSERT_EQ( tx::channel_size_bytes( tx::Channel_Type_Enum::FLOAT16 ).value(), 2 );
+}
+
+/****************************************************/
+/*      Row Kernels Match the Scalar Version        */
+/****************************************************/
+TEST( Float16, row_kernels )
+{
+    // Every half value, and back again
+    std::vector<tx::Float16> halves( 65536 );
+    for( size_t i = 0; i < halves.size(); i++ )
+    {
+        halves[i] = tx::Float16::from_bits( uint16_t( i ) );
+    }
+    std::vector<float> floats( halves.size() );
+    tx::convert_float16_to_float32( halves.data(), floats.data(), halves.size() );
+
+    std::vector<tx::Float16> round_trip( halves.size() );
+    tx::convert_float32_to_float16( floats.data(), round_trip.data(), floats.size() );
+    for( size_t i = 0; i < halves.size(); i++ )
+    {
+        if( std::isnan( floats[i] ) )
+        {
+            continue;
+        }
+        ASSERT_EQ( floats[i], tx::half_bits_to_float( uint16_t( i ) ) );
+        ASSERT_EQ( round_trip[i].bits(), i );
+    }
+
+    // Values between halves round the same way as the scalar code
+    std::vector<float> values;
+    for( int i = 0; i < 10007; i++ )
+    {
+        values.push_back( std::ldexp( float( i ) + 0.5f, i % 40 - 30 ) );
+    }
+    std::vector<tx::Float16> rounded( values.size() );
+    tx::convert_float32_to_float16( values.data(), rounded.data(), values.size() );
+    for( size_t i = 0; i < values.size(); i++ )
+    {
+        ASSERT_EQ( rounded[i].bits(), tx::float_to_half_bits( values[i] ) );
+    }
+}
+
+/****************************************************/
+/*      convert() To and From FLOAT16               */
+/****************************************************/
+TEST( Float16, convert )
+{
+    const size_t cols = 19, rows = 4;
+    tx::Image_Memory<tx::PixelRGB_u8>  image_u8( cols, rows );
+    tx::Image_Memory<tx::PixelRGB_f16> image_f16( cols, rows );
+    tx::Image_Memory<tx::PixelRGB_f32> image_f32( cols, rows );
+    for( size_t r = 0; r < rows; r++ )
+    for( size_t c = 0; c < cols; c++ )
+    {
+        image_u8( c, r ) = tx::PixelRGB_u8( uint8_t( c * 13 ), uint8_t( r * 60 ), 255 );
+    }
+
+    // uint8 -> half is rescaled like uint8 -> float
+    ASSERT_FALSE( tx::convert( image_f16.buffer(), image_u8.buffer(), true ).has_error() );
+    ASSERT_FALSE( tx::convert( image_f32.buffer(), image_f16.buffer(), false ).has_error() );
+    for( size_t r = 0; r < rows; r++ )
+    for( size_t c = 0; c < cols; c++ )
+    for( int ch = 0; ch < 3; ch++ )
+    {
+        float expected = image_u8( c, r )[ch] / 255.f;
+        ASSERT_EQ( float( image_f16( c, r )[ch] ), float( tx::Float16( expected ) ) );
+        ASSERT_EQ( image_f32( c, r )[ch], float( image_f16( c, r )[ch] ) );
+    }
+
+    // And back to uint8
+    tx::Image_Memory<tx::PixelRGB_u8> image_back( cols, rows );
+    ASSERT_FALSE( tx::convert( image_back.buffer(), image_f16.buffer(), true ).has_error() );
+    for( size_t r = 0; r < rows; r++ )
+    for( size_t c = 0; c < cols; c++ )
+    for( int ch = 0; ch < 3; ch++ )
+    {
+        ASSERT_NEAR( image_back( c, r )[ch], image_u8( c, r )[ch], 1 );
+    }
+}
+
+/****************************************************/
+/*      Half to Integer Casts Saturate              */
+/****************************************************/
+TEST( Float16, channel_cast_saturates )
+{
+    static_assert( tx::Is_Floating_Point_Channel<tx::Float16>::value );
+    static_assert( tx::Is_Floating_Point_Channel<float>::value );
+    static_assert( !tx::Is_Floating_Point_Channel<uint16_t>::value );
+
+    // Rescaling clamps to the [0,1] float range first
+    tx::pix::Channel_Cast_Rescale_Functor<uint8_t>  rescale_u8;
+    tx::pix::Channel_Cast_Rescale_Functor<uint16_t> rescale_u16;
+    ASSERT_EQ( rescale_u8( tx::Float16( 2.f ) ), 255 );
+    ASSERT_EQ( rescale_u8( tx::Float16( -1.f ) ), 0 );
+    ASSERT_EQ( rescale_u8( tx::Float16( 1.f ) ), 255 );
+    ASSERT_EQ( rescale_u16( tx::Float16( 300.f ) ), 65535 );
+    ASSERT_EQ( rescale_u16( tx::Float16( -0.5f ) ), 0 );
+    ASSERT_EQ( rescale_u16( std::numeric_limits<tx::Float16>::infinity() ), 65535 );
+
+    // The _if_int casts clamp into the integer range
+    tx::PixelRGB_f16 big( tx::Float16( 300.f ), tx::Float16( -5.f ), tx::Float16( 2.6f ) );
+    auto clamped_u8 = tx::pix::channel_cast_clamp_if_int<uint8_t>( big );
+    ASSERT_EQ( clamped_u8[0], 255 );
+    ASSERT_EQ( clamped_u8[1], 0 );
+
+    tx::PixelRGB_f16 huge( std::numeric_limits<tx::Float16>::infinity(), tx::Float16( -3.f ), tx::Float16( 2.6f ) );
+    auto rounded_u16 = tx::pix::channel_cast_round_and_clamp_if_int<uint16_t>( huge );
+    ASSERT_EQ( rounded_u16[0], 65535 );
+    ASSERT_EQ( rounded_u16[1], 0 );
+    ASSERT_EQ( rounded_u16[2], 3 );
+
+    auto rescaled_u8 = tx::pix::channel_cast_rescale<uint8_t>( big );
+    ASSERT_EQ( rescaled_u8[0], 255 );
+    ASSERT_EQ( rescaled_u8[1], 0 );
+    ASSERT_EQ( rescaled_u8[2], 255 );
+
+    // Casting to half is a float cast, not an integer clamp
+    tx::PixelRGB_f32 wide( 100000.f, 0.25f, -1.f );
+    auto to_half = tx::pix::channel_cast_clamp_if_int<tx::Float16>( wide );
+    ASSERT_TRUE( std::isinf( float( to_half[0] ) ) );
+    ASSERT_EQ( float( to_half[1] ), 0.25f );
+    ASSERT_EQ( float( to_half[2] ), -1.f );
+}
@@ -0,0 +1,106 @@
+/**
+ * @file    TEST_Interleave_Utilities.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Image Libraries
+#include <terminus/image/pixel/convert.hpp>
+#include <terminus/image/pixel/Interleave_Utilities.hpp>
+#include <terminus/image/pixel/Pixel_RGB.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+// C++ Libraries
+#include <vector>
+
+namespace tx = tmns::image;
+
+/****************************************************/
+/*      Round Trip for Every Size and Channel Count */
+/****************************************************/
+TEST( Interleave_Utilities, round_trip )
+{
+    // Wider than one tile, so the generic path crosses a tile edge
+    const size_t cols = 300, rows = 3;
+    for( size_t channel_bytes : { 1, 2, 4, 8 } )
+    for( size_t channels = 1; channels <= 7; channels++ )
+    {
+        size_t plane_bytes = cols * rows * channel_bytes;
+        std::vector<uint8_t> planar( plane_bytes * channels );
+        for( size_t i = 0; i < planar.size(); i++ )
+        {
+            planar[i] = uint8_t( i * 7 + i / 251 );
+        }
+
+        std::vector<uint8_t> interleaved( planar.size() );
+        ASSERT_TRUE( tx::planar_to_interleaved( planar.data(), plane_bytes, cols * channel_bytes,
+                                                interleaved.data(), cols * channels * channel_bytes,
+                                                cols, rows, channels, channel_bytes ) );
+
+        // Spot check pixel layout
+        for( size_t r = 0; r < rows; r++ )
+        for( size_t c = 0; c < cols; c++ )
+        for( size_t ch = 0; ch < channels; ch++ )
+        {
+            size_t src_offset = ch * plane_bytes + ( r * cols + c ) * channel_bytes;
+            size_t dst_offset = ( ( r * cols + c ) * channels + ch ) * channel_bytes;
+            ASSERT_EQ( interleaved[dst_offset], planar[src_offset] );
+            ASSERT_EQ( interleaved[dst_offset + channel_bytes - 1], planar[src_offset + channel_bytes - 1] );
+        }
+
+        std::vector<uint8_t> back( planar.size() );
+        ASSERT_TRUE( tx::interleaved_to_planar( interleaved.data(), cols * channels * channel_bytes,
+                                                back.data(), plane_bytes, cols * channel_bytes,
+                                                cols, rows, channels, channel_bytes ) );
+        ASSERT_EQ( back, planar );
+    }
+
+    // Unsupported value sizes
+    std::vector<uint8_t> data( 24 );
+    ASSERT_FALSE( tx::planar_to_interleaved( data.data(), 3, 3, data.data(), 9, 1, 1, 3, 3 ) );
+    ASSERT_FALSE( tx::interleaved_to_planar( data.data(), 9, data.data(), 3, 3, 1, 1, 3, 3 ) );
+}
+
+/****************************************************/
+/*      convert() Between Planes and Channels       */
+/****************************************************/
+TEST( Interleave_Utilities, convert )
+{
+    const size_t cols = 37, rows = 5;
+    tx::Image_Memory<uint8_t> planes_u8( cols, rows, 3 );
+    for( size_t p = 0; p < 3; p++ )
+    for( size_t r = 0; r < rows; r++ )
+    for( size_t c = 0; c < cols; c++ )
+    {
+        planes_u8( c, r, p ) = uint8_t( c * 5 + r * 17 + p * 80 );
+    }
+
+    // Same channel type is a straight transpose
+    tx::Image_Memory<tx::PixelRGB_u8> rgb_u8( cols, rows );
+    ASSERT_FALSE( tx::convert( rgb_u8.buffer(), planes_u8.buffer(), false ).has_error() );
+
+    // Differing channel types convert along the way
+    tx::Image_Memory<tx::PixelRGB_f32> rgb_f32( cols, rows );
+    ASSERT_FALSE( tx::convert( rgb_f32.buffer(), planes_u8.buffer(), true ).has_error() );
+    for( size_t r = 0; r < rows; r++ )
+    for( size_t c = 0; c < cols; c++ )
+    for( size_t p = 0; p < 3; p++ )
+    {
+        ASSERT_EQ( rgb_u8( c, r )[p], planes_u8( c, r, p ) );
+        ASSERT_FLOAT_EQ( rgb_f32( c, r )[p], planes_u8( c, r, p ) / 255.f );
+    }
+
+    // And back to planes
+    tx::Image_Memory<uint8_t> planes_back( cols, rows, 3 );
+    tx::Image_Memory<uint16_t> planes_u16( cols, rows, 3 );
+    ASSERT_FALSE( tx::convert( planes_back.buffer(), rgb_u8.buffer(), false ).has_error() );
+    ASSERT_FALSE( tx::convert( planes_u16.buffer(), rgb_f32.buffer(), true ).has_error() );
+    for( size_t p = 0; p < 3; p++ )
+    for( size_t r = 0; r < rows; r++ )
+    for( size_t c = 0; c < cols; c++ )
+    {
+        ASSERT_EQ( planes_back( c, r, p ), planes_u8( c, r, p ) );
+        ASSERT_NEAR( planes_u16( c, r, p ), planes_u8( c, r, p ) * 257, 1 );
+    }
+}
@@ -0,0 +1,167 @@
+/**
+ * @file    TEST_Packed_Channel_Utilities.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Image Libraries
+#include <terminus/image/pixel/convert.hpp>
+#include <terminus/image/pixel/Packed_Channel_Utilities.hpp>
+#include <terminus/image/pixel/Pixel_RGB.hpp>
+#include <terminus/image/types/Packed_Image_Memory.hpp>
+
+// C++ Libraries
+#include <random>
+#include <vector>
+
+namespace tx = tmns::image;
+
+/****************************************************/
+/*      Pack/Unpack Round Trip for Every Length     */
+/****************************************************/
+TEST( Packed_Channel_Utilities, round_trip )
+{
+    std::mt19937 rng( 1234 );
+    for( auto channel_type : { tx::Channel_Type_Enum::UINT12, tx::Channel_Type_Enum::UINT14 } )
+    {
+        size_t bits = tx::channel_size_bits( channel_type ).value();
+        for( size_t count = 0; count < 100; count++ )
+        {
+            std::vector<uint16_t> values( count );
+            for( auto& value : values )
+            {
+                value = uint16_t( rng() & ( ( 1u << bits ) - 1 ) );
+            }
+
+            std::vector<uint8_t>  packed( tx::packed_size_bytes( bits, count ) );
+            std::vector<uint16_t> unpacked( count );
+            auto fits = tx::pack_channels( channel_type, values.data(), packed.data(), count );
+            ASSERT_FALSE( fits.has_error() );
+            ASSERT_TRUE( fits.value() );
+            ASSERT_FALSE( tx::unpack_channels( channel_type, packed.data(), unpacked.data(), count ).has_error() );
+
+            for( size_t i = 0; i < count; i++ )
+            {
+                ASSERT_EQ( unpacked[i], values[i] );
+                ASSERT_EQ( tx::packed_value( packed.data(), i, bits ), values[i] );
+            }
+        }
+    }
+
+    // Other channel types are rejected
+    uint16_t value = 0;
+    uint8_t  byte  = 0;
+    ASSERT_TRUE( tx::pack_channels( tx::Channel_Type_Enum::UINT16, &value, &byte, 1 ).has_error() );
+}
+
+/****************************************************/
+/*      Out-of-Range Values Saturate                */
+/****************************************************/
+TEST( Packed_Channel_Utilities, saturation )
+{
+    std::vector<uint16_t> values { 0, 4095, 4096, 65535, 17 };
+    std::vector<uint8_t>  packed( tx::packed_size_bytes( 12, values.size() ) );
+    ASSERT_FALSE( tx::pack_uint12( values.data(), packed.data(), values.size() ) );
+
+    std::vector<uint16_t> unpacked( values.size() );
+    tx::unpack_uint12( packed.data(), unpacked.data(), unpacked.size() );
+    ASSERT_EQ( unpacked, ( std::vector<uint16_t>{ 0, 4095, 4095, 4095, 17 } ) );
+}
+
+/****************************************************/
+/*      Convert From a Packed Buffer                */
+/****************************************************/
+TEST( Packed_Channel_Utilities, convert_packed_to_uint16 )
+{
+    const size_t cols = 13, rows = 3;
+    std::vector<uint16_t> values( cols * rows * 3 );
+    for( size_t i = 0; i < values.size(); i++ )
+    {
+        values[i] = uint16_t( ( i * 157 ) % 4096 );
+    }
+
+    tx::Image_Format packed_format( cols, rows, 1, tx::Pixel_Format_Enum::RGB, tx::Channel_Type_Enum::UINT12, false );
+    packed_format.set_packed( true );
+    ASSERT_EQ( packed_format.rstride(), tx::packed_size_bytes( 12, cols * 3 ) );
+
+    std::vector<uint8_t> packed( packed_format.raster_size_bytes() );
+    for( size_t r = 0; r < rows; r++ )
+    {
+        tx::pack_uint12( values.data() + r * cols * 3, packed.data() + r * packed_format.rstride(), cols * 3 );
+    }
+
+    // Unpack into 16-bit, then pack again through convert()
+    std::vector<uint16_t> unpacked( values.size() );
+    tx::Image_Buffer src( packed_format, packed.data() );
+    tx::Image_Buffer dst( tx::Image_Format( cols, rows, 1, tx::Pixel_Format_Enum::RGB, tx::Channel_Type_Enum::UINT16, false ),
+                          unpacked.data() );
+    ASSERT_FALSE( tx::convert( dst, src, false ).has_error() );
+    ASSERT_EQ( unpacked, values );
+
+    std::vector<uint8_t> repacked( packed.size() );
+    tx::Image_Buffer repacked_buffer( packed_format, repacked.data() );
+    ASSERT_FALSE( tx::convert( repacked_buffer, dst, false ).has_error() );
+    ASSERT_EQ( repacked, packed );
+}
+
+/****************************************************/
+/*      Packed Image Memory                         */
+/****************************************************/
+TEST( Packed_Channel_Utilities, packed_image_memory )
+{
+    tx::Packed_Image_Memory<tx::PixelRGB_u16> image( 21, 5, 1, tx::Channel_Type_Enum::UINT14 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image.image()( c, r ) = tx::PixelRGB_u16( uint16_t( c * 700 ), uint16_t( r * 3000 ), uint16_t( c + r ) );
+    }
+    size_t unpacked_bytes = image.size_bytes();
+    ASSERT_TRUE( image.pack() );
+    ASSERT_LT( image.size_bytes(), unpacked_bytes );
+
+    tx::Image_Memory<tx::PixelRGB_u16> region( 4, 3 );
+    image.rasterize( region, tmns::math::Rect2i( 10, 2, 4, 3 ) );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        ASSERT_EQ( image( c, r )[0], c * 700 );
+        ASSERT_EQ( image( c, r )[1], r * 3000 );
+        ASSERT_EQ( image( c, r )[2], c + r );
+    }
+    ASSERT_EQ( region( 1, 2 )[0], 11 * 700 );
+    ASSERT_EQ( region( 1, 2 )[1], 4 * 3000 );
+
+    // Regions starting mid-group decode from the nearest byte boundary, for both widths
+    for( auto storage : { tx::Channel_Type_Enum::UINT12, tx::Channel_Type_Enum::UINT14 } )
+    {
+        tx::Packed_Image_Memory<tx::PixelRGB_u16> packed( 21, 5, 1, storage );
+        for( size_t r = 0; r < packed.rows(); r++ )
+        for( size_t c = 0; c < packed.cols(); c++ )
+        {
+            packed.image()( c, r ) = tx::PixelRGB_u16( uint16_t( c * 190 ), uint16_t( r * 1000 ), uint16_t( c + r ) );
+        }
+        ASSERT_TRUE( packed.pack() );
+
+        for( int x = 0; x < 8; x++ )
+        for( int width = 1; x + width <= 21 && width < 6; width++ )
+        {
+            tmns::math::Rect2i bbox( x, 1, width, 3 );
+            tx::Image_Memory<tx::PixelRGB_u16> sub( width, 3 );
+            packed.rasterize( sub, bbox );
+            auto pre = packed.prerasterize( bbox );
+            for( int r = 0; r < bbox.height(); r++ )
+            for( int c = 0; c < bbox.width(); c++ )
+            {
+                ASSERT_EQ( sub( c, r ), packed( x + c, 1 + r ) );
+                ASSERT_EQ( pre( x + c, 1 + r ), packed( x + c, 1 + r ) );
+            }
+        }
+    }
+
+    // Values too large for the storage type keep the tile unpacked
+    tx::Packed_Image_Memory<tx::PixelRGB_u16> wide( 2, 2, 1, tx::Channel_Type_Enum::UINT12 );
+    wide.image()( 0, 0 ) = tx::PixelRGB_u16( 5000, 0, 0 );
+    ASSERT_FALSE( wide.pack() );
+    ASSERT_EQ( wide( 0, 0 )[0], 5000 );
+}
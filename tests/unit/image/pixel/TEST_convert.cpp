@@ -6,11 +6,16 @@
 #include <gtest/gtest.h>
 
 // Terminus Libraries
+#include <terminus/image/pixel/Channel_Conversion_Utilities.hpp>
 #include <terminus/image/pixel/convert.hpp>
+#include <terminus/image/pixel/Convert_SIMD_Kernels.hpp>
 #include <terminus/log/utility.hpp>
 
 // C++ Libraries
 #include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
 
 /************************************/
 /*      Convert Int to Float        */
@@ -31,4 +36,243 @@ TEST( image_convert, channel_convert_int_to_float )
         ASSERT_NEAR( flt32_arr[i], flt32_exp[i], 0.001 );
     }
 
-}
\ No newline at end of file
+}
+/****************************************************/
+/*      Convert RGB uint16 to Gray uint8 Rescaled   */
+/****************************************************/
+TEST( image_convert, convert_rgb_u16_to_gray_u8 )
+{
+    namespace tx = tmns::image;
+
+    std::array<uint16_t,6> src_data { 65535, 0, 1000, 300, 300, 300 };
+    std::array<uint8_t,2>  dst_data { 0, 0 };
+
+    tx::Image_Buffer src( tx::Image_Format( 2, 1, 1, tx::Pixel_Format_Enum::RGB,  tx::Channel_Type_Enum::UINT16, true ), src_data.data() );
+    tx::Image_Buffer dst( tx::Image_Format( 2, 1, 1, tx::Pixel_Format_Enum::GRAY, tx::Channel_Type_Enum::UINT8,  true ), dst_data.data() );
+
+    ASSERT_FALSE( tx::convert( dst, src, true ).has_error() );
+    ASSERT_EQ( dst_data[0], 86 );
+    ASSERT_EQ( dst_data[1], 1 );
+}
+
+/****************************************************/
+/*      Convert Gray uint8 to RGBA float Rescaled   */
+/****************************************************/
+TEST( image_convert, convert_gray_u8_to_rgba_f32 )
+{
+    namespace tx = tmns::image;
+
+    std::array<uint8_t,2> src_data { 0, 255 };
+    std::array<float,8>   dst_data;
+
+    tx::Image_Buffer src( tx::Image_Format( 2, 1, 1, tx::Pixel_Format_Enum::GRAY, tx::Channel_Type_Enum::UINT8,   true ), src_data.data() );
+    tx::Image_Buffer dst( tx::Image_Format( 2, 1, 1, tx::Pixel_Format_Enum::RGBA, tx::Channel_Type_Enum::FLOAT32, true ), dst_data.data() );
+
+    ASSERT_FALSE( tx::convert( dst, src, true ).has_error() );
+    std::array<float,8> dst_exp { 0, 0, 0, 1, 1, 1, 1, 1 };
+    for( size_t i = 0; i < dst_exp.size(); i++ )
+    {
+        ASSERT_NEAR( dst_data[i], dst_exp[i], 0.0001 );
+    }
+}
+
+/****************************************************/
+/*      SIMD Kernels Match the Scalar Versions      */
+/****************************************************/
+TEST( image_convert, simd_kernels_match_scalar )
+{
+    namespace td = tmns::image::detail;
+    namespace tx = tmns::image;
+
+    // Odd size so the scalar tails get exercised too
+    const size_t pixels = 1031;
+    std::vector<uint8_t>  u8_src( pixels * 4 );
+    std::vector<uint16_t> u16_src( pixels * 4 );
+    std::vector<float>    f32_src( pixels * 4 );
+    for( size_t i = 0; i < u8_src.size(); i++ )
+    {
+        u8_src[i]  = uint8_t( ( i * 37 + i / 7 ) % 256 );
+        u16_src[i] = uint16_t( ( i * 7919 ) % 65536 );
+        f32_src[i] = ( float( i % 300 ) - 20.f ) / 255.f;
+    }
+
+    // Out-of-range floats, spread over the vector bodies and the tail
+    const std::array<float,9> specials { std::numeric_limits<float>::quiet_NaN(),
+                                         -std::numeric_limits<float>::quiet_NaN(),
+                                         std::numeric_limits<float>::infinity(),
+                                         -std::numeric_limits<float>::infinity(),
+                                         std::numeric_limits<float>::max(),
+                                         -std::numeric_limits<float>::max(),
+                                         std::nextafter( 1.f, 2.f ),
+                                         256.f,
+                                         -0.f };
+    for( size_t i = 0; i < f32_src.size(); i += 13 )
+    {
+        f32_src[i] = specials[( i / 13 ) % specials.size()];
+    }
+    f32_src.back() = specials[0];
+
+    // Expected values come from the per-channel functions convert() has always used
+    std::vector<uint8_t> u16_u8_exp( u16_src.size() );
+    std::vector<float>   u8_f32_exp( u8_src.size() );
+    std::vector<uint8_t> f32_u8_exp( f32_src.size() );
+    for( size_t i = 0; i < u16_src.size(); i++ )
+    {
+        tx::channel_convert_uint16_to_uint8( &u16_src[i], &u16_u8_exp[i] );
+        tx::channel_convert_int_to_float( &u8_src[i], &u8_f32_exp[i] );
+        tx::channel_convert_float_to_int( &f32_src[i], &f32_u8_exp[i] );
+    }
+
+    // Every level up to the one this CPU supports must match them exactly
+    std::vector<uint8_t> u8_act( pixels * 4 );
+    std::vector<float>   f32_act( pixels * 4 );
+    for( int l = 0; l <= int( td::simd_level() ); l++ )
+    {
+        auto level = td::SIMD_Level( l );
+
+        td::rescale_u16_to_u8( u16_src.data(), u8_act.data(), u16_src.size(), level );
+        ASSERT_EQ( u16_u8_exp, u8_act );
+
+        td::rescale_u8_to_f32( u8_src.data(), f32_act.data(), u8_src.size(), level );
+        ASSERT_EQ( u8_f32_exp, f32_act );
+
+        td::rescale_f32_to_u8( f32_src.data(), u8_act.data(), f32_src.size(), level );
+        ASSERT_EQ( f32_u8_exp, u8_act );
+    }
+    ASSERT_EQ( f32_u8_exp[0],  0 );
+    ASSERT_EQ( f32_u8_exp[26], 255 );
+    ASSERT_EQ( f32_u8_exp[39], 0 );
+
+    // Alpha values of 0 and 255 show up throughout, along with colors above alpha
+    std::vector<uint8_t> rgba_src( u8_src );
+    for( size_t i = 0; i < pixels; i += 5 )
+    {
+        rgba_src[4*i+3] = ( i % 2 == 0 ) ? 0 : 255;
+    }
+
+    std::vector<uint8_t> rgb_avg_exp( pixels ), rgba_avg_exp( pixels );
+    std::vector<uint8_t> premult_exp( pixels * 4 ), unpremult_exp( pixels * 4 );
+    for( size_t i = 0; i < pixels; i++ )
+    {
+        tx::channel_average( &u8_src[3*i], &rgb_avg_exp[i], 3 );
+        tx::channel_average( &u8_src[4*i], &rgba_avg_exp[i], 3 );
+        tx::channel_premultiply_int( &rgba_src[4*i], &premult_exp[4*i], 4 );
+        tx::channel_unpremultiply_int( &rgba_src[4*i], &unpremult_exp[4*i], 4 );
+    }
+
+    std::vector<uint8_t> gray_act( pixels );
+    for( int l = 0; l <= int( td::simd_level() ); l++ )
+    {
+        auto level = td::SIMD_Level( l );
+
+        td::average_rgb_u8( u8_src.data(), gray_act.data(), pixels, level );
+        ASSERT_EQ( rgb_avg_exp, gray_act );
+
+        td::average_rgba_u8( u8_src.data(), gray_act.data(), pixels, level );
+        ASSERT_EQ( rgba_avg_exp, gray_act );
+
+        td::premultiply_rgba_u8( rgba_src.data(), u8_act.data(), pixels, level );
+        ASSERT_EQ( premult_exp, u8_act );
+
+        td::unpremultiply_rgba_u8( rgba_src.data(), u8_act.data(), pixels, level );
+        ASSERT_EQ( unpremult_exp, u8_act );
+    }
+}
+
+/****************************************************/
+/*      Row-Parallel Convert Matches Serial         */
+/****************************************************/
+TEST( image_convert, convert_parallel_matches_serial )
+{
+    namespace tx = tmns::image;
+
+    const size_t cols = 123;
+    const size_t rows = 517;
+    std::vector<uint16_t> src_data( cols * rows * 4 );
+    for( size_t i = 0; i < src_data.size(); i++ )
+    {
+        src_data[i] = uint16_t( ( i * 7919 ) % 65536 );
+    }
+    std::vector<uint8_t> serial_data( cols * rows, 0 );
+    std::vector<uint8_t> parallel_data( cols * rows, 0 );
+
+    tx::Image_Buffer src( tx::Image_Format( cols, rows, 1, tx::Pixel_Format_Enum::RGBA, tx::Channel_Type_Enum::UINT16, false ), src_data.data() );
+    tx::Image_Buffer serial_dst( tx::Image_Format( cols, rows, 1, tx::Pixel_Format_Enum::GRAY, tx::Channel_Type_Enum::UINT8, false ), serial_data.data() );
+    tx::Image_Buffer parallel_dst( tx::Image_Format( cols, rows, 1, tx::Pixel_Format_Enum::GRAY, tx::Channel_Type_Enum::UINT8, false ), parallel_data.data() );
+
+    tx::Convert_Parallel_Settings serial_settings;
+    serial_settings.num_threads = 1;
+    ASSERT_EQ( serial_settings.thread_count( src.format() ), 1 );
+
+    // Force an uneven split
+    tx::Convert_Parallel_Settings parallel_settings;
+    parallel_settings.num_threads         = 7;
+    parallel_settings.min_pixels          = 0;
+    parallel_settings.min_rows_per_thread = 1;
+    ASSERT_EQ( parallel_settings.thread_count( src.format() ), 7 );
+
+    ASSERT_FALSE( tx::convert( serial_dst,   src, true, serial_settings ).has_error() );
+    ASSERT_FALSE( tx::convert( parallel_dst, src, true, parallel_settings ).has_error() );
+    ASSERT_EQ( serial_data, parallel_data );
+}
+
+/****************************************************/
+/*      Row-Parallel Planar/Interleaved Convert     */
+/****************************************************/
+TEST( image_convert, convert_parallel_planar )
+{
+    namespace tx = tmns::image;
+
+    const size_t cols = 97;
+    const size_t rows = 211;
+    std::vector<uint16_t> planar_data( cols * rows * 3 );
+    for( size_t i = 0; i < planar_data.size(); i++ )
+    {
+        planar_data[i] = uint16_t( ( i * 7919 ) % 65536 );
+    }
+
+    tx::Convert_Parallel_Settings serial_settings;
+    serial_settings.num_threads = 1;
+
+    tx::Convert_Parallel_Settings parallel_settings;
+    parallel_settings.num_threads         = 7;
+    parallel_settings.min_pixels          = 0;
+    parallel_settings.min_rows_per_thread = 1;
+
+    tx::Image_Buffer planar( tx::Image_Format( cols, rows, 3, tx::Pixel_Format_Enum::SCALAR, tx::Channel_Type_Enum::UINT16, false ), planar_data.data() );
+    ASSERT_EQ( parallel_settings.thread_count( planar.format() ), 7 );
+
+    // Same channel type is a straight transpose
+    std::vector<uint16_t> rgb_data( cols * rows * 3, 0 );
+    tx::Image_Buffer rgb( tx::Image_Format( cols, rows, 1, tx::Pixel_Format_Enum::RGB, tx::Channel_Type_Enum::UINT16, false ), rgb_data.data() );
+    ASSERT_FALSE( tx::convert( rgb, planar, false, parallel_settings ).has_error() );
+    for( size_t r = 0; r < rows; r++ )
+    for( size_t c = 0; c < cols; c++ )
+    for( size_t p = 0; p < 3; p++ )
+    {
+        ASSERT_EQ( rgb_data[( r * cols + c ) * 3 + p], planar_data[( p * rows + r ) * cols + c] );
+    }
+
+    // And back again
+    std::vector<uint16_t> round_data( cols * rows * 3, 0 );
+    tx::Image_Buffer round( tx::Image_Format( cols, rows, 3, tx::Pixel_Format_Enum::SCALAR, tx::Channel_Type_Enum::UINT16, false ), round_data.data() );
+    ASSERT_FALSE( tx::convert( round, rgb, false, parallel_settings ).has_error() );
+    ASSERT_EQ( round_data, planar_data );
+
+    // Differing channel types go through the row scratch on each thread
+    std::vector<uint8_t> serial_data( cols * rows * 3, 0 );
+    std::vector<uint8_t> parallel_data( cols * rows * 3, 0 );
+    tx::Image_Buffer serial_dst( tx::Image_Format( cols, rows, 1, tx::Pixel_Format_Enum::RGB, tx::Channel_Type_Enum::UINT8, false ), serial_data.data() );
+    tx::Image_Buffer parallel_dst( tx::Image_Format( cols, rows, 1, tx::Pixel_Format_Enum::RGB, tx::Channel_Type_Enum::UINT8, false ), parallel_data.data() );
+    ASSERT_FALSE( tx::convert( serial_dst,   planar, true, serial_settings ).has_error() );
+    ASSERT_FALSE( tx::convert( parallel_dst, planar, true, parallel_settings ).has_error() );
+    ASSERT_EQ( serial_data, parallel_data );
+
+    std::vector<float> serial_planar( cols * rows * 3, 0 );
+    std::vector<float> parallel_planar( cols * rows * 3, 0 );
+    tx::Image_Buffer serial_planar_dst( tx::Image_Format( cols, rows, 3, tx::Pixel_Format_Enum::SCALAR, tx::Channel_Type_Enum::FLOAT32, false ), serial_planar.data() );
+    tx::Image_Buffer parallel_planar_dst( tx::Image_Format( cols, rows, 3, tx::Pixel_Format_Enum::SCALAR, tx::Channel_Type_Enum::FLOAT32, false ), parallel_planar.data() );
+    ASSERT_FALSE( tx::convert( serial_planar_dst,   serial_dst, true, serial_settings ).has_error() );
+    ASSERT_FALSE( tx::convert( parallel_planar_dst, serial_dst, true, parallel_settings ).has_error() );
+    ASSERT_EQ( serial_planar, parallel_planar );
+}
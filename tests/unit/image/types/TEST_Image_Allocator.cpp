@@ -0,0 +1,106 @@
+/**
+ * @file    TEST_Image_Allocator.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/types/Image_Allocator.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+// C++ Libraries
+#include <cstdint>
+
+namespace tx = tmns::image;
+
+/**********************************************/
+/*      Check the size classes                */
+/**********************************************/
+TEST( Pooled_Image_Allocator, size_class )
+{
+    ASSERT_EQ( tx::Pooled_Image_Allocator::size_class( 1 ), 4096 );
+    ASSERT_EQ( tx::Pooled_Image_Allocator::size_class( 4096 ), 4096 );
+    ASSERT_EQ( tx::Pooled_Image_Allocator::size_class( 4097 ), 5120 );
+    ASSERT_EQ( tx::Pooled_Image_Allocator::size_class( 8192 ), 8192 );
+    ASSERT_EQ( tx::Pooled_Image_Allocator::size_class( 8193 ), 10240 );
+
+    // Never more than 25% over
+    for( size_t bytes = 4097; bytes < 1000000; bytes += 997 )
+    {
+        size_t cls = tx::Pooled_Image_Allocator::size_class( bytes );
+        ASSERT_GE( cls, bytes );
+        ASSERT_LE( cls, bytes + bytes / 4 );
+    }
+}
+
+/**********************************************/
+/*      Released blocks are reused            */
+/**********************************************/
+TEST( Pooled_Image_Allocator, recycle_blocks )
+{
+    auto pool = std::make_shared<tx::Pooled_Image_Allocator>( 1024 * 1024 );
+
+    void* first_ptr = nullptr;
+    {
+        auto block = pool->allocate( 100000, 64 );
+        ASSERT_NE( block, nullptr );
+        ASSERT_EQ( (uintptr_t)block.get() % 64, 0 );
+        first_ptr = block.get();
+    }
+    ASSERT_EQ( pool->cached_bytes(), tx::Pooled_Image_Allocator::size_class( 100000 ) );
+
+    // Same size class gets the same block back
+    auto block = pool->allocate( 99000, 64 );
+    ASSERT_EQ( block.get(), first_ptr );
+    ASSERT_EQ( pool->hits(), 1 );
+    ASSERT_EQ( pool->misses(), 1 );
+    ASSERT_EQ( pool->cached_bytes(), 0 );
+
+    // Blocks past the cache limit go back to the heap
+    {
+        auto big = pool->allocate( 2 * 1024 * 1024, 64 );
+    }
+    ASSERT_EQ( pool->cached_bytes(), 0 );
+
+    // Blocks outliving the pool are still freed
+    pool.reset();
+    block.reset();
+}
+
+/**********************************************/
+/*      Images draw tiles from the pool       */
+/**********************************************/
+TEST( Pooled_Image_Allocator, image_memory_tiles )
+{
+    auto pool = std::make_shared<tx::Pooled_Image_Allocator>();
+    tx::Image_Memory_Policy policy;
+    policy.allocator = pool;
+
+    float* first_ptr = nullptr;
+    for( int i = 0; i < 10; i++ )
+    {
+        tx::Image_Memory<float> tile( 256, 256, 1, policy );
+        tile( 255, 255 ) = float( i );
+        ASSERT_EQ( tile( 255, 255 ), float( i ) );
+        if( i == 0 )
+        {
+            first_ptr = tile.data();
+        }
+        ASSERT_EQ( tile.data(), first_ptr );
+    }
+    ASSERT_EQ( pool->misses(), 1 );
+    ASSERT_EQ( pool->hits(), 9 );
+
+    // Copies share the buffer, which returns once both are gone
+    {
+        tx::Image_Memory<float> tile( 256, 256, 1, policy );
+        auto copy = tile;
+        tile.reset();
+        ASSERT_EQ( pool->cached_bytes(), 0 );
+    }
+    ASSERT_GT( pool->cached_bytes(), 0 );
+
+    pool->clear();
+    ASSERT_EQ( pool->cached_bytes(), 0 );
+}
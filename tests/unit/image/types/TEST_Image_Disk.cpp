@@ -5,12 +5,22 @@
 */
 #include <gtest/gtest.h>
 
+// GDAL Libraries
+#include <gdal.h>
+
 // Terminus Libraries
+#include <terminus/image/io/drivers/gdal/GDAL_Utilities.hpp>
+#include <terminus/image/io/drivers/gdal/Image_Resource_Disk_GDAL.hpp>
 #include <terminus/image/pixel/Pixel_Gray.hpp>
 #include <terminus/image/pixel/Pixel_RGBA.hpp>
 #include <terminus/image/types/Image_Disk.hpp>
 #include <terminus/log/utility.hpp>
 
+// C++ Libraries
+#include <filesystem>
+#include <mutex>
+#include <vector>
+
 namespace tx = tmns::image;
 
 /****************************************************/
@@ -61,4 +71,52 @@ TEST( types_Image_Disk, construct_gdal_resource_jpg )
     ASSERT_EQ( disk_image_02.format().rows(), 512 );
     ASSERT_EQ( disk_image_02.format().channel_type(), tx::Channel_Type_Enum::FLOAT64 );
     ASSERT_EQ( disk_image_02.format().pixel_type(), tx::Pixel_Format_Enum::GRAY );
-}
\ No newline at end of file
+}
+
+/****************************************************/
+/*      Read 12-bit Data Through the Tile Cache     */
+/****************************************************/
+TEST( types_Image_Disk, read_gdal_nbits_12 )
+{
+    ASSERT_EQ( tx::io::gdal::gdal_nbits_channel_type( tx::Channel_Type_Enum::UINT16, "12" ), tx::Channel_Type_Enum::UINT12 );
+    ASSERT_EQ( tx::io::gdal::gdal_nbits_channel_type( tx::Channel_Type_Enum::UINT16, "14" ), tx::Channel_Type_Enum::UINT14 );
+    ASSERT_EQ( tx::io::gdal::gdal_nbits_channel_type( tx::Channel_Type_Enum::UINT16, "16" ), tx::Channel_Type_Enum::UINT16 );
+    ASSERT_EQ( tx::io::gdal::gdal_nbits_channel_type( tx::Channel_Type_Enum::UINT16, nullptr ), tx::Channel_Type_Enum::UINT16 );
+    ASSERT_EQ( tx::io::gdal::gdal_nbits_channel_type( tx::Channel_Type_Enum::UINT8, "12" ), tx::Channel_Type_Enum::UINT8 );
+
+    // Write a 12-bit GeoTIFF straight through GDAL
+    std::filesystem::path image_path { "./test_image_disk_nbits_12.tif" };
+    const int cols = 300, rows = 200;
+    std::vector<uint16_t> values( cols * rows );
+    for( int r = 0; r < rows; r++ )
+    for( int c = 0; c < cols; c++ )
+    {
+        values[r * cols + c] = uint16_t( ( c * 13 + r * 29 ) % 4096 );
+    }
+    {
+        std::unique_lock<std::mutex> lck( tx::io::gdal::get_master_gdal_mutex() );
+        const char* options[] = { "NBITS=12", "TILED=YES", nullptr };
+        GDALDatasetH dataset = GDALCreate( GDALGetDriverByName( "GTiff" ), image_path.c_str(),
+                                           cols, rows, 1, GDT_UInt16, (char**)options );
+        ASSERT_TRUE( dataset != nullptr );
+        ASSERT_EQ( GDALRasterIO( GDALGetRasterBand( dataset, 1 ), GF_Write, 0, 0, cols, rows,
+                                 values.data(), cols, rows, GDT_UInt16, 0, 0 ), CE_None );
+        GDALClose( dataset );
+    }
+
+    // NBITS comes through as the channel type, so cached tiles get bit-packed
+    auto resource = std::make_shared<tx::io::gdal::Image_Resource_Disk_GDAL>( image_path );
+    ASSERT_EQ( resource->format().channel_type(), tx::Channel_Type_Enum::UINT12 );
+
+    auto cache = std::make_shared<tmns::core::cache::Cache_Local>( 100000000 );
+    tx::Image_Disk<tx::PixelGray_u16> disk_image( resource, cache );
+    ASSERT_EQ( disk_image.cols(), cols );
+    ASSERT_EQ( disk_image.rows(), rows );
+    for( int r = 0; r < rows; r += 7 )
+    for( int c = 0; c < cols; c += 5 )
+    {
+        ASSERT_EQ( disk_image( c, r ), tx::PixelGray_u16( values[r * cols + c] ) );
+    }
+
+    std::filesystem::remove( image_path );
+}
@@ -6,9 +6,14 @@
 #include <gtest/gtest.h>
 
 // Terminus Libraries
+#include <terminus/image/operations/crop_image.hpp>
+#include <terminus/image/pixel/Pixel_RGB.hpp>
 #include <terminus/image/pixel/Pixel_RGBA.hpp>
 #include <terminus/image/types/Image_Memory.hpp>
 
+// C++ Libraries
+#include <cstdint>
+
 namespace tx = tmns::image;
 
 /**********************************************/
@@ -32,4 +37,84 @@ TEST( Image_Memory, basic_checks_RGBA_uint8 )
     ASSERT_EQ( buffer_01.channel_type(), tx::Channel_Type_Enum::UINT8 );
 
     tmns::log::trace( buffer_01.to_string() );
-}
\ No newline at end of file
+}
+/**********************************************/
+/*      Check aligned and padded row layout   */
+/**********************************************/
+TEST( Image_Memory, aligned_padded_rows )
+{
+    // Buffers are aligned by default, but rows stay contiguous
+    tx::Image_Memory<float> contiguous( 33, 7, 2 );
+    ASSERT_EQ( (uintptr_t)contiguous.data() % 64, 0 );
+    ASSERT_EQ( contiguous.row_stride(), 33 );
+    ASSERT_TRUE( contiguous.is_contiguous() );
+
+    // Padded rows all start on the alignment
+    tx::Image_Memory_Policy policy;
+    policy.pad_rows = true;
+    tx::Image_Memory<tx::PixelRGB_u8> padded( 33, 7, 2, policy );
+    ASSERT_EQ( padded.row_stride(), 64 );
+    ASSERT_EQ( padded.plane_stride(), 64 * 7 );
+    ASSERT_FALSE( padded.is_contiguous() );
+    for( size_t p = 0; p < padded.planes(); p++ )
+    for( size_t r = 0; r < padded.rows(); r++ )
+    {
+        ASSERT_EQ( (uintptr_t)&padded( 0, r, p ) % 64, 0 );
+    }
+
+    auto buffer = padded.buffer();
+    ASSERT_EQ( buffer.rstride(), 64 * sizeof(tx::PixelRGB_u8) );
+    ASSERT_EQ( buffer.pstride(), 64 * 7 * sizeof(tx::PixelRGB_u8) );
+    ASSERT_EQ( padded.origin().row_stride(), 64 );
+
+    for( size_t p = 0; p < padded.planes(); p++ )
+    for( size_t r = 0; r < padded.rows(); r++ )
+    for( size_t c = 0; c < padded.cols(); c++ )
+    {
+        padded( c, r, p ) = tx::PixelRGB_u8( uint8_t( c ), uint8_t( r ), uint8_t( p ) );
+    }
+
+    // Copies out of a padded image land in the right place
+    tx::Image_Memory<tx::PixelRGB_u8> cropped = tx::crop_image( padded, 5, 2, 20, 4 );
+    ASSERT_EQ( cropped.cols(), 20 );
+    ASSERT_EQ( cropped.rows(), 4 );
+    for( size_t p = 0; p < cropped.planes(); p++ )
+    for( size_t r = 0; r < cropped.rows(); r++ )
+    for( size_t c = 0; c < cropped.cols(); c++ )
+    {
+        ASSERT_EQ( cropped( c, r, p )[0], c + 5 );
+        ASSERT_EQ( cropped( c, r, p )[1], r + 2 );
+        ASSERT_EQ( cropped( c, r, p )[2], p );
+    }
+
+    // Bad alignments are rejected
+    policy.alignment = 48;
+    tx::Image_Memory<float> bad( 0, 0, 1, policy );
+    ASSERT_TRUE( bad.set_size( 10, 10 ).has_error() );
+}
+
+/**********************************************/
+/*      Default policy is taken on allocation */
+/**********************************************/
+TEST( Image_Memory, default_policy_on_allocation )
+{
+    auto original = tx::image_memory_policy();
+    tx::Image_Memory<float> image;
+
+    tx::Image_Memory_Policy padded = original;
+    padded.pad_rows = true;
+    tx::set_image_memory_policy( padded );
+    ASSERT_TRUE( image.policy().pad_rows );
+
+    ASSERT_FALSE( image.set_size( 5, 3 ).has_error() );
+    tx::set_image_memory_policy( original );
+
+    // The image keeps the policy it was allocated with
+    ASSERT_TRUE( image.policy().pad_rows );
+    ASSERT_EQ( image.row_stride(), 16 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        ASSERT_EQ( image( c, r ), 0 );
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ * @file    TEST_Mapped_Image_Allocator.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/crop_image.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+#include <terminus/image/types/Mapped_Image_Allocator.hpp>
+
+// C++ Libraries
+#include <filesystem>
+#include <limits>
+
+namespace tx = tmns::image;
+
+/**********************************************/
+/*      Mapped images act like heap images    */
+/**********************************************/
+TEST( Mapped_Image_Allocator, image_memory )
+{
+    auto scratch_dir = std::filesystem::temp_directory_path() / "TEST_Mapped_Image_Allocator";
+    std::filesystem::create_directories( scratch_dir );
+
+    tx::Image_Memory_Policy policy;
+    policy.allocator = std::make_shared<tx::Mapped_Image_Allocator>( scratch_dir,
+                                                                     tx::Mapped_Access_Pattern::RANDOM );
+
+    {
+        tx::Image_Memory<uint16_t> image( 500, 400, 2, policy );
+        ASSERT_TRUE( image.is_valid_image() );
+        ASSERT_EQ( (uintptr_t)image.data() % 64, 0 );
+
+        // Scratch files are unlinked right away
+        ASSERT_TRUE( std::filesystem::is_empty( scratch_dir ) );
+
+        // New pixels read as zero
+        ASSERT_EQ( image( 499, 399, 1 ), 0 );
+
+        for( size_t p = 0; p < image.planes(); p++ )
+        for( size_t r = 0; r < image.rows(); r++ )
+        for( size_t c = 0; c < image.cols(); c++ )
+        {
+            image( c, r, p ) = uint16_t( c + r * 3 + p * 7 );
+        }
+
+        // Views rasterize into and out of mapped memory
+        tx::Image_Memory<uint16_t> cropped( tx::crop_image( image, 100, 50, 30, 20 ), policy );
+        for( size_t p = 0; p < cropped.planes(); p++ )
+        for( size_t r = 0; r < cropped.rows(); r++ )
+        for( size_t c = 0; c < cropped.cols(); c++ )
+        {
+            ASSERT_EQ( cropped( c, r, p ), uint16_t( c + 100 + ( r + 50 ) * 3 + p * 7 ) );
+        }
+
+        ASSERT_TRUE( tx::Mapped_Image_Allocator::advise( image.data(),
+                                                         image.plane_stride() * sizeof(uint16_t),
+                                                         tx::Mapped_Access_Pattern::SEQUENTIAL ) );
+    }
+
+    std::filesystem::remove_all( scratch_dir );
+}
+
+/**********************************************/
+/*      Mapping failures are reported         */
+/**********************************************/
+TEST( Mapped_Image_Allocator, missing_directory )
+{
+    tx::Mapped_Image_Allocator allocator( "/path/which/does/not/exist" );
+    ASSERT_EQ( allocator.allocate( 1024, 64 ), nullptr );
+
+    tx::Image_Memory_Policy policy;
+    policy.allocator = std::make_shared<tx::Mapped_Image_Allocator>( "/path/which/does/not/exist" );
+    tx::Image_Memory<float> image;
+    ASSERT_EQ( image.policy().allocator, nullptr );
+    tx::Image_Memory<float> mapped( 0, 0, 1, policy );
+    ASSERT_TRUE( mapped.set_size( 10, 10 ).has_error() );
+}
+
+/**********************************************/
+/*      Oversized images fail cleanly         */
+/**********************************************/
+TEST( Mapped_Image_Allocator, size_overflow )
+{
+    // File-backed images skip the size limits, so the byte count must not wrap
+    tx::Image_Memory_Policy policy;
+    policy.allocator = std::make_shared<tx::Mapped_Image_Allocator>();
+    tx::Image_Memory<float> mapped( 0, 0, 1, policy );
+
+    const size_t huge = std::numeric_limits<size_t>::max() / 2;
+    ASSERT_TRUE( mapped.set_size( huge, 4 ).has_error() );
+    ASSERT_EQ( mapped.cols(), 0 );
+    ASSERT_EQ( mapped.rows(), 0 );
+
+    // Pixel count fits, but not once multiplied by the pixel size
+    ASSERT_EQ( tx::detail::allocate_pixels<float>( huge, 64, false, policy.allocator ), nullptr );
+}
@@ -0,0 +1,163 @@
+/**
+ * @file    TEST_for_each_pixel.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/statistics/channel_operations.hpp>
+#include <terminus/image/types/for_each_pixel.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+// C++ Libraries
+#include <cmath>
+
+namespace tx = tmns::image;
+
+/**
+ * Counts and sums pixels, merging per-thread copies
+*/
+struct Sum_Functor
+{
+    void operator()( const float& value )
+    {
+        sum += value;
+        count++;
+    }
+
+    void merge( const Sum_Functor& other )
+    {
+        sum   += other.sum;
+        count += other.count;
+    }
+
+    double sum { 0 };
+    size_t count { 0 };
+};
+
+/**
+ * Scaled sum with no default constructor, so extra threads start from reset() copies
+*/
+struct Scaled_Sum_Functor
+{
+    explicit Scaled_Sum_Functor( double scale_ ) : scale( scale_ ) {}
+
+    void operator()( const float& value )
+    {
+        sum += scale * value;
+    }
+
+    void merge( const Scaled_Sum_Functor& other )
+    {
+        sum += other.sum;
+    }
+
+    void reset()
+    {
+        sum = 0;
+    }
+
+    double scale;
+    double sum { 0 };
+};
+
+/**
+ * Same, without merge(), so it must never be split
+*/
+struct Unmergeable_Sum_Functor
+{
+    void operator()( const float& value )
+    {
+        sum += value;
+    }
+
+    double sum { 0 };
+};
+
+/****************************************************/
+/*      Parallel Visit Matches Serial               */
+/****************************************************/
+TEST( for_each_pixel, parallel_matches_serial )
+{
+    static_assert( tx::Is_Mergeable_Functor<Sum_Functor>::value );
+    static_assert( !tx::Is_Mergeable_Functor<const Sum_Functor>::value );
+    static_assert( !tx::Is_Mergeable_Functor<Unmergeable_Sum_Functor>::value );
+
+    tx::Image_Memory<float> image( 301, 457, 2 );
+    for( size_t p = 0; p < image.planes(); p++ )
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r, p ) = float( ( c * 13 + r * 7 + p ) % 101 );
+    }
+
+    tx::For_Each_Pixel_Settings settings;
+    settings.num_threads = 7;
+    settings.min_pixels  = 0;
+    settings.min_rows_per_thread = 1;
+    tmns::core::utility::Progress_Callback_Null progress;
+
+    Sum_Functor serial, parallel;
+    tx::for_each_pixel( image, serial );
+    tx::for_each_pixel( image, parallel, progress, settings );
+    ASSERT_EQ( serial.count, image.cols() * image.rows() * image.planes() );
+    ASSERT_EQ( parallel.count, serial.count );
+    ASSERT_EQ( parallel.sum, serial.sum );
+
+    Unmergeable_Sum_Functor unmergeable;
+    tx::for_each_pixel( image, unmergeable, progress, settings );
+    ASSERT_EQ( unmergeable.sum, serial.sum );
+
+    // State the caller already held is counted once, not once per thread
+    Sum_Functor running;
+    running.sum   = 1000;
+    running.count = 5;
+    tx::for_each_pixel( image, running, progress, settings );
+    ASSERT_EQ( running.count, serial.count + 5 );
+    ASSERT_EQ( running.sum, serial.sum + 1000 );
+
+    static_assert( tx::Is_Mergeable_Functor<Scaled_Sum_Functor>::value );
+    Scaled_Sum_Functor scaled( 2 );
+    scaled.sum = 1;
+    tx::for_each_pixel( image, scaled, progress, settings );
+    ASSERT_EQ( scaled.sum, 2 * serial.sum + 1 );
+}
+
+/****************************************************/
+/*      Statistics Through the Global Setting       */
+/****************************************************/
+TEST( for_each_pixel, parallel_statistics )
+{
+    tx::Image_Memory<float> image( 640, 480 );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = float( c ) - float( r ) * 0.5f;
+    }
+
+    float serial_min, serial_max;
+    tx::ops::min_max_channel_values( image, serial_min, serial_max );
+    double serial_mean   = tx::ops::mean_channel_value( image );
+    double serial_stddev = tx::ops::stddev_channel_value( image );
+
+    auto defaults = tx::for_each_pixel_settings();
+    auto settings = defaults;
+    settings.num_threads = 4;
+    settings.min_pixels  = 0;
+    tx::set_for_each_pixel_settings( settings );
+
+    float min, max;
+    tx::ops::min_max_channel_values( image, min, max );
+    double mean   = tx::ops::mean_channel_value( image );
+    double stddev = tx::ops::stddev_channel_value( image );
+    tx::set_for_each_pixel_settings( defaults );
+
+    ASSERT_EQ( min, -239.5f );
+    ASSERT_EQ( max, 639.f );
+    ASSERT_EQ( min, serial_min );
+    ASSERT_EQ( max, serial_max );
+    ASSERT_NEAR( mean, 319.5 - 119.75, 1e-9 );
+    ASSERT_NEAR( mean, serial_mean, 1e-9 );
+    ASSERT_NEAR( stddev, serial_stddev, 1e-9 );
+}
@@ -0,0 +1,99 @@
+/**
+ * @file    TEST_OpenCV_Adapters.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/pixel/Pixel_RGB.hpp>
+#include <terminus/image/utility/OpenCV_Adapters.hpp>
+
+namespace tx = tmns::image;
+
+/************************************************/
+/*      Wrap an Image_Memory as a cv::Mat       */
+/************************************************/
+TEST( OpenCV_Adapters, image_memory_to_cv_mat )
+{
+    tx::Image_Memory_Policy policy;
+    policy.pad_rows = true;
+    tx::Image_Memory<tx::PixelRGB_u8> image( 50, 40, 1, policy );
+    for( size_t r = 0; r < image.rows(); r++ )
+    for( size_t c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = tx::PixelRGB_u8( uint8_t( c ), uint8_t( r ), 7 );
+    }
+
+    auto mat_res = tx::utility::ocv::to_cv_mat( image );
+    ASSERT_FALSE( mat_res.has_error() );
+    cv::Mat mat = mat_res.value();
+    ASSERT_EQ( mat.type(), CV_8UC3 );
+    ASSERT_EQ( mat.cols, 50 );
+    ASSERT_EQ( mat.rows, 40 );
+    ASSERT_EQ( mat.step[0], image.row_stride() * sizeof(tx::PixelRGB_u8) );
+    ASSERT_EQ( (void*)mat.data, (void*)image.data() );
+    ASSERT_EQ( mat.at<cv::Vec3b>( 33, 21 )[0], 21 );
+    ASSERT_EQ( mat.at<cv::Vec3b>( 33, 21 )[1], 33 );
+
+    // Writes through the Mat show up in the image
+    mat.at<cv::Vec3b>( 5, 6 )[2] = 99;
+    ASSERT_EQ( image( 6, 5 )[2], 99 );
+
+    // Crops share the parent's pixels
+    auto crop_res = tx::utility::ocv::to_cv_mat( tx::crop_image( image, 10, 20, 15, 12 ) );
+    ASSERT_FALSE( crop_res.has_error() );
+    cv::Mat crop = crop_res.value();
+    ASSERT_EQ( crop.cols, 15 );
+    ASSERT_EQ( crop.rows, 12 );
+    ASSERT_EQ( (void*)crop.data, (void*)&image( 10, 20 ) );
+    ASSERT_EQ( crop.at<cv::Vec3b>( 0, 0 )[0], 10 );
+    ASSERT_EQ( crop.at<cv::Vec3b>( 0, 0 )[1], 20 );
+
+    // Multi-plane images have no Mat equivalent
+    tx::Image_Memory<uint8_t> planar( 10, 10, 3 );
+    ASSERT_TRUE( tx::utility::ocv::to_cv_mat( planar ).has_error() );
+}
+
+/************************************************/
+/*      Wrap a cv::Mat as an Image_Memory       */
+/************************************************/
+TEST( OpenCV_Adapters, cv_mat_to_image_memory )
+{
+    tx::Image_Memory<float> image;
+    {
+        cv::Mat mat( 30, 20, CV_32FC1 );
+        for( int r = 0; r < mat.rows; r++ )
+        for( int c = 0; c < mat.cols; c++ )
+        {
+            mat.at<float>( r, c ) = float( r * 100 + c );
+        }
+
+        auto image_res = tx::utility::ocv::to_image_memory<float>( mat );
+        ASSERT_FALSE( image_res.has_error() );
+        image = image_res.value();
+        ASSERT_EQ( (void*)image.data(), (void*)mat.data );
+
+        // Mismatched types are rejected
+        ASSERT_TRUE( tx::utility::ocv::to_image_memory<uint8_t>( mat ).has_error() );
+        ASSERT_TRUE( tx::utility::ocv::to_image_memory<tx::PixelRGB_f32>( mat ).has_error() );
+    }
+
+    // The image keeps the Mat's data alive
+    ASSERT_EQ( image.cols(), 20 );
+    ASSERT_EQ( image.rows(), 30 );
+    ASSERT_EQ( image( 7, 12 ), 1207.f );
+
+    // Sub-regions of a Mat keep their step
+    cv::Mat big( 100, 100, CV_8UC3, cv::Scalar( 1, 2, 3 ) );
+    cv::Mat roi = big( cv::Rect( 10, 10, 40, 30 ) );
+    auto roi_res = tx::utility::ocv::to_image_memory<tx::PixelRGB_u8>( roi );
+    ASSERT_FALSE( roi_res.has_error() );
+    ASSERT_EQ( roi_res.value().row_stride(), 100 );
+    ASSERT_EQ( roi_res.value()( 39, 29 )[2], 3 );
+
+    // Copying out goes through the normal rasterize path
+    tx::Image_Memory<tx::PixelRGB_u8> copy = tx::crop_image( roi_res.value(), 0, 0, 40, 30 );
+    ASSERT_TRUE( copy.is_contiguous() );
+    ASSERT_EQ( copy( 0, 0 )[1], 2 );
+}